@@ -0,0 +1,46 @@
+#!/bin/bash
+
+# Measure the average run time of the ipft BPF programs. Run this as
+# root while the traffic marked with the mark given to ipft is flowing.
+#
+# Usage: scripts/bench.sh [IPFT-OPTIONS...]
+#
+# Compare the builds by pointing IPFT to each binary. For example,
+#
+#   IPFT=./ipft.old scripts/bench.sh -m 0xdeadbeef -o json > /dev/null
+#   IPFT=./ipft.new scripts/bench.sh -m 0xdeadbeef -o json > /dev/null
+#
+# Needs bpftool and jq. The programs loaded per function by ftrace
+# backend are not named, so they are not counted.
+
+if [ -z "$IPFT" ]; then
+    IPFT=src/ipft
+fi
+
+if [ -z "$DURATION" ]; then
+    DURATION=30
+fi
+
+STATS_ENABLED=$(sysctl -n kernel.bpf_stats_enabled)
+sysctl -q -w kernel.bpf_stats_enabled=1
+
+$IPFT "$@" &
+PID=$!
+
+# Give enough time to attach. The statistics before that are noise.
+sleep 10
+
+before=$(bpftool prog show -j | jq '[.[] | select((.name // "") | startswith("ipft_main"))] | [(map(.run_time_ns // 0) | add), (map(.run_cnt // 0) | add)]')
+
+sleep $DURATION
+
+after=$(bpftool prog show -j | jq '[.[] | select((.name // "") | startswith("ipft_main"))] | [(map(.run_time_ns // 0) | add), (map(.run_cnt // 0) | add)]')
+
+kill -INT $PID
+wait $PID
+
+sysctl -q -w kernel.bpf_stats_enabled=$STATS_ENABLED
+
+jq -n -r --argjson b "$before" --argjson a "$after" \
+    '($a[0] - $b[0]) as $ns | ($a[1] - $b[1]) as $cnt |
+     "runs: \($cnt), total: \($ns) ns, average: \(if $cnt == 0 then 0 else $ns / $cnt end) ns/run"' >&2
@@ -0,0 +1,378 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <sys/utsname.h>
+
+#include "ipft.h"
+#include "khash.h"
+#include "kvec.h"
+
+/*
+ * Functions known to fail attaching. They are excluded before
+ * attaching to save the time and the noise.
+ */
+
+KHASH_SET_INIT_STR(failed)
+
+#define KPROBE_BLACKLIST "/sys/kernel/debug/kprobes/blacklist"
+
+/* Kernel internal, but leaks to the user space from the BPF syscalls */
+#ifndef ENOTSUPP
+#define ENOTSUPP 524
+#endif
+
+struct blacklist_range {
+  uint64_t start;
+  uint64_t end;
+};
+
+struct ipft_exclude {
+  /* Name of the failure cache. NULL disables the cache. */
+  const char *cache_name;
+  uint64_t key;
+  /* Address ranges of kprobe blacklist sorted by start */
+  kvec_t(struct blacklist_range) blacklist;
+  /* Functions failed in the previous runs */
+  khash_t(failed) * failed;
+  /* Functions failed in this run. Updated by the attach workers. */
+  kvec_t(const char *) new_failed;
+  pthread_mutex_t mutex;
+};
+
+static int
+compare_range(const void *_r1, const void *_r2)
+{
+  const struct blacklist_range *r1 = (const struct blacklist_range *)_r1;
+  const struct blacklist_range *r2 = (const struct blacklist_range *)_r2;
+
+  if (r1->start != r2->start) {
+    return r1->start < r2->start ? -1 : 1;
+  }
+
+  return 0;
+}
+
+/*
+ * Each line is "0x<start>-0x<end>\t<symbol> [module]". The kprobes
+ * on these ranges are always rejected by the kernel.
+ */
+static int
+load_kprobe_blacklist(struct ipft_exclude *ex)
+{
+  FILE *f;
+  size_t n, len = 0;
+  char *line = NULL;
+  struct blacklist_range r;
+
+  f = fopen(KPROBE_BLACKLIST, "r");
+  if (f == NULL) {
+    VERBOSE("Cannot open %s: %s\n", KPROBE_BLACKLIST, strerror(errno));
+    return 0;
+  }
+
+  while (getline(&line, &len, f) != -1) {
+    if (sscanf(line, "0x%" SCNx64 "-0x%" SCNx64, &r.start, &r.end) != 2) {
+      continue;
+    }
+    kv_push(struct blacklist_range, ex->blacklist, r);
+  }
+
+  free(line);
+  fclose(f);
+
+  qsort(ex->blacklist.a, kv_size(ex->blacklist), sizeof(r), compare_range);
+
+  /*
+   * The ranges may overlap or contain the others (e.g. a section and
+   * the functions in it). Merge them, so the range preceding the addr
+   * is the only one which can contain it.
+   */
+  n = 0;
+  for (size_t i = 0; i < kv_size(ex->blacklist); i++) {
+    r = kv_A(ex->blacklist, i);
+    if (n != 0 && r.start <= kv_A(ex->blacklist, n - 1).end) {
+      if (r.end > kv_A(ex->blacklist, n - 1).end) {
+        kv_A(ex->blacklist, n - 1).end = r.end;
+      }
+      continue;
+    }
+    kv_A(ex->blacklist, n++) = r;
+  }
+  kv_size(ex->blacklist) = n;
+
+  return 0;
+}
+
+/*
+ * The ranges are disjoint after load_kprobe_blacklist
+ */
+static bool
+is_blacklisted(struct ipft_exclude *ex, uint64_t addr)
+{
+  size_t mid, left = 0, right = kv_size(ex->blacklist);
+
+  /* Find the first range starting above the addr */
+  while (left < right) {
+    mid = left + (right - left) / 2;
+    if (kv_A(ex->blacklist, mid).start <= addr) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+
+  return left != 0 && addr < kv_A(ex->blacklist, left - 1).end;
+}
+
+/*
+ * The failures depend on the kernel build and the backend
+ */
+static void
+failure_cache_path(struct ipft_exclude *ex, char *path, size_t len)
+{
+  snprintf(path, len, "%s/failed-%s-%016" PRIx64, IPFT_CACHE_DIR,
+           ex->cache_name, ex->key);
+}
+
+static int
+put_failed(struct ipft_exclude *ex, const char *symname)
+{
+  char *k;
+  int missing;
+  __unused khint_t iter;
+
+  k = strdup(symname);
+  if (k == NULL) {
+    ERROR("strdup failed\n");
+    return -1;
+  }
+
+  iter = kh_put(failed, ex->failed, k, &missing);
+  if (missing == -1) {
+    ERROR("kh_put failed\n");
+    return -1;
+  } else if (!missing) {
+    free(k);
+  }
+
+  return 0;
+}
+
+static int
+load_failure_cache(struct ipft_exclude *ex)
+{
+  int fd;
+  FILE *f;
+  ssize_t n;
+  size_t len = 0;
+  char *line = NULL;
+  char path[PATH_MAX];
+
+  failure_cache_path(ex, path, sizeof(path));
+
+  fd = cache_open(path);
+  if (fd == -1) {
+    return 0;
+  }
+
+  f = fdopen(fd, "r");
+  if (f == NULL) {
+    close(fd);
+    return 0;
+  }
+
+  while ((n = getline(&line, &len, f)) != -1) {
+    if (n > 0 && line[n - 1] == '\n') {
+      line[n - 1] = '\0';
+    }
+
+    if (line[0] == '\0') {
+      continue;
+    }
+
+    if (put_failed(ex, line) == -1) {
+      ERROR("put_failed failed\n");
+      free(line);
+      fclose(f);
+      return -1;
+    }
+  }
+
+  free(line);
+  fclose(f);
+
+  VERBOSE("Loaded %u known failures from %s\n", kh_size(ex->failed), path);
+
+  return 0;
+}
+
+int
+exclude_create(struct ipft_exclude **exp, enum ipft_backends backend,
+               bool use_cache)
+{
+  int error;
+  struct utsname uts;
+  struct ipft_exclude *ex;
+
+  ex = calloc(1, sizeof(*ex));
+  if (ex == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  ex->failed = kh_init(failed);
+  if (ex->failed == NULL) {
+    ERROR("kh_init failed\n");
+    goto err0;
+  }
+
+  kv_init(ex->blacklist);
+  kv_init(ex->new_failed);
+  pthread_mutex_init(&ex->mutex, NULL);
+
+  /*
+   * Only the kprobe honors the blacklist. fprobe used by the
+   * kprobe-multi and fentry/fexit have their own restrictions.
+   */
+  if (backend == IPFT_BACKEND_KPROBE) {
+    error = load_kprobe_blacklist(ex);
+    if (error == -1) {
+      ERROR("load_kprobe_blacklist failed\n");
+      goto err1;
+    }
+  }
+
+  if (use_cache && uname(&uts) == 0) {
+    ex->cache_name = get_backend_name_by_id(backend);
+    ex->key = HASH_INIT;
+    hash_update(&ex->key, uts.release, strlen(uts.release));
+    hash_update(&ex->key, uts.version, strlen(uts.version));
+
+    error = load_failure_cache(ex);
+    if (error == -1) {
+      ERROR("load_failure_cache failed\n");
+      goto err1;
+    }
+  }
+
+  *exp = ex;
+
+  return 0;
+
+err1:
+  for (khint_t iter = kh_begin(ex->failed); iter != kh_end(ex->failed);
+       iter++) {
+    if (kh_exist(ex->failed, iter)) {
+      free((char *)kh_key(ex->failed, iter));
+    }
+  }
+  kh_destroy(failed, ex->failed);
+  kv_destroy(ex->blacklist);
+  pthread_mutex_destroy(&ex->mutex);
+err0:
+  free(ex);
+  return -1;
+}
+
+/*
+ * Not called concurrently with exclude_add_failed
+ */
+bool
+exclude_match(struct ipft_exclude *ex, struct ipft_sym *sym)
+{
+  if (is_blacklisted(ex, sym->addr)) {
+    return true;
+  }
+
+  return kh_get(failed, ex->failed, sym->symname) != kh_end(ex->failed);
+}
+
+/*
+ * Record the function failed to attach with the error (negative
+ * errno). Only the errors telling the function can never be attached
+ * are recorded. The others (e.g. the resource shortage, or the busy
+ * or missing tracefs) may go away next time.
+ */
+void
+exclude_add_failed(struct ipft_exclude *ex, struct ipft_sym *sym, int error)
+{
+  if (error != -EINVAL && error != -ENOENT && error != -EOPNOTSUPP &&
+      error != -ENOTSUPP) {
+    return;
+  }
+
+  pthread_mutex_lock(&ex->mutex);
+  kv_push(const char *, ex->new_failed, sym->symname);
+  pthread_mutex_unlock(&ex->mutex);
+}
+
+/*
+ * Write back the failures including the ones in this run. Failing to
+ * store the cache is not fatal.
+ */
+int
+exclude_store(struct ipft_exclude *ex)
+{
+  FILE *f;
+  int fd;
+  khint_t iter;
+  char path[PATH_MAX], tmp[PATH_MAX];
+
+  if (ex->cache_name == NULL || kv_size(ex->new_failed) == 0) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < kv_size(ex->new_failed); i++) {
+    if (put_failed(ex, kv_A(ex->new_failed, i)) == -1) {
+      return -1;
+    }
+  }
+
+  if (cache_dir_create() == -1) {
+    return -1;
+  }
+
+  failure_cache_path(ex, path, sizeof(path));
+  snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+
+  fd = mkstemp(tmp);
+  if (fd == -1) {
+    VERBOSE("Cannot create %s: %s\n", tmp, strerror(errno));
+    return -1;
+  }
+
+  f = fdopen(fd, "w");
+  if (f == NULL) {
+    close(fd);
+    unlink(tmp);
+    return -1;
+  }
+
+  for (iter = kh_begin(ex->failed); iter != kh_end(ex->failed); iter++) {
+    if (kh_exist(ex->failed, iter)) {
+      fprintf(f, "%s\n", kh_key(ex->failed, iter));
+    }
+  }
+
+  if (fclose(f) != 0) {
+    VERBOSE("Cannot write %s: %s\n", tmp, strerror(errno));
+    unlink(tmp);
+    return -1;
+  }
+
+  /* Readers never see the partially written cache */
+  if (rename(tmp, path) == -1) {
+    VERBOSE("Cannot rename %s: %s\n", tmp, strerror(errno));
+    unlink(tmp);
+    return -1;
+  }
+
+  VERBOSE("Recorded %zu new failures to %s\n", kv_size(ex->new_failed), path);
+
+  return 0;
+}
@@ -0,0 +1,298 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <sys/stat.h>
+
+#include "ipft.h"
+
+/*
+ * Filters on the packet metadata evaluated in the kernel. They are
+ * parsed from the command line options into struct ipft_filter which
+ * is passed to the BPF programs as a part of the configuration.
+ */
+
+struct name_value {
+  const char *name;
+  uint32_t value;
+};
+
+static const struct name_value ethertypes[] = {
+    {"ip", 0x0800},
+    {"ip6", 0x86dd},
+    {"arp", 0x0806},
+    {"vlan", 0x8100},
+    {NULL, 0},
+};
+
+static const struct name_value l4_protocols[] = {
+    {"icmp", 1},
+    {"tcp", 6},
+    {"udp", 17},
+    {"icmp6", 58},
+    {"sctp", 132},
+    {NULL, 0},
+};
+
+static const char *options[] = {
+    "netns", "ifindex", "cgroup", "protocol", "l4-protocol",
+    "saddr", "daddr",   "sport",  "dport",    NULL,
+};
+
+bool
+filter_has_option(const char *name)
+{
+  for (int i = 0; options[i] != NULL; i++) {
+    if (strcmp(options[i], name) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static int
+parse_number(const char *value, uint64_t max, uint64_t *nump)
+{
+  char *end;
+  unsigned long long num;
+
+  errno = 0;
+  num = strtoull(value, &end, 0);
+  if (errno != 0 || end == value || *end != '\0' || num > max) {
+    return -1;
+  }
+
+  *nump = num;
+
+  return 0;
+}
+
+static int
+parse_name_or_number(const struct name_value *table, const char *value,
+                     uint64_t max, uint64_t *nump)
+{
+  for (int i = 0; table[i].name != NULL; i++) {
+    if (strcmp(table[i].name, value) == 0) {
+      *nump = table[i].value;
+      return 0;
+    }
+  }
+
+  return parse_number(value, max, nump);
+}
+
+/*
+ * The namespace and the cgroup are given as the id or the path. The
+ * id of them is the inode number of the path (e.g. /run/netns/foo or
+ * /proc/<pid>/ns/net for the namespace and the directory on cgroup2
+ * filesystem for the cgroup).
+ */
+static int
+parse_id_or_path(const char *value, uint64_t max, uint64_t *idp)
+{
+  struct stat st;
+
+  if (parse_number(value, max, idp) == 0) {
+    return 0;
+  }
+
+  if (stat(value, &st) == -1) {
+    ERROR("Cannot stat %s: %s\n", value, strerror(errno));
+    return -1;
+  }
+
+  *idp = st.st_ino;
+
+  return 0;
+}
+
+static int
+parse_addr(struct ipft_filter *f, const char *value, uint32_t *addr,
+           uint8_t flag)
+{
+  bool inet6;
+
+  if (inet_pton(AF_INET, value, addr) == 1) {
+    inet6 = false;
+  } else if (inet_pton(AF_INET6, value, addr) == 1) {
+    inet6 = true;
+  } else {
+    return -1;
+  }
+
+  /* Both addresses are compared to the same header */
+  if ((f->flags & (IPFT_FILTER_F_SADDR | IPFT_FILTER_F_DADDR) & ~flag) &&
+      inet6 != !!(f->flags & IPFT_FILTER_F_INET6)) {
+    ERROR("saddr and daddr should be the same address family\n");
+    return -1;
+  }
+
+  f->flags |= flag;
+
+  if (inet6) {
+    f->flags |= IPFT_FILTER_F_INET6;
+  } else {
+    f->flags &= ~IPFT_FILTER_F_INET6;
+  }
+
+  return 0;
+}
+
+int
+filter_parse(struct ipft_filter *f, const char *name, const char *value)
+{
+  uint64_t num;
+
+  if (strcmp(name, "netns") == 0) {
+    if (parse_id_or_path(value, UINT32_MAX, &num) == -1) {
+      goto err;
+    }
+    f->netns = num;
+    return 0;
+  }
+
+  if (strcmp(name, "ifindex") == 0) {
+    if (parse_number(value, UINT32_MAX, &num) == -1) {
+      /* Resolved in the current namespace */
+      num = if_nametoindex(value);
+      if (num == 0) {
+        goto err;
+      }
+    }
+    f->ifindex = num;
+    return 0;
+  }
+
+  if (strcmp(name, "cgroup") == 0) {
+    if (parse_id_or_path(value, UINT64_MAX, &num) == -1) {
+      goto err;
+    }
+    f->cgroup_id = num;
+    return 0;
+  }
+
+  if (strcmp(name, "protocol") == 0) {
+    if (parse_name_or_number(ethertypes, value, UINT16_MAX, &num) == -1) {
+      goto err;
+    }
+    f->protocol = htons(num);
+    return 0;
+  }
+
+  if (strcmp(name, "l4-protocol") == 0) {
+    if (parse_name_or_number(l4_protocols, value, UINT8_MAX, &num) == -1) {
+      goto err;
+    }
+    f->l4_protocol = num;
+    return 0;
+  }
+
+  if (strcmp(name, "saddr") == 0) {
+    memset(f->saddr, 0, sizeof(f->saddr));
+    if (parse_addr(f, value, f->saddr, IPFT_FILTER_F_SADDR) == -1) {
+      goto err;
+    }
+    return 0;
+  }
+
+  if (strcmp(name, "daddr") == 0) {
+    memset(f->daddr, 0, sizeof(f->daddr));
+    if (parse_addr(f, value, f->daddr, IPFT_FILTER_F_DADDR) == -1) {
+      goto err;
+    }
+    return 0;
+  }
+
+  if (strcmp(name, "sport") == 0) {
+    if (parse_number(value, UINT16_MAX, &num) == -1) {
+      goto err;
+    }
+    f->sport = htons(num);
+    return 0;
+  }
+
+  if (strcmp(name, "dport") == 0) {
+    if (parse_number(value, UINT16_MAX, &num) == -1) {
+      goto err;
+    }
+    f->dport = htons(num);
+    return 0;
+  }
+
+  ERROR("Unknown filter %s\n", name);
+  return -1;
+
+err:
+  ERROR("Invalid %s %s\n", name, value);
+  return -1;
+}
+
+bool
+filter_is_set(struct ipft_filter *f)
+{
+  return f->netns != 0 || f->ifindex != 0 || f->cgroup_id != 0 ||
+         f->protocol != 0 || f->l4_protocol != 0 || f->sport != 0 ||
+         f->dport != 0 ||
+         (f->flags & (IPFT_FILTER_F_SADDR | IPFT_FILTER_F_DADDR)) != 0;
+}
+
+static void
+dump_addr(const char *name, struct ipft_filter *f, uint32_t *addr,
+          uint8_t flag)
+{
+  char buf[INET6_ADDRSTRLEN];
+  int af = (f->flags & IPFT_FILTER_F_INET6) ? AF_INET6 : AF_INET;
+
+  if (!(f->flags & flag)) {
+    return;
+  }
+
+  if (inet_ntop(af, addr, buf, sizeof(buf)) == NULL) {
+    return;
+  }
+
+  INFO("%-19s: %s\n", name, buf);
+}
+
+/*
+ * Only the filters in use are shown
+ */
+void
+filter_dump(struct ipft_filter *f)
+{
+  if (f->netns != 0) {
+    INFO("netns              : %u\n", f->netns);
+  }
+
+  if (f->ifindex != 0) {
+    INFO("ifindex            : %u\n", f->ifindex);
+  }
+
+  if (f->cgroup_id != 0) {
+    INFO("cgroup             : %" PRIu64 "\n", f->cgroup_id);
+  }
+
+  if (f->protocol != 0) {
+    INFO("protocol           : 0x%04x\n", ntohs(f->protocol));
+  }
+
+  if (f->l4_protocol != 0) {
+    INFO("l4_protocol        : %u\n", f->l4_protocol);
+  }
+
+  dump_addr("saddr", f, f->saddr, IPFT_FILTER_F_SADDR);
+  dump_addr("daddr", f, f->daddr, IPFT_FILTER_F_DADDR);
+
+  if (f->sport != 0) {
+    INFO("sport              : %u\n", ntohs(f->sport));
+  }
+
+  if (f->dport != 0) {
+    INFO("dport              : %u\n", ntohs(f->dport));
+  }
+}
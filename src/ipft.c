@@ -31,6 +31,26 @@ static struct option options[] = {
     {"perf-page-count", required_argument, 0, '0'},
     {"perf-sample-period", required_argument, 0, '0'},
     {"perf-wakeup-events", required_argument, 0, '0'},
+    {"transport", required_argument, 0, '0'},
+    {"ringbuf-page-count", required_argument, 0, '0'},
+    {"consumer-threads", required_argument, 0, '0'},
+    {"attach-threads", required_argument, 0, '0'},
+    {"consolidate", no_argument, 0, '0'},
+    {"only-dropped", no_argument, 0, '0'},
+    {"track-skb", no_argument, 0, '0'},
+    {"lineage", no_argument, 0, '0'},
+    {"netns", required_argument, 0, '0'},
+    {"ifindex", required_argument, 0, '0'},
+    {"cgroup", required_argument, 0, '0'},
+    {"protocol", required_argument, 0, '0'},
+    {"l4-protocol", required_argument, 0, '0'},
+    {"saddr", required_argument, 0, '0'},
+    {"daddr", required_argument, 0, '0'},
+    {"sport", required_argument, 0, '0'},
+    {"dport", required_argument, 0, '0'},
+    {"no-symsdb-cache", no_argument, 0, '0'},
+    {"no-link-cache", no_argument, 0, '0'},
+    {"no-failure-cache", no_argument, 0, '0'},
     {"no-set-rlimit", no_argument, 0, '0'},
     {"enable-probe-server", no_argument, 0, '0'},
     {"probe-server-port", required_argument, 0, '0'},
@@ -47,9 +67,10 @@ usage(void)
        " -h, --help                               Show this text\n"
        " -l, --list                               List functions\n"
        " -m, --mark               [NUMBER]        Trace the packet marked "
-       "with <mark> [required]\n"
+       "with <mark> (default: 0)\n"
        "   , --mask               [NUMBER]        Only match to the bits "
-       "masked with given bitmask (default: 0xffffffff)\n"
+       "masked with given bitmask, 0 ignores the mark (default: "
+       "0xffffffff, 0 with the filters and no mark)\n"
        " -o, --output             [OUTPUT-FORMAT] Specify output format\n"
        " -r, --regex              [REGEX]         Filter the function to "
        "trace with regex\n"
@@ -62,13 +83,54 @@ usage(void)
        "perf_event_open(2) man page (default: 1)\n"
        "   , --perf-wakeup-events [NUMBER]        See wakeup_events of "
        "perf_event_open(2) man page (default: 1)\n"
+       "   , --transport          [TRANSPORT]     Specify event transport "
+       "(default: ringbuf if available)\n"
+       "   , --ringbuf-page-count [NUMBER]        Size of the ring buffer in "
+       "pages, power of 2 (default: 256)\n"
+       "   , --consumer-threads   [NUMBER]        Number of threads "
+       "consuming perf buffers (default: 1)\n"
+       "   , --attach-threads     [NUMBER]        Number of threads "
+       "attaching programs (default: 0 = online CPUs)\n"
+       "   , --consolidate                        Send the trace of the "
+       "packet at once when it is freed\n"
+       "   , --only-dropped                       Only show the packets "
+       "dropped (requires --consolidate)\n"
+       "   , --track-skb                          Keep tracing the packet "
+       "matched once until it is freed\n"
+       "   , --lineage                            Follow the clones and "
+       "copies of the packet (implies --track-skb)\n"
+       "   , --netns              [ID or PATH]    Only trace the packets in "
+       "the network namespace\n"
+       "   , --ifindex            [INDEX or NAME] Only trace the packets on "
+       "the device\n"
+       "   , --cgroup             [ID or PATH]    Only trace the packets of "
+       "the sockets in the cgroup\n"
+       "   , --protocol           [PROTOCOL]      Only trace the packets of "
+       "the ethertype (ip, ip6, arp, vlan or number)\n"
+       "   , --l4-protocol        [PROTOCOL]      Only trace the packets of "
+       "the L4 protocol (tcp, udp, icmp, icmp6, sctp or number)\n"
+       "   , --saddr              [ADDRESS]       Only trace the packets from "
+       "the IPv4 or IPv6 address\n"
+       "   , --daddr              [ADDRESS]       Only trace the packets to "
+       "the IPv4 or IPv6 address\n"
+       "   , --sport              [PORT]          Only trace the packets from "
+       "the port\n"
+       "   , --dport              [PORT]          Only trace the packets to "
+       "the port\n"
+       "   , --no-symsdb-cache                    Don't use the cache of the "
+       "symbol database\n"
+       "   , --no-link-cache                      Don't use the cache of the "
+       "objects linked with script\n"
+       "   , --no-failure-cache                   Don't skip the functions "
+       "failed to attach before\n"
        "   , --no-set-rlimit                      Don't set rlimit\n"
        "   , --enable-probe-server                Enable probe server\n"
        "   , --probe-server-port                  Set probe server port\n"
        "\n"
-       "BACKEND       := { kprobe, ftrace, kprobe-multi }\n"
+       "BACKEND       := { kprobe, ftrace, kprobe-multi, hybrid }\n"
        "OUTPUT-FORMAT := { aggregate, json }\n"
-       "TRACER-TYPE   := { function, function_graph (experimental) }\n"
+       "TRACER-TYPE   := { function, function_graph (experimental), count }\n"
+       "TRANSPORT     := { perf, ringbuf }\n"
        "\n");
 }
 
@@ -82,6 +144,18 @@ opt_init(struct ipft_tracer_opt *opt)
   opt->perf_page_cnt = 8;
   opt->perf_sample_period = 1;
   opt->perf_wakeup_events = 1;
+  opt->transport = IPFT_TRANSPORT_UNSPEC;
+  opt->ringbuf_page_cnt = 256;
+  opt->nr_consumers = 1;
+  opt->nr_attach_threads = 0;
+  opt->consolidate = false;
+  opt->symsdb_cache = true;
+  opt->link_cache = true;
+  opt->failure_cache = true;
+  opt->only_dropped = false;
+  opt->track_skb = false;
+  opt->lineage = false;
+  memset(&opt->filter, 0, sizeof(opt->filter));
   opt->regex = NULL;
   opt->script = NULL;
   opt->tracer = IPFT_TRACER_FUNCTION;
@@ -103,6 +177,18 @@ opt_dump(struct ipft_tracer_opt *opt)
   INFO("perf_page_cnt      : %zu\n", opt->perf_page_cnt);
   INFO("perf_sample_period : %zu\n", opt->perf_sample_period);
   INFO("perf_wakeup_events : %u\n", opt->perf_wakeup_events);
+  INFO("transport          : %s\n", get_transport_name_by_id(opt->transport));
+  INFO("ringbuf_page_cnt   : %zu\n", opt->ringbuf_page_cnt);
+  INFO("consumer_threads   : %d\n", opt->nr_consumers);
+  INFO("attach_threads     : %d\n", opt->nr_attach_threads);
+  INFO("consolidate        : %s\n", opt->consolidate ? "true" : "false");
+  INFO("only_dropped       : %s\n", opt->only_dropped ? "true" : "false");
+  INFO("track_skb          : %s\n", opt->track_skb ? "true" : "false");
+  INFO("lineage            : %s\n", opt->lineage ? "true" : "false");
+  filter_dump(&opt->filter);
+  INFO("symsdb_cache       : %s\n", opt->symsdb_cache ? "true" : "false");
+  INFO("link_cache         : %s\n", opt->link_cache ? "true" : "false");
+  INFO("failure_cache      : %s\n", opt->failure_cache ? "true" : "false");
   if (opt->enable_probe_server) {
     INFO("probe_server_port  : %u\n", opt->probe_server_port);
   }
@@ -194,6 +280,7 @@ main(int argc, char **argv)
   struct ipft_tracer_opt opt;
   bool list = false;
   bool set_rlimit = true;
+  bool mark_given = false;
 
   opt_init(&opt);
 
@@ -213,6 +300,7 @@ main(int argc, char **argv)
       break;
     case 'm':
       opt.mark = strtoul(optarg, NULL, 0);
+      mark_given = true;
       break;
     case 'o':
       opt.output = get_output_id_by_name(optarg);
@@ -244,6 +332,7 @@ main(int argc, char **argv)
 
       if (strcmp(optname, "mask") == 0) {
         opt.mask = strtoul(optarg, NULL, 0);
+        mark_given = true;
         break;
       }
 
@@ -262,6 +351,76 @@ main(int argc, char **argv)
         break;
       }
 
+      if (strcmp(optname, "transport") == 0) {
+        opt.transport = get_transport_id_by_name(optarg);
+        if (opt.transport == IPFT_TRANSPORT_UNSPEC) {
+          ERROR("Unknown transport %s\n", optarg);
+          usage();
+          goto end;
+        }
+        break;
+      }
+
+      if (strcmp(optname, "ringbuf-page-count") == 0) {
+        opt.ringbuf_page_cnt = strtoull(optarg, NULL, 10);
+        break;
+      }
+
+      if (strcmp(optname, "consumer-threads") == 0) {
+        opt.nr_consumers = atoi(optarg);
+        break;
+      }
+
+      if (strcmp(optname, "attach-threads") == 0) {
+        opt.nr_attach_threads = atoi(optarg);
+        break;
+      }
+
+      if (strcmp(optname, "consolidate") == 0) {
+        opt.consolidate = true;
+        break;
+      }
+
+      if (strcmp(optname, "only-dropped") == 0) {
+        opt.only_dropped = true;
+        break;
+      }
+
+      if (strcmp(optname, "track-skb") == 0) {
+        opt.track_skb = true;
+        break;
+      }
+
+      if (filter_has_option(optname)) {
+        if (filter_parse(&opt.filter, optname, optarg) == -1) {
+          usage();
+          goto end;
+        }
+        break;
+      }
+
+      /* The clones are followed through the tracked set */
+      if (strcmp(optname, "lineage") == 0) {
+        opt.lineage = true;
+        opt.track_skb = true;
+        break;
+      }
+
+      if (strcmp(optname, "no-symsdb-cache") == 0) {
+        opt.symsdb_cache = false;
+        break;
+      }
+
+      if (strcmp(optname, "no-link-cache") == 0) {
+        opt.link_cache = false;
+        break;
+      }
+
+      if (strcmp(optname, "no-failure-cache") == 0) {
+        opt.failure_cache = false;
+        break;
+      }
+
       if (strcmp(optname, "no-set-rlimit") == 0) {
         set_rlimit = false;
         break;
@@ -301,6 +460,23 @@ main(int argc, char **argv)
     }
   }
 
+  if (opt.transport == IPFT_TRANSPORT_UNSPEC) {
+    /* Only perf buffer has multiple rings to share among the consumers */
+    if (opt.nr_consumers > 1) {
+      opt.transport = IPFT_TRANSPORT_PERF;
+    } else {
+      opt.transport = select_transport();
+    }
+  }
+
+  /*
+   * The filters select the packets by themselves. Don't narrow them
+   * down to the unmarked ones unless the mark or the mask is given.
+   */
+  if (!mark_given && filter_is_set(&opt.filter)) {
+    opt.mask = 0;
+  }
+
   if (list) {
     error = list_functions(&opt);
     goto end;
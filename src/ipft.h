@@ -25,10 +25,30 @@
  */
 #define MAX_RECURSE_LEVEL 8
 
+/*
+ * Directory to store the on-disk caches
+ */
+#define IPFT_CACHE_DIR "/var/cache/ipft"
+
+/*
+ * Initial value of hash_update (FNV-1a offset basis)
+ */
+#define HASH_INIT 0xcbf29ce484222325ULL
+
+#define SHA256_DIGEST_SIZE 32
+
+struct sha256_ctx {
+  uint32_t h[8];
+  uint64_t len;
+  uint8_t buf[64];
+};
+
 struct ipft_symsdb;
 struct ipft_regex;
 struct ipft_script;
 struct ipft_tracer;
+struct ipft_top;
+struct ipft_exclude;
 
 extern bool verbose;
 
@@ -56,6 +76,7 @@ enum ipft_tracers {
   IPFT_TRACER_UNSPEC,
   IPFT_TRACER_FUNCTION,
   IPFT_TRACER_FUNCTION_GRAPH,
+  IPFT_TRACER_COUNT,
 };
 
 enum ipft_backends {
@@ -63,6 +84,7 @@ enum ipft_backends {
   IPFT_BACKEND_KPROBE,
   IPFT_BACKEND_FTRACE,
   IPFT_BACKEND_KPROBE_MULTI,
+  IPFT_BACKEND_HYBRID,
 };
 
 enum ipft_outputs {
@@ -82,6 +104,19 @@ struct ipft_tracer_opt {
   size_t perf_page_cnt;
   uint64_t perf_sample_period;
   uint32_t perf_wakeup_events;
+  enum ipft_transports transport;
+  size_t ringbuf_page_cnt;
+  int nr_consumers;
+  /* Number of threads to attach programs. 0 means online CPUs. */
+  int nr_attach_threads;
+  bool consolidate;
+  bool only_dropped;
+  bool track_skb;
+  bool lineage;
+  struct ipft_filter filter;
+  bool symsdb_cache;
+  bool link_cache;
+  bool failure_cache;
   bool enable_probe_server;
   uint16_t probe_server_port;
 };
@@ -89,9 +124,13 @@ struct ipft_tracer_opt {
 struct ipft_symsdb_opt {
   int max_args;
   int max_skb_pos;
+  /* Name of the on-disk cache. NULL disables the cache. */
+  const char *cache_name;
 };
 
 struct ipft_sym {
+  /* Dense id of the function. Index of the symbol database. */
+  uint32_t id;
   uint64_t addr;
   char *symname;
   uint32_t btf_fd;
@@ -103,6 +142,11 @@ struct ipft_output {
   struct ipft_symsdb *sdb;
   struct ipft_script *script;
   int (*on_event)(struct ipft_output *, struct ipft_event *);
+  /* Optional. Takes the whole trace of a packet consolidated in kernel. */
+  int (*on_packet)(struct ipft_output *, struct ipft_event *, uint32_t,
+                   uint32_t, bool);
+  /* Optional. Takes the skb created from the skb of the parent id. */
+  int (*on_lineage)(struct ipft_output *, struct ipft_event *, uint64_t);
   int (*post_trace)(struct ipft_output *);
 };
 
@@ -111,13 +155,19 @@ const char *get_tracer_name_by_id(enum ipft_tracers tracer);
 enum ipft_backends get_backend_id_by_name(const char *name);
 const char *get_backend_name_by_id(enum ipft_backends backend);
 enum ipft_backends select_backend_for_tracer(enum ipft_tracers tracer);
+enum ipft_transports get_transport_id_by_name(const char *name);
+const char *get_transport_name_by_id(enum ipft_transports transport);
+enum ipft_transports select_transport(void);
 int get_max_args_for_backend(enum ipft_backends backend);
 int get_max_skb_pos_for_backend(enum ipft_backends backend);
 
 int symsdb_create(struct ipft_symsdb **sdbp, struct ipft_symsdb_opt *opt);
-int symsdb_get_symname_by_addr(struct ipft_symsdb *sdb, uint64_t addr,
-                               char **symnamep);
-struct ipft_sym **symsdb_get_syms_by_pos(struct ipft_symsdb *sdb, int pos);
+uint32_t symsdb_get_funcs_total(struct ipft_symsdb *sdb);
+int symsdb_get_symname_by_id(struct ipft_symsdb *sdb, uint32_t id,
+                             char **symnamep);
+int symsdb_get_id_by_symname(struct ipft_symsdb *sdb, const char *symname,
+                             uint32_t *idp);
+struct ipft_sym *symsdb_get_syms_by_pos(struct ipft_symsdb *sdb, int pos);
 int symsdb_get_syms_total(struct ipft_symsdb *sdb);
 int symsdb_get_syms_total_by_pos(struct ipft_symsdb *sdb, int pos);
 
@@ -139,10 +189,39 @@ int output_create(struct ipft_output **outp, enum ipft_outputs output,
 int aggregate_output_create(struct ipft_output **outp);
 int json_output_create(struct ipft_output **outp);
 int output_on_trace(struct ipft_output *out, struct ipft_event *e);
+int output_on_packet(struct ipft_output *out, struct ipft_event *events,
+                     uint32_t count, uint32_t ntruncated, bool dropped);
+int output_on_lineage(struct ipft_output *out, struct ipft_event *e,
+                      uint64_t parent_id);
 int output_post_trace(struct ipft_output *out);
 
+int top_create(struct ipft_top **topp, struct ipft_symsdb *sdb, int map_fd,
+               uint32_t nfuncs, int ncpus);
+int top_update(struct ipft_top *top);
+
+int exclude_create(struct ipft_exclude **exp, enum ipft_backends backend,
+                   bool use_cache);
+bool exclude_match(struct ipft_exclude *ex, struct ipft_sym *sym);
+void exclude_add_failed(struct ipft_exclude *ex, struct ipft_sym *sym,
+                        int error);
+int exclude_store(struct ipft_exclude *ex);
+
+bool filter_has_option(const char *name);
+int filter_parse(struct ipft_filter *f, const char *name, const char *value);
+bool filter_is_set(struct ipft_filter *f);
+void filter_dump(struct ipft_filter *f);
+
 int tracer_create(struct ipft_tracer **tp, struct ipft_tracer_opt *opt);
 int tracer_run(struct ipft_tracer *t);
 int list_functions(struct ipft_tracer_opt *opt);
 int probe_kprobe_multi(void);
+int probe_ringbuf(void);
+int probe_kprobe_cookie(void);
 char *libbpf_error_string(int error);
+void hash_update(uint64_t *h, const void *buf, size_t len);
+void sha256_init(struct sha256_ctx *c);
+void sha256_update(struct sha256_ctx *c, const void *buf, size_t len);
+void sha256_final(struct sha256_ctx *c, uint8_t *digest);
+int cache_dir_create(void);
+int cache_open(const char *path);
+int write_all(int fd, const void *buf, size_t len);
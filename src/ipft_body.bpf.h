@@ -1,24 +1,126 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <linux/types.h>
+#include <linux/ptrace.h>
 #include <uapi/linux/bpf.h>
 
 #include <bpf/bpf_helpers.h>
 #include <bpf/bpf_tracing.h>
 #include <bpf/bpf_core_read.h>
+#include <bpf/bpf_endian.h>
 
 #include "ipft_common.h"
 
 #define __noinline __attribute__((noinline))
 
+/*
+ * Only the fields we read. CO-RE relocates them to the running kernel.
+ */
+struct ns_common {
+  unsigned int inum;
+};
+
+struct net {
+  struct ns_common ns;
+};
+
+struct net_device {
+  int ifindex;
+  struct {
+    struct net *net;
+  } nd_net;
+};
+
+struct kernfs_node {
+  uint64_t id;
+};
+
+struct cgroup {
+  struct kernfs_node *kn;
+};
+
+struct sock_cgroup_data {
+  struct cgroup *cgroup;
+};
+
+struct sock_common {
+  struct {
+    struct net *net;
+  } skc_net;
+};
+
+struct sock {
+  struct sock_common __sk_common;
+  struct sock_cgroup_data sk_cgrp_data;
+};
+
 struct sk_buff {
+  struct sk_buff *next;
+  struct sock *sk;
+  struct net_device *dev;
   uint32_t mark;
+  uint16_t protocol;
+  uint16_t transport_header;
+  uint16_t network_header;
+  unsigned char *head;
+  struct {
+    struct {
+      int counter;
+    } refs;
+  } users;
 };
 
-static uint64_t get_func_ip(void *ctx);
+struct iphdr {
+  uint8_t ver_ihl;
+  uint8_t tos;
+  uint16_t tot_len;
+  uint16_t id;
+  uint16_t frag_off;
+  uint8_t ttl;
+  uint8_t protocol;
+  uint16_t check;
+  uint32_t saddr;
+  uint32_t daddr;
+};
 
-extern int module(void *ctx, struct sk_buff *skb, uint8_t data[64]);
+struct ipv6hdr {
+  uint32_t ver_tc_flow;
+  uint16_t payload_len;
+  uint8_t nexthdr;
+  uint8_t hop_limit;
+  uint32_t saddr[4];
+  uint32_t daddr[4];
+};
+
+#define IP_OFFSET 0x1fff
+#define ETH_P_IP 0x0800
+#define ETH_P_IPV6 0x86dd
+#define IPPROTO_TCP 6
+#define IPPROTO_UDP 17
+#define IPPROTO_SCTP 132
+
+/*
+ * Index of the traced function in the symbol database. Each backend
+ * takes it from the attach cookie or looks it up with lookup_func_id.
+ */
+static uint32_t get_func_id(void *ctx);
+
+#ifdef IPFT_NULL_MODULE
+/*
+ * Built-in module used when the script is not given. The object built
+ * with it doesn't need linking at runtime.
+ */
+static __inline int
+module(void *ctx, struct sk_buff *skb, uint8_t data[IPFT_MODULE_DATA_SIZE])
+{
+  return 0;
+}
+#else
+extern int module(void *ctx, struct sk_buff *skb,
+                  uint8_t data[IPFT_MODULE_DATA_SIZE]);
+#endif
 
 struct {
   __uint(type, BPF_MAP_TYPE_PERF_EVENT_ARRAY);
@@ -26,46 +128,1009 @@ struct {
   __uint(value_size, sizeof(uint32_t));
 } events SEC(".maps");
 
+struct {
+  __uint(type, BPF_MAP_TYPE_PERCPU_ARRAY);
+  __uint(max_entries, 1);
+  __type(key, uint32_t);
+  __type(value, struct ipft_cpu_stat);
+} cpu_stats SEC(".maps");
+
+/*
+ * The size is overridden by the user space before loading. When the
+ * kernel doesn't support BPF ring buffer, the user space replaces this
+ * map with a dummy array and the code using it is eliminated by CO-RE.
+ */
+struct {
+  __uint(type, BPF_MAP_TYPE_RINGBUF);
+  __uint(max_entries, 4096);
+} events_ringbuf SEC(".maps");
+
+/*
+ * Set by the user space before loading. It is read-only for the BPF
+ * programs, so the verifier sees the values as constants and prunes
+ * the branches for the unused features. No map lookup is needed to
+ * read it either. It has its own section to keep it apart from the
+ * read-only data of the module.
+ */
+const volatile struct ipft_trace_config ipft_config SEC(".rodata.config") = {};
+
+/*
+ * Packet traces being consolidated keyed by packet_id. The user space
+ * shrinks this map when the consolidation is disabled.
+ */
+struct {
+  __uint(type, BPF_MAP_TYPE_LRU_HASH);
+  __uint(max_entries, 8192);
+  __type(key, uint64_t);
+  __type(value, struct ipft_packet_trace);
+} packet_traces SEC(".maps");
+
+/*
+ * Zero-filled initial value of the packet_traces. It is too large
+ * to build it on the stack.
+ */
 struct {
   __uint(type, BPF_MAP_TYPE_ARRAY);
   __uint(max_entries, 1);
   __type(key, uint32_t);
-  __type(value, struct ipft_trace_config);
-} config SEC(".maps");
+  __type(value, struct ipft_packet_trace);
+} packet_trace_init SEC(".maps");
+
+/*
+ * The skbs being freed by each thread. The free functions call each
+ * other (e.g. consume_skb calls __kfree_skb), so only the return of
+ * the outermost one ends the packet. Another skb can be freed in the
+ * middle by the softirq on the same thread, hence the stack. The user
+ * space shrinks this map when nothing needs the end of the packet.
+ */
+#define SKB_FREE_MAX_NEST 4
+
+struct skb_free_frame {
+  uint64_t skb;
+  uint32_t depth;
+  uint8_t dropped;
+  uint8_t last;
+  uint8_t _pad[2];
+};
+
+struct skb_free_stack {
+  uint32_t top;
+  uint32_t _pad;
+  struct skb_free_frame frames[SKB_FREE_MAX_NEST];
+};
+
+struct {
+  __uint(type, BPF_MAP_TYPE_LRU_HASH);
+  __uint(max_entries, 8192);
+  __type(key, uint64_t);
+  __type(value, struct skb_free_stack);
+} skb_free_stacks SEC(".maps");
+
+/*
+ * skbs matched once and still alive. With IPFT_TRACE_F_TRACK_SKB, the
+ * packets in this set are traced without looking at the skb again
+ * and are removed when they are freed. The user space shrinks this
+ * map when the tracking is disabled.
+ */
+struct {
+  __uint(type, BPF_MAP_TYPE_LRU_HASH);
+  __uint(max_entries, 8192);
+  __type(key, uint64_t);
+  __type(value, uint8_t);
+} tracked_skbs SEC(".maps");
+
+/*
+ * Parent skb seen at the entry of the functions creating a new skb,
+ * keyed by the thread and the function, for the return probes. The
+ * user space shrinks this map when the lineage is not followed.
+ */
+struct lineage_stash_key {
+  uint64_t pid_tgid;
+  uint32_t func;
+  uint32_t _pad;
+};
+
+struct {
+  __uint(type, BPF_MAP_TYPE_LRU_HASH);
+  __uint(max_entries, 8192);
+  __type(key, struct lineage_stash_key);
+  __type(value, uint64_t);
+} lineage_stash SEC(".maps");
+
+/*
+ * Function address to the function id. Only used when the attach
+ * cookie is unavailable. The user space sizes and fills this map.
+ */
+struct {
+  __uint(type, BPF_MAP_TYPE_HASH);
+  __uint(max_entries, 1);
+  __type(key, uint64_t);
+  __type(value, uint32_t);
+} func_ids SEC(".maps");
+
+/*
+ * Hit counters of the count tracer indexed by
+ * (processor id * nfuncs + function id). Each CPU owns a contiguous
+ * slice, so the atomic increments don't bounce the cache lines among
+ * the CPUs. The user space sizes it and makes it mmapable to read it
+ * without system calls.
+ */
+struct {
+  __uint(type, BPF_MAP_TYPE_ARRAY);
+  __uint(max_entries, 1);
+  __type(key, uint32_t);
+  __type(value, uint64_t);
+} func_hits SEC(".maps");
+
+/*
+ * Slow path of get_func_id. UINT32_MAX when the function is unknown.
+ */
+static __inline uint32_t
+lookup_func_id(uint64_t faddr)
+{
+  uint32_t *id;
+
+  id = bpf_map_lookup_elem(&func_ids, &faddr);
+  if (id == NULL) {
+    return UINT32_MAX;
+  }
+
+  return *id;
+}
+
+#ifdef IPFT_STASH_SKB
+/*
+ * skb seen at the function entry, keyed by the thread and the function.
+ * The return probes cannot read the arguments, so they take the skb
+ * from here. The user space shrinks this map when it is unused.
+ */
+struct skb_stash_key {
+  uint64_t pid_tgid;
+  uint32_t func_id;
+  uint32_t _pad;
+};
+
+struct {
+  __uint(type, BPF_MAP_TYPE_LRU_HASH);
+  __uint(max_entries, 8192);
+  __type(key, struct skb_stash_key);
+  __type(value, uint64_t);
+} skb_stash SEC(".maps");
+
+static __inline void
+stash_skb(void *ctx, struct sk_buff *skb)
+{
+  uint64_t val = (uint64_t)skb;
+  struct skb_stash_key key = {
+      .pid_tgid = bpf_get_current_pid_tgid(),
+      .func_id = get_func_id(ctx),
+  };
+
+  bpf_map_update_elem(&skb_stash, &key, &val, BPF_ANY);
+}
+
+/*
+ * Take the skb saved at the entry. NULL when the entry didn't match.
+ * The entry of the recursive call overwrites the outer one, so the
+ * return of the outer call is not traced.
+ */
+static __inline struct sk_buff *
+unstash_skb(void *ctx)
+{
+  uint64_t *val, skb;
+  struct skb_stash_key key = {
+      .pid_tgid = bpf_get_current_pid_tgid(),
+      .func_id = get_func_id(ctx),
+  };
+
+  val = bpf_map_lookup_elem(&skb_stash, &key);
+  if (val == NULL) {
+    return NULL;
+  }
+
+  skb = *val;
+
+  bpf_map_delete_elem(&skb_stash, &key);
+
+  return (struct sk_buff *)skb;
+}
+#endif
+
+/*
+ * Event with the room for the module data. Only the header is sent
+ * when no module is linked. The data is written through the flexible
+ * array of the header.
+ */
+union ipft_event_buf {
+  struct ipft_event e;
+  uint8_t raw[sizeof(struct ipft_event) + IPFT_MODULE_DATA_SIZE];
+};
+
+static __inline void
+fill_event(void *ctx, struct sk_buff *skb, uint8_t is_return,
+           struct ipft_event *e)
+{
+  e->packet_id = (uint64_t)skb;
+  e->tstamp = bpf_ktime_get_ns();
+  e->func_id = get_func_id(ctx);
+  e->processor_id = bpf_get_smp_processor_id();
+  e->type = is_return ? IPFT_EVENT_RETURN : IPFT_EVENT_ENTRY;
+}
+
+static __inline struct ipft_cpu_stat *
+get_cpu_stat(void)
+{
+  uint32_t idx = 0;
+  return bpf_map_lookup_elem(&cpu_stats, &idx);
+}
 
 static __inline int
-ipft_body(void *ctx, struct sk_buff *skb, uint8_t is_return)
+emit_perf(void *ctx, struct sk_buff *skb, uint8_t is_return,
+          const volatile struct ipft_trace_config *conf)
 {
   int error;
-  uint32_t mark;
-  uint32_t idx = 0;
-  struct ipft_event e = {0};
-  struct ipft_trace_config *conf;
+  struct ipft_cpu_stat *stat;
+  union ipft_event_buf buf;
+
+  stat = get_cpu_stat();
+  if (stat == NULL) {
+    return 0;
+  }
+
+  __builtin_memset(&buf, 0, sizeof(buf));
+
+  fill_event(ctx, skb, is_return, &buf.e);
+
+  if (conf->data_len != 0) {
+    error = module(ctx, skb, buf.e.data);
+    if (error != 0) {
+      return 0;
+    }
+    buf.e.data_len = IPFT_MODULE_DATA_SIZE;
+  }
+
+  /*
+   * Loss of the perf event is reported to the user space with
+   * PERF_RECORD_LOST, so we only need to number the events.
+   */
+  buf.e.seq = ++stat->seq;
+
+  bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &buf,
+                        sizeof(buf.e) + buf.e.data_len);
+
+  return 0;
+}
+
+/*
+ * Build the event directly on the ring buffer memory. Unlike perf
+ * buffer, no intermediate copy on the BPF stack is needed. The size
+ * of the reservation must be a constant, so the events with and
+ * without the module data take the separate paths.
+ */
+static __inline int
+emit_ringbuf(void *ctx, struct sk_buff *skb, uint8_t is_return,
+             const volatile struct ipft_trace_config *conf)
+{
+  int error;
+  struct ipft_event *e;
+  struct ipft_cpu_stat *stat;
+  union ipft_event_buf *buf;
+
+  stat = get_cpu_stat();
+  if (stat == NULL) {
+    return 0;
+  }
+
+  if (conf->data_len == 0) {
+    e = bpf_ringbuf_reserve(&events_ringbuf, sizeof(*e), 0);
+    if (e == NULL) {
+      goto lost;
+    }
+
+    __builtin_memset(e, 0, sizeof(*e));
+
+    fill_event(ctx, skb, is_return, e);
+
+    e->seq = ++stat->seq;
+
+    bpf_ringbuf_submit(e, 0);
+
+    return 0;
+  }
+
+  buf = bpf_ringbuf_reserve(&events_ringbuf, sizeof(*buf), 0);
+  if (buf == NULL) {
+    goto lost;
+  }
+
+  __builtin_memset(buf, 0, sizeof(*buf));
+
+  fill_event(ctx, skb, is_return, &buf->e);
+
+  error = module(ctx, skb, buf->e.data);
+  if (error != 0) {
+    bpf_ringbuf_discard(buf, 0);
+    return 0;
+  }
+
+  buf->e.data_len = IPFT_MODULE_DATA_SIZE;
+  buf->e.seq = ++stat->seq;
+
+  bpf_ringbuf_submit(buf, 0);
+
+  return 0;
+
+lost:
+  /* Consume the sequence number to make the loss visible */
+  stat->seq++;
+  stat->lost++;
+  return 0;
+}
+
+static __inline void
+emit_packet_trace(void *ctx, struct ipft_packet_trace *rec,
+                  const volatile struct ipft_trace_config *conf)
+{
+  uint64_t size;
+  struct ipft_cpu_stat *stat;
+  uint32_t n = rec->nentries;
+
+  if (n > IPFT_PACKET_TRACE_MAX_ENTRIES) {
+    return;
+  }
+
+  size = __builtin_offsetof(struct ipft_packet_trace, entries) +
+         n * sizeof(rec->entries[0]);
+
+  if (bpf_core_enum_value_exists(enum bpf_func_id, BPF_FUNC_ringbuf_reserve) &&
+      conf->transport == IPFT_TRANSPORT_RINGBUF) {
+    if (bpf_ringbuf_output(&events_ringbuf, rec, size, 0) != 0) {
+      stat = get_cpu_stat();
+      if (stat != NULL) {
+        stat->lost++;
+      }
+    }
+    return;
+  }
+
+  bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, rec, size);
+}
+
+/*
+ * Append the function call to the packet's trace and send the whole
+ * trace at once when the packet is freed. The same skb is rarely
+ * processed on the multiple CPUs at the same time, so we don't care
+ * about the races.
+ */
+static __inline int
+consolidate(void *ctx, struct sk_buff *skb, uint8_t is_return,
+            const volatile struct ipft_trace_config *conf)
+{
+  uint64_t now, delta;
+  uint32_t n, func_id, idx = 0;
+  uint64_t packet_id = (uint64_t)skb;
+  struct ipft_packet_trace_entry *ent;
+  struct ipft_packet_trace *rec, *init;
+
+  now = bpf_ktime_get_ns();
+  func_id = get_func_id(ctx);
+
+  rec = bpf_map_lookup_elem(&packet_traces, &packet_id);
+  if (rec == NULL) {
+    /*
+     * The trace only starts from the function entry. Otherwise, the
+     * returns of the callers after the free start a bogus trace.
+     */
+    if (is_return) {
+      return 0;
+    }
+
+    init = bpf_map_lookup_elem(&packet_trace_init, &idx);
+    if (init == NULL) {
+      return 0;
+    }
+
+    bpf_map_update_elem(&packet_traces, &packet_id, init, BPF_NOEXIST);
+
+    rec = bpf_map_lookup_elem(&packet_traces, &packet_id);
+    if (rec == NULL) {
+      return 0;
+    }
+
+    rec->packet_id = packet_id;
+    rec->tstamp = now;
+  }
+
+  n = rec->nentries;
+  if (n < IPFT_PACKET_TRACE_MAX_ENTRIES) {
+    ent = &rec->entries[n & (IPFT_PACKET_TRACE_MAX_ENTRIES - 1)];
+    delta = now - rec->tstamp;
+    ent->func_id = func_id;
+    ent->tstamp_delta = delta > UINT32_MAX ? UINT32_MAX : delta;
+    ent->processor_id = bpf_get_smp_processor_id();
+    ent->is_return = is_return;
+    rec->nentries = n + 1;
+  } else {
+    rec->ntruncated++;
+  }
 
-  conf = bpf_map_lookup_elem(&config, &idx);
-  if (conf == NULL) {
+  /* The trace is sent by free_return at the end of the packet */
+  return 0;
+}
+
+static __inline int
+count_hit(void *ctx, uint8_t is_return,
+          const volatile struct ipft_trace_config *conf)
+{
+  uint64_t *hits;
+  uint32_t id, idx;
+
+  if (is_return) {
     return 0;
   }
 
+  id = get_func_id(ctx);
+  if (id >= conf->nfuncs) {
+    return 0;
+  }
+
+  idx = bpf_get_smp_processor_id() * conf->nfuncs + id;
+
+  hits = bpf_map_lookup_elem(&func_hits, &idx);
+  if (hits == NULL) {
+    return 0;
+  }
+
+  /*
+   * Only this CPU writes to the slot, but the program may be preempted
+   * by another one hitting the same function on this CPU
+   */
+  __sync_fetch_and_add(hits, 1);
+
+  return 0;
+}
+
+/*
+ * The device is not set yet on the early transmit path. Take the
+ * namespace of the socket in that case.
+ */
+static __inline uint32_t
+get_netns(struct sk_buff *skb)
+{
+  struct net *net;
+
+  net = BPF_CORE_READ(skb, dev, nd_net.net);
+  if (net == NULL) {
+    net = BPF_CORE_READ(skb, sk, __sk_common.skc_net.net);
+  }
+
+  return BPF_CORE_READ(net, ns.inum);
+}
+
+/*
+ * Older kernels (< v5.15) encode the cgroup in sock_cgroup_data and
+ * never match
+ */
+static __inline uint64_t
+get_cgroup_id(struct sk_buff *skb)
+{
+  struct sock *sk = BPF_CORE_READ(skb, sk);
+
+  if (sk == NULL || !bpf_core_field_exists(sk->sk_cgrp_data.cgroup)) {
+    return 0;
+  }
+
+  return BPF_CORE_READ(sk, sk_cgrp_data.cgroup, kn, id);
+}
+
+static __inline bool
+addr_match(const volatile uint32_t *want, uint32_t *addr, bool inet6)
+{
+  if (!inet6) {
+    return want[0] == addr[0];
+  }
+
+  return want[0] == addr[0] && want[1] == addr[1] && want[2] == addr[2] &&
+         want[3] == addr[3];
+}
+
+/*
+ * Match the IP and the L4 headers. The headers are located with the
+ * offsets in the skb, so the packets are not matched before the
+ * network header is set. The IPv6 extension headers are not followed.
+ */
+static __inline bool
+tuple_match(struct sk_buff *skb, uint16_t protocol,
+            const volatile struct ipft_filter *f)
+{
+  bool inet6, frag = false;
+  uint16_t ports[2];
+  struct iphdr iph;
+  struct ipv6hdr ip6h;
+  uint8_t l4_protocol;
+  uint32_t saddr[4] = {0}, daddr[4] = {0};
+  unsigned char *head = BPF_CORE_READ(skb, head);
+  uint32_t off = BPF_CORE_READ(skb, network_header);
+
+  /* Not set yet. The offset points to nowhere. */
+  if (off == (uint16_t)~0U) {
+    return false;
+  }
+
+  if (protocol == bpf_htons(ETH_P_IP)) {
+    if (bpf_probe_read_kernel(&iph, sizeof(iph), head + off) != 0 ||
+        (iph.ver_ihl >> 4) != 4) {
+      return false;
+    }
+    inet6 = false;
+    saddr[0] = iph.saddr;
+    daddr[0] = iph.daddr;
+    l4_protocol = iph.protocol;
+    frag = (bpf_ntohs(iph.frag_off) & IP_OFFSET) != 0;
+    off += (iph.ver_ihl & 0xf) * 4;
+  } else if (protocol == bpf_htons(ETH_P_IPV6)) {
+    if (bpf_probe_read_kernel(&ip6h, sizeof(ip6h), head + off) != 0 ||
+        (bpf_ntohl(ip6h.ver_tc_flow) >> 28) != 6) {
+      return false;
+    }
+    inet6 = true;
+    __builtin_memcpy(saddr, ip6h.saddr, sizeof(saddr));
+    __builtin_memcpy(daddr, ip6h.daddr, sizeof(daddr));
+    l4_protocol = ip6h.nexthdr;
+    off += sizeof(ip6h);
+  } else {
+    return false;
+  }
+
+  if (f->flags & (IPFT_FILTER_F_SADDR | IPFT_FILTER_F_DADDR)) {
+    if (inet6 != !!(f->flags & IPFT_FILTER_F_INET6)) {
+      return false;
+    }
+
+    if ((f->flags & IPFT_FILTER_F_SADDR) &&
+        !addr_match(f->saddr, saddr, inet6)) {
+      return false;
+    }
+
+    if ((f->flags & IPFT_FILTER_F_DADDR) &&
+        !addr_match(f->daddr, daddr, inet6)) {
+      return false;
+    }
+  }
+
+  if (f->l4_protocol != 0 && l4_protocol != f->l4_protocol) {
+    return false;
+  }
+
+  if (f->sport == 0 && f->dport == 0) {
+    return true;
+  }
+
+  if (l4_protocol != IPPROTO_TCP && l4_protocol != IPPROTO_UDP &&
+      l4_protocol != IPPROTO_SCTP) {
+    return false;
+  }
+
+  /* Only the first fragment has the L4 header */
+  if (frag) {
+    return false;
+  }
+
+  /* Source and destination ports lead all of them */
+  if (bpf_probe_read_kernel(ports, sizeof(ports), head + off) != 0) {
+    return false;
+  }
+
+  return (f->sport == 0 || ports[0] == f->sport) &&
+         (f->dport == 0 || ports[1] == f->dport);
+}
+
+/*
+ * The filters are constants after loading, so the verifier removes
+ * the checks for the filters not in use
+ */
+static __inline bool
+filter_match(struct sk_buff *skb, const volatile struct ipft_filter *f)
+{
+  bool tuple;
+  uint16_t protocol;
+
+  if (f->ifindex != 0 && BPF_CORE_READ(skb, dev, ifindex) != f->ifindex) {
+    return false;
+  }
+
+  if (f->netns != 0 && get_netns(skb) != f->netns) {
+    return false;
+  }
+
+  if (f->cgroup_id != 0 && get_cgroup_id(skb) != f->cgroup_id) {
+    return false;
+  }
+
+  tuple = f->flags != 0 || f->l4_protocol != 0 || f->sport != 0 ||
+          f->dport != 0;
+  if (f->protocol == 0 && !tuple) {
+    return true;
+  }
+
+  protocol = BPF_CORE_READ(skb, protocol);
+  if (f->protocol != 0 && protocol != f->protocol) {
+    return false;
+  }
+
+  return !tuple || tuple_match(skb, protocol, f);
+}
+
+static __inline bool
+skb_match(struct sk_buff *skb, const volatile struct ipft_trace_config *conf)
+{
+  uint32_t mark;
+
   mark = BPF_CORE_READ(skb, mark);
   if ((mark & conf->mask) != (conf->mark & conf->mask)) {
+    return false;
+  }
+
+  return filter_match(skb, &conf->filter);
+}
+
+/*
+ * Only the first function seeing the skb matches it. The later ones
+ * only look it up from the tracked set, so the packet is followed
+ * even after its mark is changed. Like the consolidation, the skb is
+ * forgotten when the outermost free returns, so the nested frees
+ * don't track it again.
+ */
+static __inline bool
+track_skb(struct sk_buff *skb, uint8_t is_return,
+          const volatile struct ipft_trace_config *conf)
+{
+  uint8_t one = 1;
+  uint64_t key = (uint64_t)skb;
+
+  if (bpf_map_lookup_elem(&tracked_skbs, &key) != NULL) {
+    return true;
+  }
+
+  if (is_return || !skb_match(skb, conf)) {
+    return false;
+  }
+
+  bpf_map_update_elem(&tracked_skbs, &key, &one, BPF_ANY);
+
+  return true;
+}
+
+static __inline int
+ipft_body(void *ctx, struct sk_buff *skb, uint8_t is_return)
+{
+  const volatile struct ipft_trace_config *conf = &ipft_config;
+
+  if (conf->flags & IPFT_TRACE_F_TRACK_SKB) {
+    if (!track_skb(skb, is_return, conf)) {
+      return 0;
+    }
+  } else if (!skb_match(skb, conf)) {
     return 0;
   }
 
-  e.packet_id = (uint64_t)skb;
-  e.tstamp = bpf_ktime_get_ns();
-  e.faddr = get_func_ip(ctx);
-  e.processor_id = bpf_get_smp_processor_id();
-  e.is_return = is_return;
+#ifdef IPFT_STASH_SKB
+  if (!is_return && (conf->flags & IPFT_TRACE_F_STASH_SKB)) {
+    stash_skb(ctx, skb);
+  }
+#endif
 
-  error = module(ctx, skb, e.data);
-  if (error != 0) {
+  if (conf->flags & IPFT_TRACE_F_COUNT) {
+    return count_hit(ctx, is_return, conf);
+  }
+
+  if (conf->flags & IPFT_TRACE_F_CONSOLIDATE) {
+    return consolidate(ctx, skb, is_return, conf);
+  }
+
+  /*
+   * Both conditions are resolved at load time. On the kernels without
+   * ring buffer support, the verifier never sees this branch.
+   */
+  if (bpf_core_enum_value_exists(enum bpf_func_id, BPF_FUNC_ringbuf_reserve) &&
+      conf->transport == IPFT_TRANSPORT_RINGBUF) {
+    return emit_ringbuf(ctx, skb, is_return, conf);
+  }
+
+  return emit_perf(ctx, skb, is_return, conf);
+}
+
+/*
+ * Max number of the segments linked to the original skb
+ */
+#define LINEAGE_MAX_SEGS 64
+
+union ipft_lineage_event {
+  struct ipft_event e;
+  uint8_t raw[sizeof(struct ipft_event) + sizeof(struct ipft_lineage)];
+};
+
+/*
+ * The new skb is tracked regardless of its mark, so the trace follows
+ * the clones and the copies of the packet.
+ */
+static __inline void
+emit_lineage(void *ctx, struct sk_buff *child, uint64_t parent, uint32_t func,
+             const volatile struct ipft_trace_config *conf)
+{
+  uint8_t one = 1;
+  struct ipft_cpu_stat *stat;
+  uint64_t key = (uint64_t)child;
+  union ipft_lineage_event ev;
+  struct ipft_lineage *l = (struct ipft_lineage *)ev.e.data;
+
+  bpf_map_update_elem(&tracked_skbs, &key, &one, BPF_ANY);
+
+  stat = get_cpu_stat();
+  if (stat == NULL) {
+    return;
+  }
+
+  __builtin_memset(&ev, 0, sizeof(ev));
+
+  ev.e.packet_id = key;
+  ev.e.tstamp = bpf_ktime_get_ns();
+  ev.e.func_id = UINT32_MAX;
+  ev.e.processor_id = bpf_get_smp_processor_id();
+  ev.e.type = IPFT_EVENT_LINEAGE;
+  ev.e.data_len = sizeof(*l);
+  ev.e.seq = ++stat->seq;
+  l->parent_id = parent;
+  l->func = func;
+
+  if (bpf_core_enum_value_exists(enum bpf_func_id, BPF_FUNC_ringbuf_reserve) &&
+      conf->transport == IPFT_TRANSPORT_RINGBUF) {
+    if (bpf_ringbuf_output(&events_ringbuf, &ev, sizeof(ev), 0) != 0) {
+      stat->lost++;
+    }
+    return;
+  }
+
+  bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &ev, sizeof(ev));
+}
+
+/*
+ * Only the skb being traced is saved. It may not be tracked yet when
+ * this probe runs before the one tracing the function.
+ */
+static __inline int
+lineage_entry(struct sk_buff *skb, uint32_t func)
+{
+  uint64_t val = (uint64_t)skb;
+  const volatile struct ipft_trace_config *conf = &ipft_config;
+  struct lineage_stash_key key = {
+      .pid_tgid = bpf_get_current_pid_tgid(),
+      .func = func,
+  };
+
+  if (bpf_map_lookup_elem(&tracked_skbs, &val) == NULL &&
+      !skb_match(skb, conf)) {
+    return 0;
+  }
+
+  bpf_map_update_elem(&lineage_stash, &key, &val, BPF_ANY);
+
+  return 0;
+}
+
+/*
+ * skb_segment returns the list of the segments linked with next
+ */
+static __inline int
+lineage_return(void *ctx, struct sk_buff *child, uint32_t func)
+{
+  uint64_t *val, parent;
+  const volatile struct ipft_trace_config *conf = &ipft_config;
+  struct lineage_stash_key key = {
+      .pid_tgid = bpf_get_current_pid_tgid(),
+      .func = func,
+  };
+
+  val = bpf_map_lookup_elem(&lineage_stash, &key);
+  if (val == NULL) {
+    return 0;
+  }
+
+  parent = *val;
+
+  bpf_map_delete_elem(&lineage_stash, &key);
+
+  /* NULL or ERR_PTR */
+  if ((uint64_t)child >= (uint64_t)-4095 || child == NULL) {
+    return 0;
+  }
+
+  for (int i = 0; i < LINEAGE_MAX_SEGS; i++) {
+    emit_lineage(ctx, child, parent, func, conf);
+
+    if (func != IPFT_LINEAGE_SKB_SEGMENT) {
+      break;
+    }
+
+    child = BPF_CORE_READ(child, next);
+    if (child == NULL) {
+      break;
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * Attached by the user space only when the lineage is followed. They
+ * are kprobes on any backend, since fexit is not available on all of
+ * them and these are only a few functions.
+ */
+#define ipft_lineage(func, id)                                                 \
+  SEC("kprobe/" #func) int ipft_lineage_##func(struct pt_regs *ctx)            \
+  {                                                                            \
+    return lineage_entry((struct sk_buff *)PT_REGS_PARM1(ctx), id);            \
+  }                                                                            \
+  SEC("kretprobe/" #func) int ipft_lineage_return_##func(struct pt_regs *ctx)  \
+  {                                                                            \
+    return lineage_return(ctx, (struct sk_buff *)PT_REGS_RC(ctx), id);         \
+  }
+
+ipft_lineage(skb_clone, IPFT_LINEAGE_SKB_CLONE)
+ipft_lineage(skb_copy, IPFT_LINEAGE_SKB_COPY)
+ipft_lineage(__pskb_copy_fclone, IPFT_LINEAGE_PSKB_COPY)
+ipft_lineage(skb_copy_expand, IPFT_LINEAGE_SKB_COPY_EXPAND)
+ipft_lineage(skb_segment, IPFT_LINEAGE_SKB_SEGMENT)
+
+/*
+ * The idle threads of all CPUs have zero pid_tgid. Give them the
+ * keys no other thread has.
+ */
+static __inline uint64_t
+get_thread_key(void)
+{
+  uint64_t pid_tgid = bpf_get_current_pid_tgid();
+
+  if (pid_tgid != 0) {
+    return pid_tgid;
+  }
+
+  return UINT64_MAX - bpf_get_smp_processor_id();
+}
+
+/*
+ * The record of the packet and the tracked skb live until the
+ * outermost free returns, so the calls in the middle (e.g.
+ * skb_release_data) are appended to it instead of starting another
+ * one.
+ */
+static __inline void
+end_packet(void *ctx, uint64_t packet_id, uint8_t dropped,
+           const volatile struct ipft_trace_config *conf)
+{
+  struct ipft_packet_trace *rec;
+
+  if (conf->flags & IPFT_TRACE_F_TRACK_SKB) {
+    bpf_map_delete_elem(&tracked_skbs, &packet_id);
+  }
+
+  if (!(conf->flags & IPFT_TRACE_F_CONSOLIDATE)) {
+    return;
+  }
+
+  rec = bpf_map_lookup_elem(&packet_traces, &packet_id);
+  if (rec == NULL) {
+    return;
+  }
+
+  if (dropped || !(conf->flags & IPFT_TRACE_F_ONLY_DROPPED)) {
+    rec->dropped = dropped;
+    emit_packet_trace(ctx, rec, conf);
+  }
+
+  bpf_map_delete_elem(&packet_traces, &packet_id);
+}
+
+static __inline int
+free_entry(struct sk_buff *skb, uint8_t dropped)
+{
+  uint32_t n;
+  struct skb_free_frame *f;
+  struct skb_free_stack *st, init = {};
+  uint64_t key = get_thread_key();
+
+  st = bpf_map_lookup_elem(&skb_free_stacks, &key);
+  if (st == NULL) {
+    bpf_map_update_elem(&skb_free_stacks, &key, &init, BPF_NOEXIST);
+    st = bpf_map_lookup_elem(&skb_free_stacks, &key);
+    if (st == NULL) {
+      return 0;
+    }
+  }
+
+  n = st->top;
+
+  /* Nested free of the same skb */
+  if (n > 0 && n <= SKB_FREE_MAX_NEST) {
+    f = &st->frames[(n - 1) & (SKB_FREE_MAX_NEST - 1)];
+    if (f->skb == (uint64_t)skb) {
+      f->depth++;
+      return 0;
+    }
+  }
+
+  /* Too deep. Only keep the count to pair with the returns. */
+  if (n >= SKB_FREE_MAX_NEST) {
+    st->top = n + 1;
     return 0;
   }
 
-  bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &e, sizeof(e));
+  f = &st->frames[n & (SKB_FREE_MAX_NEST - 1)];
+  f->skb = (uint64_t)skb;
+  f->depth = 0;
+  f->dropped = dropped;
+  /* Otherwise, only dropping the reference. The skb is still alive. */
+  f->last = BPF_CORE_READ(skb, users.refs.counter) <= 1;
+  st->top = n + 1;
 
   return 0;
 }
 
+static __inline int
+free_return(void *ctx)
+{
+  uint32_t n;
+  struct skb_free_frame *f;
+  struct skb_free_stack *st;
+  uint64_t key = get_thread_key();
+  const volatile struct ipft_trace_config *conf = &ipft_config;
+
+  st = bpf_map_lookup_elem(&skb_free_stacks, &key);
+  if (st == NULL || st->top == 0) {
+    return 0;
+  }
+
+  n = st->top - 1;
+  if (n >= SKB_FREE_MAX_NEST) {
+    st->top = n;
+    return 0;
+  }
+
+  f = &st->frames[n & (SKB_FREE_MAX_NEST - 1)];
+  if (f->depth > 0) {
+    f->depth--;
+    return 0;
+  }
+
+  st->top = n;
+
+  if (f->last) {
+    end_packet(ctx, f->skb, f->dropped, conf);
+  }
+
+  return 0;
+}
+
+/*
+ * Attached by the user space only when the end of the packet is
+ * needed. Like the lineage, they are kprobes on any backend. The
+ * value tells whether the function drops the packet or not.
+ */
+#define ipft_free(func, skb, dropped)                                          \
+  SEC("kprobe/" #func) int ipft_free_##func(struct pt_regs *ctx)               \
+  {                                                                            \
+    return free_entry((struct sk_buff *)skb(ctx), dropped);                    \
+  }                                                                            \
+  SEC("kretprobe/" #func) int ipft_free_return_##func(struct pt_regs *ctx)     \
+  {                                                                            \
+    return free_return(ctx);                                                   \
+  }
+
+ipft_free(kfree_skb, PT_REGS_PARM1, 1)
+ipft_free(kfree_skb_reason, PT_REGS_PARM1, 1)
+ipft_free(sk_skb_reason_drop, PT_REGS_PARM2, 1)
+ipft_free(consume_skb, PT_REGS_PARM1, 0)
+ipft_free(napi_consume_skb, PT_REGS_PARM1, 0)
+ipft_free(__kfree_skb, PT_REGS_PARM1, 0)
+
 char LICENSE[] SEC("license") = "GPL";
@@ -1,18 +1,159 @@
 #pragma once
 #include <stdint.h>
 
+/*
+ * Size of the data buffer passed to the module
+ */
+#define IPFT_MODULE_DATA_SIZE 64
+
+enum ipft_transports {
+  IPFT_TRANSPORT_UNSPEC,
+  IPFT_TRANSPORT_PERF,
+  IPFT_TRANSPORT_RINGBUF,
+};
+
+/*
+ * Max number of function calls recorded in a consolidated packet trace
+ */
+#define IPFT_PACKET_TRACE_MAX_ENTRIES 128
+
+/*
+ * Flags for ipft_trace_config
+ */
+#define IPFT_TRACE_F_CONSOLIDATE (1U << 0)
+#define IPFT_TRACE_F_ONLY_DROPPED (1U << 1)
+#define IPFT_TRACE_F_COUNT (1U << 2)
+/* Save the skb at the entry for the return probes (kprobe-multi only) */
+#define IPFT_TRACE_F_STASH_SKB (1U << 3)
+#define IPFT_TRACE_F_TRACK_SKB (1U << 4)
+
+/*
+ * Flags for ipft_filter
+ */
+#define IPFT_FILTER_F_SADDR (1U << 0)
+#define IPFT_FILTER_F_DADDR (1U << 1)
+/* The addresses are IPv6. IPv4 address takes the first word. */
+#define IPFT_FILTER_F_INET6 (1U << 2)
+
+/*
+ * Filters on the packet metadata applied together with the mark. The
+ * zero value of each field matches any packet. The protocol, the
+ * addresses and the ports are in the network byte order.
+ */
+struct ipft_filter {
+  uint64_t cgroup_id;
+  /* Inode number of the network namespace */
+  uint32_t netns;
+  uint32_t ifindex;
+  uint32_t saddr[4];
+  uint32_t daddr[4];
+  /* Ethertype */
+  uint16_t protocol;
+  uint16_t sport;
+  uint16_t dport;
+  uint8_t l4_protocol;
+  uint8_t flags;
+};
+
+/*
+ * Configuration of the BPF programs. Placed in the read-only data and
+ * constant after loading.
+ */
 struct ipft_trace_config {
   uint32_t mark;
   uint32_t mask;
+  uint32_t transport;
+  /* Length of the module data to send. Zero when no module is linked. */
+  uint32_t data_len;
+  uint32_t flags;
+  /* Number of the function ids */
+  uint32_t nfuncs;
+  struct ipft_filter filter;
+};
+
+/*
+ * Per-CPU statistics maintained by the BPF programs
+ */
+struct ipft_cpu_stat {
+  /* Sequence number of the last event generated on this CPU */
+  uint64_t seq;
+  /* Events dropped because the ring buffer was full (ringbuf only) */
+  uint64_t lost;
+};
+
+/*
+ * Type of the event record
+ */
+enum ipft_event_types {
+  IPFT_EVENT_ENTRY,
+  IPFT_EVENT_RETURN,
+  /* New skb created from the traced one. Followed by ipft_lineage. */
+  IPFT_EVENT_LINEAGE,
+};
+
+/*
+ * Functions creating a new skb from the skb in the first argument
+ */
+enum ipft_lineage_funcs {
+  IPFT_LINEAGE_SKB_CLONE,
+  IPFT_LINEAGE_SKB_COPY,
+  IPFT_LINEAGE_PSKB_COPY,
+  IPFT_LINEAGE_SKB_COPY_EXPAND,
+  IPFT_LINEAGE_SKB_SEGMENT,
+  IPFT_LINEAGE_MAX,
 };
 
+/*
+ * Variable length event record. The module data follows the
+ * header only when the module is linked.
+ */
 struct ipft_event {
   uint64_t packet_id;
   uint64_t tstamp;
-  uint64_t faddr;
-  uint32_t processor_id;
+  /* Per-CPU sequence number. Discontinuity means lost events. */
+  uint64_t seq;
+  /* Index of the function in the symbol database */
+  uint32_t func_id;
+  uint16_t processor_id;
+  uint8_t type;
+  uint8_t data_len;
+  /* 32Bytes */
+  uint8_t data[];
+} __attribute__((aligned(8)));
+
+/*
+ * Data of the lineage event. packet_id of the event is the new skb.
+ */
+struct ipft_lineage {
+  uint64_t parent_id;
+  /* enum ipft_lineage_funcs */
+  uint32_t func;
+  uint32_t _pad;
+};
+
+/*
+ * A function call recorded in the consolidated packet trace
+ */
+struct ipft_packet_trace_entry {
+  uint32_t func_id;
+  /* Nanoseconds since the first function call. Saturates. */
+  uint32_t tstamp_delta;
+  uint16_t processor_id;
   uint8_t is_return;
-  uint8_t _pad[35]; // for future use
-  uint8_t data[64];
-  /* 128Bytes */
+  uint8_t _pad[1];
+};
+
+/*
+ * Consolidated trace of a single packet accumulated in the kernel and
+ * sent when the packet is freed. Only the used entries are sent.
+ */
+struct ipft_packet_trace {
+  uint64_t packet_id;
+  uint64_t tstamp;
+  uint16_t nentries;
+  uint8_t dropped;
+  uint8_t _pad[1];
+  /* Number of the function calls which didn't fit into the entries */
+  uint32_t ntruncated;
+  struct ipft_packet_trace_entry entries[IPFT_PACKET_TRACE_MAX_ENTRIES];
 } __attribute__((aligned(8)));
@@ -1,9 +1,13 @@
 #include "ipft_body.bpf.h"
 
-static __inline uint64_t
-get_func_ip(void *ctx)
+/*
+ * fentry/fexit support the attach cookie only on v5.19 or above and
+ * the verifier rejects the helper below that, so look up the id.
+ */
+static __inline uint32_t
+get_func_id(void *ctx)
 {
-  return bpf_get_func_ip(ctx);
+  return lookup_func_id(bpf_get_func_ip(ctx));
 }
 
 #define ipft_main(skb_pos)                                                     \
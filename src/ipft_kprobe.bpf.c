@@ -2,10 +2,20 @@
 
 #include "ipft_body.bpf.h"
 
-static __inline uint64_t
-get_func_ip(void *ctx)
+static __inline uint32_t
+get_func_id(void *ctx)
 {
-  return PT_REGS_IP((struct pt_regs *)ctx) - 1;
+  /*
+   * Resolved at load time. The kernel having the helper supports the
+   * attach cookie of kprobe as well and the user space passes the id
+   * with it. Otherwise, fall back to the address of the probe.
+   */
+  if (bpf_core_enum_value_exists(enum bpf_func_id,
+                                 BPF_FUNC_get_attach_cookie)) {
+    return bpf_get_attach_cookie(ctx);
+  }
+
+  return lookup_func_id(PT_REGS_IP((struct pt_regs *)ctx) - 1);
 }
 
 #define ipft_main(skb_pos, perm_pos)                                           \
@@ -1,15 +1,21 @@
 #include <linux/ptrace.h>
 
+/*
+ * kretprobe.multi cannot read the arguments, so the skb is saved at
+ * the entry for the function_graph tracer
+ */
+#define IPFT_STASH_SKB
+
 #include "ipft_body.bpf.h"
 
-static __inline uint64_t
-get_func_ip(void *ctx)
+/*
+ * The user space passes the function id with the cookie of each
+ * function. It is available on the return as well.
+ */
+static __inline uint32_t
+get_func_id(void *ctx)
 {
-  /*
-   * kprobe.multi program relies on the ftrace, so we cannot
-   * get function address from struct pt_regs.
-   */
-  return bpf_get_func_ip(ctx);
+  return bpf_get_attach_cookie(ctx);
 }
 
 #define ipft_main(skb_pos, parm_pos)                                           \
@@ -21,3 +27,19 @@ get_func_ip(void *ctx)
   }
 
 ipft_main(0, 1) ipft_main(1, 2) ipft_main(2, 3) ipft_main(3, 4) ipft_main(4, 5)
+
+/*
+ * Attached to the functions at all skb positions with retprobe
+ */
+SEC("kprobe.multi/ipft_main_return")
+int
+ipft_main_return(struct pt_regs *ctx)
+{
+  struct sk_buff *skb = unstash_skb(ctx);
+
+  if (skb == NULL) {
+    return 0;
+  }
+
+  return ipft_body(ctx, skb, 1);
+}
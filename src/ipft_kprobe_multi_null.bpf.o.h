@@ -0,0 +1,9068 @@
+unsigned char ipft_kprobe_multi_null_bpf_o[] = {
+  0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf7, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0x93, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x54, 0x00, 0x01, 0x00, 0xbf, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xa0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0xbc, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x6a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x25, 0x08, 0x17, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0x15, 0x08, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x07, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x55, 0x01, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xc0, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xbf, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x79, 0xa8, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x67, 0x07, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xbf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x73, 0x1a, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x8a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbf, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x09, 0xd7, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0xf0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xc8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x6b, 0x1a, 0xde, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x0a, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x6a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0xa8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x0c, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0xb4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0x91, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7b, 0x19, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xb0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x79, 0xa1, 0xa0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x05, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0xa6, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xe8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xbf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2d, 0x13, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xbf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x45, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x63, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x42, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x02, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x37, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x31, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x01, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x81, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0xe4, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x55, 0x01, 0x26, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x70, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x05, 0x23, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x07, 0x05, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x13, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6a, 0xfc, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b, 0x10, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0xb1, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x36, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x15, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x73, 0x1a, 0x98, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x8a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x06, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff,
+  0xbf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00,
+  0x98, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x06, 0x5c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x8a, 0x98, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x7b, 0x0a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x63, 0x0a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0xac, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x91, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x71, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0x98, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x8a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x09, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x06, 0xde, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0xd8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x09, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x09, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0xa0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x29, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x97, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0x07, 0x8f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0xbf, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x98, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x91, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x28, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x28, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x68, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6b, 0x79, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x15, 0x01, 0xba, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x3b, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0xbf, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x09, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x19, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7b, 0x09, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x63, 0x09, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x55, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0xbf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x91, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x3d, 0x12, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xdb, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x9a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x0a, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x9a, 0xf8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x9a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x9a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x9a, 0xe0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x9a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x9a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x9a, 0xc8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x9a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x9a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x8a, 0xa0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xa8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x63, 0x0a, 0xb8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x73, 0x6a, 0xbe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x0a, 0xbc, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x73, 0x1a, 0xbf, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0xa5, 0xbf, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xbf, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x91, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x63, 0x19, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0xbf, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x09, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x58, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x19, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x19, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x19, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7b, 0x09, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x63, 0x09, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x55, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x73, 0x19, 0x1f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x79, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b, 0x12, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0xbf, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x12, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0xa3, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x5d, 0x42, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbf, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xd8, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x61, 0xa1, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x22, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5d, 0x21, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x71, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x2a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xbf, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xd0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xd8, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xd8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xbf, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xd0, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x61, 0xa1, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x71, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xbf, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa3, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x07, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x79, 0xa1, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5d, 0x21, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x12, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x02, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x23, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x11, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x21, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x07, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x22, 0x48, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x15, 0x02, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xbf, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x69, 0xa9, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x12, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x11, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x12, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa7, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x57, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x07, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xbf, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xd8, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa7, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xbf, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xa8, 0xd8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x08, 0xe8, 0xff, 0xff, 0xff, 0x00, 0x00,
+  0xbf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x25, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xbf, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x55, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0xa1, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0xdb, 0xff, 0x40, 0x00, 0x00, 0x00, 0x69, 0xa2, 0xde, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x4a, 0xc0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0xa2, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0xa2, 0xe4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xb8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x98, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x01, 0xc0, 0xff, 0x86, 0xdd, 0x00, 0x00, 0xbf, 0x73, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xd8, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x55, 0x00, 0xb9, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0xa1, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x55, 0x01, 0xb6, 0xff,
+  0x60, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xc0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0xa2, 0xde, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xfc, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0xa2, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x98, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xf0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0xa2, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa3, 0xe4, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x95, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x55, 0x05, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x25, 0x4f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x15, 0x05, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x95, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x05, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x52, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1d, 0x20, 0x8e, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x52, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x02, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x05, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x25, 0x2c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x5d, 0x35, 0x7a, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa3, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x5d, 0x32, 0x75, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x22, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1d, 0x32, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x6d, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x92, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x02, 0x6a, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x20, 0x68, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x23, 0x4f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x15, 0x03, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x22, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1d, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x04, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x23, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa4, 0xa8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x5d, 0x43, 0x53, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa3, 0x98, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x5d, 0x32, 0x4e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x22, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1d, 0x32, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x46, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x93, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x43, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x79, 0xa3, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x32, 0x41, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x4e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x22, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xc8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x23, 0x37, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x23, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x69, 0x22, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x02, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x02, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x02, 0x01, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x55, 0x02, 0x2b, 0xff, 0x11, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x02, 0x28, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbf, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x55, 0x00, 0x20, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x12, 0x4a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x12, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xa3, 0xd0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x23, 0x19, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0x11, 0x4c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x16, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x11, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0xa2, 0xd2, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x12, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x6a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x15, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x6a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x15, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x6a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x15, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x6a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x15, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x6a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x15, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0xbf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00,
+  0xb8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x07, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x25, 0x02, 0x0a, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x61, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbf, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0x08, 0x17, 0x00, 0x03, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbf, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x73, 0x69, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x39, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x61, 0xa1, 0xac, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6d, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x69, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x63, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xb0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x07, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x25, 0x02, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5d, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x28, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xbf, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x08, 0x17, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbf, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x63, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x73, 0x69, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x39, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xac, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x61, 0xa1, 0xac, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xc7, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x69, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x63, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x16, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xb8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x0a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x07, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x07, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x07, 0x2b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x25, 0x02, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x21, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xbf, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x08, 0x17, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbf, 0x79, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x73, 0x69, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x19, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x39, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x61, 0xa1, 0xac, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x12, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x69, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x63, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0xbf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00,
+  0xb8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x07, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x25, 0x02, 0x0a, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x61, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbf, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0x08, 0x17, 0x00, 0x03, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbf, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x19, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x19, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x69, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbf, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xac, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xc7, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6d, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x19, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x63, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x16, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xb0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x07, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x25, 0x02, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5d, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x28, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xbf, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x08, 0x17, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbf, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x19, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x69, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x0f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbf, 0x63, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x61, 0xa2, 0xac, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xc7, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x19, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x63, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x16, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xb8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x0a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x07, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x07, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xbf, 0xa3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x07, 0x2b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x25, 0x02, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x21, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xbf, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x08, 0x17, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbf, 0x79, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x19, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x69, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xac, 0xff, 0xff, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbf, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x61, 0xa2, 0xac, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc7, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x23, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x19, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x63, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x12, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x12, 0x68, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x12, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x12, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x12, 0x48, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x10, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0a, 0xf8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x15, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x85, 0x10, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x50, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00,
+  0xe5, 0x02, 0x00, 0x00, 0xeb, 0x02, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00,
+  0x16, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x2d, 0x03, 0x00, 0x00,
+  0x46, 0x03, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00,
+  0x9e, 0x03, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00, 0xc6, 0x03, 0x00, 0x00,
+  0xd9, 0x03, 0x00, 0x00, 0xe3, 0x03, 0x00, 0x00, 0xe9, 0x03, 0x00, 0x00,
+  0xf8, 0x03, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00,
+  0x13, 0x04, 0x00, 0x00, 0x19, 0x04, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x00,
+  0x2e, 0x04, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x3a, 0x04, 0x00, 0x00,
+  0x49, 0x04, 0x00, 0x00, 0x4f, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00,
+  0x5e, 0x04, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00,
+  0x90, 0x04, 0x00, 0x00, 0xa1, 0x04, 0x00, 0x00, 0xc4, 0x04, 0x00, 0x00,
+  0xd6, 0x04, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x00, 0xfb, 0x04, 0x00, 0x00,
+  0x05, 0x05, 0x00, 0x00, 0x17, 0x05, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00,
+  0x39, 0x05, 0x00, 0x00, 0x58, 0x05, 0x00, 0x00, 0x72, 0x05, 0x00, 0x00,
+  0x83, 0x05, 0x00, 0x00, 0x8d, 0x05, 0x00, 0x00, 0x9e, 0x05, 0x00, 0x00,
+  0xaf, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00,
+  0xdb, 0x05, 0x00, 0x00, 0xee, 0x05, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00,
+  0xfe, 0x05, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x0f, 0x06, 0x00, 0x00,
+  0x21, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 0x00, 0x4a, 0x06, 0x00, 0x00,
+  0x6d, 0x06, 0x00, 0x00, 0x7f, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 0x00,
+  0x8b, 0x06, 0x00, 0x00, 0x94, 0x06, 0x00, 0x00, 0x9c, 0x06, 0x00, 0x00,
+  0xae, 0x06, 0x00, 0x00, 0xc6, 0x06, 0x00, 0x00, 0xd7, 0x06, 0x00, 0x00,
+  0xfa, 0x06, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00, 0x12, 0x07, 0x00, 0x00,
+  0x18, 0x07, 0x00, 0x00, 0x21, 0x07, 0x00, 0x00, 0x29, 0x07, 0x00, 0x00,
+  0x3b, 0x07, 0x00, 0x00, 0x53, 0x07, 0x00, 0x00, 0x64, 0x07, 0x00, 0x00,
+  0x87, 0x07, 0x00, 0x00, 0x99, 0x07, 0x00, 0x00, 0x9f, 0x07, 0x00, 0x00,
+  0xa5, 0x07, 0x00, 0x00, 0xae, 0x07, 0x00, 0x00, 0xb6, 0x07, 0x00, 0x00,
+  0xc8, 0x07, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xf1, 0x07, 0x00, 0x00,
+  0x14, 0x08, 0x00, 0x00, 0x26, 0x08, 0x00, 0x00, 0x2c, 0x08, 0x00, 0x00,
+  0x32, 0x08, 0x00, 0x00, 0x3b, 0x08, 0x00, 0x00, 0x43, 0x08, 0x00, 0x00,
+  0x55, 0x08, 0x00, 0x00, 0x6d, 0x08, 0x00, 0x00, 0x7e, 0x08, 0x00, 0x00,
+  0xa1, 0x08, 0x00, 0x00, 0xb3, 0x08, 0x00, 0x00, 0xb9, 0x08, 0x00, 0x00,
+  0xbf, 0x08, 0x00, 0x00, 0xc7, 0x08, 0x00, 0x00, 0xf4, 0x08, 0x00, 0x00,
+  0x13, 0x09, 0x00, 0x00, 0x32, 0x09, 0x00, 0x00, 0x3c, 0x09, 0x00, 0x00,
+  0x4f, 0x09, 0x00, 0x00, 0x61, 0x09, 0x00, 0x00, 0x73, 0x09, 0x00, 0x00,
+  0x86, 0x09, 0x00, 0x00, 0x97, 0x09, 0x00, 0x00, 0xa1, 0x09, 0x00, 0x00,
+  0xab, 0x09, 0x00, 0x00, 0xc4, 0x09, 0x00, 0x00, 0xd7, 0x09, 0x00, 0x00,
+  0x00, 0x0a, 0x00, 0x00, 0x18, 0x0a, 0x00, 0x00, 0x22, 0x0a, 0x00, 0x00,
+  0x35, 0x0a, 0x00, 0x00, 0x3f, 0x0a, 0x00, 0x00, 0x52, 0x0a, 0x00, 0x00,
+  0x63, 0x0a, 0x00, 0x00, 0x74, 0x0a, 0x00, 0x00, 0x8c, 0x0a, 0x00, 0x00,
+  0x9d, 0x0a, 0x00, 0x00, 0xa7, 0x0a, 0x00, 0x00, 0xb1, 0x0a, 0x00, 0x00,
+  0xbb, 0x0a, 0x00, 0x00, 0xc5, 0x0a, 0x00, 0x00, 0xd7, 0x0a, 0x00, 0x00,
+  0xe1, 0x0a, 0x00, 0x00, 0xf4, 0x0a, 0x00, 0x00, 0xfe, 0x0a, 0x00, 0x00,
+  0x08, 0x0b, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x1e, 0x0b, 0x00, 0x00,
+  0x28, 0x0b, 0x00, 0x00, 0x34, 0x0b, 0x00, 0x00, 0x3e, 0x0b, 0x00, 0x00,
+  0x48, 0x0b, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00, 0x5a, 0x0b, 0x00, 0x00,
+  0x62, 0x0b, 0x00, 0x00, 0x68, 0x0b, 0x00, 0x00, 0x70, 0x0b, 0x00, 0x00,
+  0x76, 0x0b, 0x00, 0x00, 0x7e, 0x0b, 0x00, 0x00, 0x84, 0x0b, 0x00, 0x00,
+  0x8c, 0x0b, 0x00, 0x00, 0x9a, 0x0b, 0x00, 0x00, 0xa3, 0x0b, 0x00, 0x00,
+  0xad, 0x0b, 0x00, 0x00, 0xb7, 0x0b, 0x00, 0x00, 0xcf, 0x0b, 0x00, 0x00,
+  0xe2, 0x0b, 0x00, 0x00, 0xec, 0x0b, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0x00,
+  0x10, 0x0c, 0x00, 0x00, 0x23, 0x0c, 0x00, 0x00, 0x36, 0x0c, 0x00, 0x00,
+  0x49, 0x0c, 0x00, 0x00, 0x5a, 0x0c, 0x00, 0x00, 0x6d, 0x0c, 0x00, 0x00,
+  0x79, 0x0c, 0x00, 0x00, 0x8c, 0x0c, 0x00, 0x00, 0x9f, 0x0c, 0x00, 0x00,
+  0xa9, 0x0c, 0x00, 0x00, 0xcc, 0x0c, 0x00, 0x00, 0xd8, 0x0c, 0x00, 0x00,
+  0xee, 0x0c, 0x00, 0x00, 0xfa, 0x0c, 0x00, 0x00, 0x0d, 0x0d, 0x00, 0x00,
+  0x90, 0x0d, 0x00, 0x00, 0x4f, 0x0e, 0x00, 0x00, 0x8a, 0x0e, 0x00, 0x00,
+  0x94, 0x0e, 0x00, 0x00, 0xa0, 0x0e, 0x00, 0x00, 0xaa, 0x0e, 0x00, 0x00,
+  0xbd, 0x0e, 0x00, 0x00, 0xc9, 0x0e, 0x00, 0x00, 0xd5, 0x0e, 0x00, 0x00,
+  0xeb, 0x0e, 0x00, 0x00, 0x03, 0x0d, 0x18, 0x01, 0x51, 0x00, 0x01, 0x0d,
+  0x04, 0x08, 0x30, 0x01, 0x56, 0x04, 0x30, 0xb8, 0x01, 0x02, 0x7a, 0x10,
+  0x00, 0x03, 0x0f, 0x18, 0x01, 0x51, 0x00, 0x01, 0x11, 0x04, 0x00, 0x18,
+  0x01, 0x51, 0x04, 0x18, 0x98, 0x07, 0x02, 0x7a, 0x00, 0x00, 0x01, 0x11,
+  0x04, 0x00, 0x10, 0x01, 0x52, 0x04, 0x10, 0xc0, 0x01, 0x01, 0x58, 0x04,
+  0xc8, 0x01, 0xf8, 0x01, 0x01, 0x58, 0x04, 0xf0, 0x02, 0x98, 0x07, 0x01,
+  0x58, 0x00, 0x01, 0x11, 0x04, 0x00, 0x08, 0x01, 0x53, 0x04, 0x08, 0x98,
+  0x07, 0x01, 0x56, 0x00, 0x01, 0x11, 0x04, 0x68, 0xa8, 0x01, 0x01, 0x50,
+  0x00, 0x01, 0x11, 0x04, 0x78, 0x80, 0x01, 0x01, 0x51, 0x04, 0x80, 0x01,
+  0xe8, 0x02, 0x02, 0x7a, 0x08, 0x04, 0xf0, 0x02, 0x98, 0x07, 0x02, 0x7a,
+  0x08, 0x00, 0x01, 0x11, 0x04, 0xc8, 0x01, 0xa0, 0x02, 0x09, 0x77, 0x00,
+  0x11, 0x3f, 0x1c, 0x11, 0x7f, 0x1b, 0x9f, 0x04, 0xa0, 0x02, 0xc8, 0x02,
+  0x0b, 0x77, 0x00, 0x11, 0x3f, 0x1c, 0x11, 0x7f, 0x1b, 0x23, 0x01, 0x9f,
+  0x04, 0xf0, 0x02, 0x98, 0x07, 0x09, 0x77, 0x00, 0x11, 0x3f, 0x1c, 0x11,
+  0x7f, 0x1b, 0x9f, 0x00, 0x01, 0x11, 0x04, 0xf8, 0x01, 0xa8, 0x02, 0x02,
+  0x7a, 0x20, 0x04, 0xa8, 0x02, 0xb0, 0x02, 0x01, 0x58, 0x00, 0x01, 0x11,
+  0x04, 0xf0, 0x02, 0x88, 0x03, 0x02, 0x31, 0x9f, 0x04, 0x88, 0x03, 0x98,
+  0x07, 0x03, 0x7a, 0xdf, 0x00, 0x00, 0x01, 0x11, 0x04, 0x80, 0x03, 0x88,
+  0x03, 0x01, 0x58, 0x04, 0x88, 0x03, 0xa8, 0x04, 0x03, 0x7a, 0xd0, 0x00,
+  0x04, 0xa8, 0x04, 0xb8, 0x04, 0x01, 0x51, 0x00, 0x01, 0x11, 0x04, 0x88,
+  0x03, 0x98, 0x07, 0x05, 0x7a, 0x20, 0x23, 0x20, 0x9f, 0x00, 0x01, 0x11,
+  0x04, 0xd0, 0x03, 0xd8, 0x03, 0x02, 0x30, 0x9f, 0x04, 0xd8, 0x03, 0x90,
+  0x04, 0x02, 0x7a, 0x20, 0x00, 0x01, 0x11, 0x04, 0x88, 0x04, 0x98, 0x07,
+  0x01, 0x59, 0x00, 0x03, 0x13, 0x18, 0x01, 0x51, 0x00, 0x01, 0x13, 0x04,
+  0x08, 0x30, 0x01, 0x56, 0x04, 0x30, 0xb8, 0x01, 0x02, 0x7a, 0x10, 0x00,
+  0x03, 0x15, 0x18, 0x01, 0x51, 0x00, 0x03, 0x17, 0x18, 0x01, 0x51, 0x00,
+  0x01, 0x17, 0x04, 0x08, 0x30, 0x01, 0x56, 0x04, 0x30, 0xb8, 0x01, 0x02,
+  0x7a, 0x10, 0x00, 0x03, 0x19, 0x18, 0x01, 0x51, 0x00, 0x03, 0x1b, 0x18,
+  0x01, 0x51, 0x00, 0x01, 0x1b, 0x04, 0x08, 0x30, 0x01, 0x56, 0x04, 0x30,
+  0xb8, 0x01, 0x02, 0x7a, 0x10, 0x00, 0x03, 0x1d, 0x18, 0x01, 0x51, 0x00,
+  0x03, 0x1f, 0x18, 0x01, 0x51, 0x00, 0x01, 0x1f, 0x04, 0x08, 0x30, 0x01,
+  0x56, 0x04, 0x30, 0xb8, 0x01, 0x02, 0x7a, 0x10, 0x00, 0x03, 0x21, 0x18,
+  0x01, 0x51, 0x00, 0x03, 0x23, 0x10, 0x01, 0x51, 0x00, 0x01, 0x23, 0x04,
+  0x10, 0x88, 0x04, 0x01, 0x56, 0x00, 0x01, 0x23, 0x04, 0x60, 0x70, 0x01,
+  0x50, 0x00, 0x01, 0x23, 0x04, 0x90, 0x01, 0x98, 0x01, 0x01, 0x50, 0x04,
+  0x98, 0x01, 0xa0, 0x05, 0x02, 0x7a, 0x08, 0x00, 0x01, 0x23, 0x04, 0xc8,
+  0x01, 0xd8, 0x01, 0x01, 0x57, 0x04, 0xc0, 0x02, 0xc8, 0x03, 0x01, 0x57,
+  0x04, 0xd0, 0x03, 0x90, 0x05, 0x01, 0x57, 0x00, 0x01, 0x23, 0x04, 0xd0,
+  0x02, 0xb8, 0x03, 0x01, 0x58, 0x04, 0xd0, 0x03, 0x90, 0x05, 0x01, 0x58,
+  0x00, 0x01, 0x23, 0x04, 0x88, 0x03, 0x90, 0x03, 0x0a, 0x77, 0x00, 0x71,
+  0x00, 0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f, 0x04, 0xd8, 0x03, 0x90, 0x05,
+  0x0a, 0x77, 0x00, 0x78, 0x00, 0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f, 0x00,
+  0x01, 0x23, 0x04, 0xb8, 0x04, 0xf0, 0x04, 0x02, 0x7a, 0x04, 0x04, 0xf0,
+  0x04, 0x80, 0x05, 0x01, 0x51, 0x00, 0x03, 0x27, 0x08, 0x01, 0x51, 0x00,
+  0x01, 0x11, 0x04, 0x98, 0x07, 0xa0, 0x07, 0x01, 0x51, 0x04, 0xa0, 0x07,
+  0xb8, 0x09, 0x01, 0x56, 0x04, 0xc0, 0x09, 0xb8, 0x0c, 0x01, 0x56, 0x04,
+  0xc8, 0x0d, 0x80, 0x0e, 0x01, 0x56, 0x00, 0x01, 0x11, 0x04, 0xa8, 0x07,
+  0xb8, 0x07, 0x01, 0x50, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x07, 0xe0, 0x07,
+  0x01, 0x50, 0x04, 0xe0, 0x07, 0xb0, 0x0e, 0x02, 0x7a, 0x00, 0x00, 0x01,
+  0x11, 0x04, 0x88, 0x08, 0xb8, 0x09, 0x01, 0x50, 0x04, 0xc0, 0x09, 0xd0,
+  0x0a, 0x01, 0x50, 0x00, 0x01, 0x11, 0x04, 0xa8, 0x08, 0xb8, 0x09, 0x01,
+  0x52, 0x04, 0xc0, 0x09, 0xd0, 0x09, 0x01, 0x52, 0x00, 0x01, 0x11, 0x04,
+  0xf0, 0x08, 0xb8, 0x09, 0x08, 0x73, 0x00, 0x71, 0x00, 0x40, 0x1e, 0x22,
+  0x9f, 0x04, 0xc0, 0x09, 0xe0, 0x09, 0x08, 0x73, 0x00, 0x71, 0x00, 0x40,
+  0x1e, 0x22, 0x9f, 0x00, 0x01, 0x11, 0x04, 0xf8, 0x09, 0x98, 0x0a, 0x01,
+  0x51, 0x04, 0xa8, 0x0a, 0xd0, 0x0a, 0x02, 0x7a, 0x08, 0x04, 0xe8, 0x0a,
+  0xb0, 0x0e, 0x02, 0x7a, 0x08, 0x00, 0x01, 0x11, 0x04, 0x80, 0x0a, 0xb8,
+  0x0c, 0x01, 0x56, 0x04, 0xc8, 0x0d, 0x80, 0x0e, 0x01, 0x56, 0x00, 0x01,
+  0x11, 0x04, 0x90, 0x0a, 0xb0, 0x0e, 0x01, 0x58, 0x00, 0x01, 0x11, 0x04,
+  0x90, 0x0b, 0xe8, 0x0c, 0x01, 0x50, 0x04, 0xc8, 0x0d, 0x80, 0x0e, 0x01,
+  0x50, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x0b, 0xe8, 0x0c, 0x01, 0x50, 0x04,
+  0xc8, 0x0d, 0x80, 0x0e, 0x01, 0x50, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x0b,
+  0xb8, 0x0c, 0x01, 0x56, 0x04, 0xc8, 0x0d, 0x80, 0x0e, 0x01, 0x56, 0x00,
+  0x01, 0x11, 0x04, 0xe8, 0x0b, 0xf0, 0x0b, 0x01, 0x55, 0x00, 0x01, 0x11,
+  0x04, 0xf8, 0x0b, 0xe8, 0x0c, 0x01, 0x55, 0x04, 0xc8, 0x0d, 0x80, 0x0e,
+  0x01, 0x55, 0x00, 0x01, 0x11, 0x04, 0xf0, 0x0c, 0xf8, 0x0c, 0x02, 0x30,
+  0x9f, 0x04, 0xf8, 0x0c, 0xa8, 0x0d, 0x02, 0x7a, 0x14, 0x00, 0x01, 0x11,
+  0x04, 0xa0, 0x0d, 0xc8, 0x0d, 0x01, 0x50, 0x00, 0x03, 0x2e, 0x10, 0x01,
+  0x51, 0x00, 0x01, 0x2e, 0x04, 0x10, 0x88, 0x04, 0x01, 0x56, 0x00, 0x01,
+  0x2e, 0x04, 0x60, 0x70, 0x01, 0x50, 0x00, 0x01, 0x2e, 0x04, 0x90, 0x01,
+  0x98, 0x01, 0x01, 0x50, 0x04, 0x98, 0x01, 0xa0, 0x05, 0x02, 0x7a, 0x08,
+  0x00, 0x01, 0x2e, 0x04, 0xc8, 0x01, 0xd8, 0x01, 0x01, 0x57, 0x04, 0xc0,
+  0x02, 0xc8, 0x03, 0x01, 0x57, 0x04, 0xd0, 0x03, 0x90, 0x05, 0x01, 0x57,
+  0x00, 0x01, 0x2e, 0x04, 0xd0, 0x02, 0xb8, 0x03, 0x01, 0x58, 0x04, 0xd0,
+  0x03, 0x90, 0x05, 0x01, 0x58, 0x00, 0x01, 0x2e, 0x04, 0x88, 0x03, 0x90,
+  0x03, 0x0a, 0x77, 0x00, 0x71, 0x00, 0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f,
+  0x04, 0xd8, 0x03, 0x90, 0x05, 0x0a, 0x77, 0x00, 0x78, 0x00, 0x40, 0x1e,
+  0x22, 0x23, 0x08, 0x9f, 0x00, 0x01, 0x2e, 0x04, 0xb8, 0x04, 0xf0, 0x04,
+  0x02, 0x7a, 0x04, 0x04, 0xf0, 0x04, 0x80, 0x05, 0x01, 0x51, 0x00, 0x03,
+  0x32, 0x08, 0x01, 0x51, 0x00, 0x03, 0x34, 0x10, 0x01, 0x51, 0x00, 0x01,
+  0x34, 0x04, 0x10, 0x88, 0x04, 0x01, 0x56, 0x00, 0x01, 0x34, 0x04, 0x60,
+  0x70, 0x01, 0x50, 0x00, 0x01, 0x34, 0x04, 0x90, 0x01, 0x98, 0x01, 0x01,
+  0x50, 0x04, 0x98, 0x01, 0xa0, 0x05, 0x02, 0x7a, 0x08, 0x00, 0x01, 0x34,
+  0x04, 0xc8, 0x01, 0xd8, 0x01, 0x01, 0x57, 0x04, 0xc0, 0x02, 0xc8, 0x03,
+  0x01, 0x57, 0x04, 0xd0, 0x03, 0x90, 0x05, 0x01, 0x57, 0x00, 0x01, 0x34,
+  0x04, 0xd0, 0x02, 0xb8, 0x03, 0x01, 0x58, 0x04, 0xd0, 0x03, 0x90, 0x05,
+  0x01, 0x58, 0x00, 0x01, 0x34, 0x04, 0x88, 0x03, 0x90, 0x03, 0x0a, 0x77,
+  0x00, 0x71, 0x00, 0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f, 0x04, 0xd8, 0x03,
+  0x90, 0x05, 0x0a, 0x77, 0x00, 0x78, 0x00, 0x40, 0x1e, 0x22, 0x23, 0x08,
+  0x9f, 0x00, 0x01, 0x34, 0x04, 0xb8, 0x04, 0xf0, 0x04, 0x02, 0x7a, 0x04,
+  0x04, 0xf0, 0x04, 0x80, 0x05, 0x01, 0x51, 0x00, 0x03, 0x38, 0x08, 0x01,
+  0x51, 0x00, 0x03, 0x3a, 0x10, 0x01, 0x51, 0x00, 0x01, 0x3a, 0x04, 0x10,
+  0xa8, 0x04, 0x01, 0x56, 0x00, 0x01, 0x3a, 0x04, 0x60, 0x70, 0x01, 0x50,
+  0x00, 0x01, 0x3a, 0x04, 0x90, 0x01, 0x98, 0x01, 0x01, 0x50, 0x04, 0x98,
+  0x01, 0xa0, 0x05, 0x02, 0x7a, 0x08, 0x00, 0x01, 0x3a, 0x04, 0xc8, 0x01,
+  0xd8, 0x01, 0x01, 0x57, 0x04, 0xc0, 0x02, 0xc8, 0x03, 0x01, 0x57, 0x04,
+  0xd0, 0x03, 0x90, 0x05, 0x01, 0x57, 0x00, 0x01, 0x3a, 0x04, 0xd0, 0x02,
+  0xb8, 0x03, 0x01, 0x58, 0x04, 0xd0, 0x03, 0x90, 0x05, 0x01, 0x58, 0x00,
+  0x01, 0x3a, 0x04, 0x88, 0x03, 0x90, 0x03, 0x0a, 0x77, 0x00, 0x71, 0x00,
+  0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f, 0x04, 0xd8, 0x03, 0x90, 0x05, 0x0a,
+  0x77, 0x00, 0x78, 0x00, 0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f, 0x00, 0x01,
+  0x3a, 0x04, 0xa8, 0x04, 0xe8, 0x04, 0x02, 0x7a, 0x04, 0x04, 0xe8, 0x04,
+  0x80, 0x05, 0x01, 0x52, 0x00, 0x03, 0x3e, 0x08, 0x01, 0x51, 0x00, 0x03,
+  0x40, 0x10, 0x01, 0x51, 0x00, 0x01, 0x40, 0x04, 0x10, 0xa8, 0x04, 0x01,
+  0x56, 0x00, 0x01, 0x40, 0x04, 0x60, 0x70, 0x01, 0x50, 0x00, 0x01, 0x40,
+  0x04, 0x90, 0x01, 0x98, 0x01, 0x01, 0x50, 0x04, 0x98, 0x01, 0xa0, 0x05,
+  0x02, 0x7a, 0x08, 0x00, 0x01, 0x40, 0x04, 0xc8, 0x01, 0xd8, 0x01, 0x01,
+  0x57, 0x04, 0xc0, 0x02, 0xc8, 0x03, 0x01, 0x57, 0x04, 0xd0, 0x03, 0x90,
+  0x05, 0x01, 0x57, 0x00, 0x01, 0x40, 0x04, 0xd0, 0x02, 0xb8, 0x03, 0x01,
+  0x58, 0x04, 0xd0, 0x03, 0x90, 0x05, 0x01, 0x58, 0x00, 0x01, 0x40, 0x04,
+  0x88, 0x03, 0x90, 0x03, 0x0a, 0x77, 0x00, 0x71, 0x00, 0x40, 0x1e, 0x22,
+  0x23, 0x08, 0x9f, 0x04, 0xd8, 0x03, 0x90, 0x05, 0x0a, 0x77, 0x00, 0x78,
+  0x00, 0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f, 0x00, 0x01, 0x40, 0x04, 0xa8,
+  0x04, 0xe8, 0x04, 0x02, 0x7a, 0x04, 0x04, 0xe8, 0x04, 0x80, 0x05, 0x01,
+  0x52, 0x00, 0x03, 0x44, 0x08, 0x01, 0x51, 0x00, 0x03, 0x46, 0x10, 0x01,
+  0x51, 0x00, 0x01, 0x46, 0x04, 0x10, 0xa8, 0x04, 0x01, 0x56, 0x00, 0x01,
+  0x46, 0x04, 0x60, 0x70, 0x01, 0x50, 0x00, 0x01, 0x46, 0x04, 0x90, 0x01,
+  0x98, 0x01, 0x01, 0x50, 0x04, 0x98, 0x01, 0xa0, 0x05, 0x02, 0x7a, 0x08,
+  0x00, 0x01, 0x46, 0x04, 0xc8, 0x01, 0xd8, 0x01, 0x01, 0x57, 0x04, 0xc0,
+  0x02, 0xc8, 0x03, 0x01, 0x57, 0x04, 0xd0, 0x03, 0x90, 0x05, 0x01, 0x57,
+  0x00, 0x01, 0x46, 0x04, 0xd0, 0x02, 0xb8, 0x03, 0x01, 0x58, 0x04, 0xd0,
+  0x03, 0x90, 0x05, 0x01, 0x58, 0x00, 0x01, 0x46, 0x04, 0x88, 0x03, 0x90,
+  0x03, 0x0a, 0x77, 0x00, 0x71, 0x00, 0x40, 0x1e, 0x22, 0x23, 0x08, 0x9f,
+  0x04, 0xd8, 0x03, 0x90, 0x05, 0x0a, 0x77, 0x00, 0x78, 0x00, 0x40, 0x1e,
+  0x22, 0x23, 0x08, 0x9f, 0x00, 0x01, 0x46, 0x04, 0xa8, 0x04, 0xe8, 0x04,
+  0x02, 0x7a, 0x04, 0x04, 0xe8, 0x04, 0x80, 0x05, 0x01, 0x52, 0x00, 0x03,
+  0x4a, 0x08, 0x01, 0x51, 0x00, 0x03, 0x4c, 0x18, 0x01, 0x51, 0x00, 0x01,
+  0x4c, 0x04, 0x08, 0x18, 0x01, 0x52, 0x00, 0x01, 0x11, 0x04, 0xb0, 0x0e,
+  0xc8, 0x0e, 0x01, 0x51, 0x04, 0xc8, 0x0e, 0x88, 0x15, 0x01, 0x57, 0x04,
+  0xb8, 0x16, 0x80, 0x19, 0x01, 0x57, 0x04, 0xa0, 0x19, 0x88, 0x1e, 0x01,
+  0x57, 0x04, 0xa8, 0x1e, 0xf8, 0x1f, 0x01, 0x57, 0x04, 0xf8, 0x20, 0xb0,
+  0x21, 0x01, 0x57, 0x00, 0x01, 0x11, 0x04, 0xb0, 0x0e, 0xc0, 0x0e, 0x01,
+  0x52, 0x04, 0xc0, 0x0e, 0x80, 0x13, 0x01, 0x58, 0x04, 0xb8, 0x16, 0x88,
+  0x1e, 0x01, 0x58, 0x04, 0xa8, 0x1e, 0xb0, 0x21, 0x01, 0x58, 0x00, 0x01,
+  0x11, 0x04, 0xb0, 0x0e, 0xb8, 0x0e, 0x01, 0x53, 0x04, 0xb8, 0x0e, 0xb8,
+  0x19, 0x01, 0x56, 0x04, 0xe0, 0x1a, 0x98, 0x1c, 0x01, 0x56, 0x04, 0x88,
+  0x1e, 0xb0, 0x21, 0x01, 0x56, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x0e, 0xe0,
+  0x0e, 0x01, 0x51, 0x00, 0x01, 0x11, 0x04, 0xf8, 0x0e, 0xd8, 0x0f, 0x02,
+  0x31, 0x9f, 0x04, 0xd8, 0x0f, 0xa0, 0x10, 0x02, 0x7a, 0x08, 0x00, 0x01,
+  0x11, 0x04, 0x80, 0x0f, 0x88, 0x0f, 0x01, 0x58, 0x04, 0x88, 0x0f, 0xa0,
+  0x10, 0x02, 0x7a, 0x10, 0x00, 0x01, 0x11, 0x04, 0xe8, 0x10, 0xa8, 0x11,
+  0x01, 0x58, 0x04, 0xa8, 0x11, 0xe8, 0x11, 0x02, 0x7a, 0x08, 0x00, 0x01,
+  0x11, 0x04, 0xc8, 0x12, 0xc0, 0x13, 0x02, 0x30, 0x9f, 0x04, 0xc0, 0x13,
+  0x80, 0x15, 0x02, 0x7a, 0x08, 0x00, 0x01, 0x11, 0x04, 0xc8, 0x12, 0xb8,
+  0x16, 0x01, 0x56, 0x04, 0x88, 0x1e, 0xa8, 0x1e, 0x01, 0x56, 0x00, 0x01,
+  0x11, 0x04, 0xc8, 0x12, 0x80, 0x13, 0x01, 0x58, 0x00, 0x01, 0x11, 0x04,
+  0xc8, 0x12, 0x88, 0x15, 0x01, 0x57, 0x00, 0x01, 0x11, 0x04, 0xd0, 0x12,
+  0x80, 0x13, 0x01, 0x58, 0x04, 0x80, 0x13, 0xe8, 0x14, 0x02, 0x7a, 0x10,
+  0x04, 0xe8, 0x14, 0x80, 0x15, 0x01, 0x51, 0x00, 0x01, 0x11, 0x04, 0xe8,
+  0x12, 0xb8, 0x16, 0x02, 0x7a, 0x00, 0x04, 0x88, 0x1e, 0xa8, 0x1e, 0x02,
+  0x7a, 0x00, 0x00, 0x01, 0x11, 0x04, 0x80, 0x13, 0xb0, 0x15, 0x0d, 0x78,
+  0x00, 0xa8, 0xaf, 0x80, 0x80, 0x00, 0xa8, 0xb4, 0x80, 0x80, 0x00, 0x9f,
+  0x04, 0x88, 0x1e, 0xa8, 0x1e, 0x0d, 0x78, 0x00, 0xa8, 0xaf, 0x80, 0x80,
+  0x00, 0xa8, 0xb4, 0x80, 0x80, 0x00, 0x9f, 0x00, 0x01, 0x11, 0x04, 0xb0,
+  0x13, 0xf8, 0x13, 0x01, 0x59, 0x04, 0xd8, 0x14, 0xb8, 0x16, 0x01, 0x59,
+  0x04, 0x88, 0x1e, 0xa8, 0x1e, 0x01, 0x59, 0x00, 0x01, 0x11, 0x04, 0xe8,
+  0x13, 0xb0, 0x14, 0x01, 0x50, 0x00, 0x01, 0x11, 0x04, 0x90, 0x15, 0xa8,
+  0x16, 0x0a, 0x79, 0x00, 0x77, 0x00, 0x3c, 0x1e, 0x22, 0x23, 0x18, 0x9f,
+  0x00, 0x01, 0x11, 0x04, 0xd8, 0x15, 0x80, 0x16, 0x01, 0x52, 0x00, 0x01,
+  0x11, 0x04, 0x90, 0x17, 0x98, 0x17, 0x02, 0x30, 0x9f, 0x04, 0x98, 0x17,
+  0xc8, 0x17, 0x02, 0x7a, 0x10, 0x00, 0x01, 0x11, 0x04, 0x90, 0x17, 0xa0,
+  0x19, 0x01, 0x56, 0x04, 0xa8, 0x1e, 0xb0, 0x21, 0x01, 0x56, 0x00, 0x01,
+  0x11, 0x04, 0x90, 0x17, 0xa0, 0x19, 0x01, 0x58, 0x04, 0xa8, 0x1e, 0xb0,
+  0x21, 0x01, 0x58, 0x00, 0x01, 0x11, 0x04, 0x90, 0x17, 0x80, 0x19, 0x01,
+  0x57, 0x04, 0xa8, 0x1e, 0xf8, 0x1f, 0x01, 0x57, 0x04, 0xf8, 0x20, 0xb0,
+  0x21, 0x01, 0x57, 0x00, 0x01, 0x11, 0x04, 0xc0, 0x17, 0x98, 0x18, 0x01,
+  0x50, 0x04, 0xa8, 0x1e, 0xd0, 0x1e, 0x01, 0x50, 0x00, 0x01, 0x11, 0x04,
+  0xa0, 0x18, 0xa0, 0x19, 0x01, 0x59, 0x00, 0x01, 0x11, 0x04, 0xa8, 0x18,
+  0x80, 0x19, 0x01, 0x57, 0x00, 0x01, 0x11, 0x04, 0xb8, 0x19, 0xe0, 0x1a,
+  0x01, 0x56, 0x00, 0x01, 0x11, 0x04, 0xb8, 0x19, 0xe0, 0x1a, 0x01, 0x59,
+  0x00, 0x01, 0x11, 0x04, 0x90, 0x1a, 0x98, 0x1a, 0x01, 0x51, 0x04, 0x98,
+  0x1a, 0xe0, 0x1a, 0x02, 0x7a, 0x10, 0x00, 0x01, 0x11, 0x04, 0xc0, 0x1a,
+  0xe0, 0x1a, 0x01, 0x50, 0x00, 0x01, 0x11, 0x04, 0xe8, 0x1a, 0xf0, 0x1a,
+  0x02, 0x30, 0x9f, 0x04, 0xf0, 0x1a, 0xa0, 0x1b, 0x02, 0x7a, 0x10, 0x00,
+  0x01, 0x11, 0x04, 0xe8, 0x1a, 0x98, 0x1c, 0x01, 0x56, 0x00, 0x01, 0x11,
+  0x04, 0x98, 0x1b, 0xa0, 0x1c, 0x01, 0x50, 0x00, 0x01, 0x11, 0x04, 0x88,
+  0x1c, 0xf8, 0x1c, 0x03, 0x7a, 0x10, 0x9f, 0x00, 0x01, 0x11, 0x04, 0x88,
+  0x1c, 0xf8, 0x1c, 0x01, 0x58, 0x00, 0x01, 0x11, 0x04, 0x88, 0x1c, 0xf8,
+  0x1c, 0x01, 0x57, 0x00, 0x01, 0x11, 0x04, 0xf8, 0x1c, 0x88, 0x1d, 0x03,
+  0x11, 0x00, 0x9f, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x1e, 0xa0, 0x20, 0x01,
+  0x59, 0x00, 0x01, 0x11, 0x04, 0xe0, 0x1e, 0xf8, 0x1f, 0x01, 0x57, 0x00,
+  0x01, 0x11, 0x04, 0x98, 0x20, 0xa0, 0x20, 0x03, 0x11, 0x00, 0x9f, 0x00,
+  0x03, 0x5b, 0x18, 0x01, 0x51, 0x00, 0x01, 0x5b, 0x04, 0x08, 0x18, 0x01,
+  0x52, 0x00, 0x03, 0x5d, 0x18, 0x01, 0x51, 0x00, 0x01, 0x5d, 0x04, 0x08,
+  0x18, 0x01, 0x52, 0x00, 0x03, 0x5f, 0x18, 0x01, 0x51, 0x00, 0x01, 0x5f,
+  0x04, 0x08, 0x18, 0x01, 0x52, 0x00, 0x03, 0x61, 0x18, 0x01, 0x51, 0x00,
+  0x01, 0x61, 0x04, 0x08, 0x18, 0x01, 0x52, 0x00, 0x01, 0x63, 0x04, 0x00,
+  0x08, 0x01, 0x51, 0x04, 0x08, 0xe0, 0x01, 0x01, 0x56, 0x00, 0x01, 0x63,
+  0x04, 0x68, 0xa8, 0x01, 0x01, 0x50, 0x00, 0x01, 0x63, 0x04, 0x80, 0x01,
+  0xb0, 0x01, 0x01, 0x57, 0x00, 0x01, 0x63, 0x04, 0x80, 0x01, 0xd0, 0x01,
+  0x01, 0x57, 0x00, 0x01, 0x11, 0x04, 0xb8, 0x21, 0xc0, 0x21, 0x01, 0x51,
+  0x04, 0xc0, 0x21, 0xa8, 0x2c, 0x01, 0x58, 0x04, 0xc0, 0x2c, 0xa0, 0x2d,
+  0x01, 0x58, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x21, 0xb0, 0x22, 0x03, 0x7a,
+  0xd0, 0x00, 0x04, 0xb0, 0x22, 0xe8, 0x22, 0x01, 0x53, 0x00, 0x01, 0x11,
+  0x04, 0x88, 0x22, 0xf0, 0x22, 0x01, 0x51, 0x00, 0x01, 0x11, 0x04, 0xe8,
+  0x22, 0xa8, 0x2c, 0x01, 0x58, 0x04, 0xc0, 0x2c, 0xa0, 0x2d, 0x01, 0x58,
+  0x00, 0x01, 0x11, 0x04, 0x90, 0x23, 0xc0, 0x23, 0x03, 0x7a, 0xd0, 0x00,
+  0x04, 0xc0, 0x23, 0xc8, 0x23, 0x01, 0x53, 0x00, 0x01, 0x11, 0x04, 0xc8,
+  0x23, 0xf0, 0x23, 0x03, 0x7a, 0xc8, 0x00, 0x04, 0xf0, 0x23, 0x90, 0x24,
+  0x01, 0x51, 0x00, 0x01, 0x11, 0x04, 0xc8, 0x24, 0xf8, 0x24, 0x03, 0x7a,
+  0xc8, 0x00, 0x04, 0xf8, 0x24, 0x80, 0x25, 0x01, 0x53, 0x00, 0x01, 0x11,
+  0x04, 0x80, 0x25, 0xa8, 0x25, 0x03, 0x7a, 0xd0, 0x00, 0x04, 0xa8, 0x25,
+  0xb0, 0x25, 0x01, 0x53, 0x00, 0x01, 0x11, 0x04, 0xa8, 0x25, 0xc0, 0x25,
+  0x01, 0x53, 0x04, 0xa8, 0x26, 0xb8, 0x26, 0x01, 0x53, 0x00, 0x01, 0x11,
+  0x04, 0xc8, 0x25, 0xf8, 0x25, 0x03, 0x7a, 0xc8, 0x00, 0x04, 0xf8, 0x25,
+  0x80, 0x26, 0x01, 0x53, 0x00, 0x01, 0x11, 0x04, 0x80, 0x26, 0xa8, 0x26,
+  0x03, 0x7a, 0xd0, 0x00, 0x00, 0x01, 0x11, 0x04, 0xb8, 0x26, 0xe0, 0x26,
+  0x03, 0x7a, 0xd0, 0x00, 0x04, 0xe0, 0x26, 0x80, 0x27, 0x01, 0x51, 0x00,
+  0x01, 0x11, 0x04, 0xa8, 0x27, 0xd8, 0x27, 0x03, 0x7a, 0xd0, 0x00, 0x04,
+  0xd8, 0x27, 0xe8, 0x27, 0x01, 0x53, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x27,
+  0x90, 0x28, 0x01, 0x53, 0x00, 0x01, 0x11, 0x04, 0x90, 0x28, 0xc8, 0x28,
+  0x03, 0x7a, 0xc8, 0x00, 0x04, 0xc8, 0x28, 0xd0, 0x28, 0x01, 0x53, 0x04,
+  0xd0, 0x28, 0xf8, 0x28, 0x03, 0x7a, 0xc8, 0x00, 0x04, 0xf8, 0x28, 0x80,
+  0x29, 0x01, 0x53, 0x00, 0x01, 0x11, 0x04, 0x80, 0x29, 0xa8, 0x29, 0x03,
+  0x7a, 0xd0, 0x00, 0x00, 0x01, 0x11, 0x04, 0xd8, 0x2a, 0xf8, 0x2a, 0x0d,
+  0x77, 0x00, 0xa8, 0xb9, 0x80, 0x80, 0x00, 0xa8, 0xbe, 0x80, 0x80, 0x00,
+  0x9f, 0x00, 0x01, 0x11, 0x04, 0x90, 0x2b, 0xb8, 0x2b, 0x03, 0x7a, 0xd0,
+  0x00, 0x00, 0x01, 0x11, 0x04, 0xf0, 0x2c, 0xa8, 0x2d, 0x03, 0x7a, 0xd0,
+  0x00, 0x04, 0xa8, 0x2d, 0xe8, 0x2d, 0x01, 0x57, 0x00, 0x01, 0x11, 0x04,
+  0xf0, 0x2c, 0x80, 0x2f, 0x10, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93,
+  0x04, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0x80, 0x2f,
+  0xa0, 0x30, 0x0e, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93,
+  0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0xa0, 0x30, 0x88, 0x31, 0x10, 0x30,
+  0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x30,
+  0x9f, 0x93, 0x04, 0x04, 0x88, 0x31, 0x98, 0x31, 0x0c, 0x30, 0x9f, 0x93,
+  0x04, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0x98, 0x31,
+  0xa8, 0x31, 0x08, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04,
+  0xa8, 0x31, 0xb8, 0x31, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0xb8, 0x32,
+  0xa8, 0x3b, 0x10, 0x7a, 0x28, 0x93, 0x04, 0x7a, 0x20, 0x93, 0x04, 0x7a,
+  0x10, 0x93, 0x04, 0x7a, 0x00, 0x93, 0x04, 0x00, 0x01, 0x11, 0x04, 0xf0,
+  0x2c, 0x90, 0x2f, 0x10, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04,
+  0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0x90, 0x2f, 0xa0,
+  0x30, 0x0e, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04,
+  0x30, 0x9f, 0x93, 0x04, 0x04, 0xa0, 0x30, 0xc8, 0x31, 0x10, 0x30, 0x9f,
+  0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f,
+  0x93, 0x04, 0x04, 0xc8, 0x31, 0xd8, 0x31, 0x0c, 0x30, 0x9f, 0x93, 0x04,
+  0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0xd8, 0x31, 0xe8,
+  0x31, 0x08, 0x30, 0x9f, 0x93, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0xe8,
+  0x31, 0xf8, 0x31, 0x04, 0x30, 0x9f, 0x93, 0x04, 0x04, 0xb8, 0x32, 0xc8,
+  0x34, 0x0f, 0x7a, 0x30, 0x93, 0x04, 0x53, 0x93, 0x04, 0x7a, 0x18, 0x93,
+  0x04, 0x7a, 0x08, 0x93, 0x04, 0x04, 0xc8, 0x34, 0xc0, 0x35, 0x0e, 0x7a,
+  0x30, 0x93, 0x04, 0x93, 0x04, 0x7a, 0x18, 0x93, 0x04, 0x7a, 0x08, 0x93,
+  0x04, 0x04, 0xc0, 0x35, 0xe8, 0x35, 0x0f, 0x7a, 0x30, 0x93, 0x04, 0x53,
+  0x93, 0x04, 0x7a, 0x18, 0x93, 0x04, 0x7a, 0x08, 0x93, 0x04, 0x04, 0xe8,
+  0x35, 0xa8, 0x3b, 0x0e, 0x7a, 0x30, 0x93, 0x04, 0x93, 0x04, 0x7a, 0x18,
+  0x93, 0x04, 0x7a, 0x08, 0x93, 0x04, 0x00, 0x01, 0x11, 0x04, 0xf0, 0x2c,
+  0x80, 0x2f, 0x02, 0x30, 0x9f, 0x04, 0x80, 0x2f, 0x88, 0x2f, 0x0d, 0x74,
+  0x00, 0xa8, 0xb9, 0x80, 0x80, 0x00, 0xa8, 0xbe, 0x80, 0x80, 0x00, 0x9f,
+  0x04, 0x88, 0x2f, 0xa0, 0x30, 0x0f, 0x7a, 0x38, 0x94, 0x08, 0xa8, 0xb9,
+  0x80, 0x80, 0x00, 0xa8, 0xbe, 0x80, 0x80, 0x00, 0x9f, 0x04, 0xa0, 0x30,
+  0x98, 0x32, 0x02, 0x30, 0x9f, 0x00, 0x01, 0x11, 0x04, 0xf0, 0x2c, 0xa0,
+  0x2d, 0x01, 0x58, 0x00, 0x01, 0x11, 0x04, 0xa8, 0x2d, 0xe0, 0x2d, 0x03,
+  0x7a, 0xd0, 0x00, 0x00, 0x01, 0x11, 0x04, 0xa8, 0x2d, 0xf8, 0x39, 0x01,
+  0x57, 0x00, 0x01, 0x11, 0x04, 0xd0, 0x2e, 0xa0, 0x30, 0x02, 0x30, 0x9f,
+  0x04, 0xf8, 0x30, 0x98, 0x32, 0x02, 0x31, 0x9f, 0x00, 0x01, 0x11, 0x04,
+  0xb8, 0x32, 0xa8, 0x3b, 0x03, 0x7a, 0xc0, 0x00, 0x00, 0x01, 0x11, 0x04,
+  0xe0, 0x33, 0xf0, 0x33, 0x03, 0x72, 0x28, 0x9f, 0x00, 0x01, 0x11, 0x04,
+  0x90, 0x36, 0xc8, 0x36, 0x0d, 0x74, 0x00, 0xa8, 0xb9, 0x80, 0x80, 0x00,
+  0xa8, 0xbe, 0x80, 0x80, 0x00, 0x9f, 0x00, 0x01, 0x11, 0x04, 0x90, 0x36,
+  0x98, 0x36, 0x03, 0x72, 0x38, 0x9f, 0x00, 0x01, 0x11, 0x01, 0x25, 0x25,
+  0x13, 0x05, 0x03, 0x25, 0x72, 0x17, 0x10, 0x17, 0x1b, 0x25, 0x11, 0x01,
+  0x55, 0x23, 0x73, 0x17, 0x74, 0x17, 0x8c, 0x01, 0x17, 0x00, 0x00, 0x02,
+  0x24, 0x00, 0x03, 0x26, 0x3e, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x03, 0x34,
+  0x00, 0x03, 0x25, 0x49, 0x13, 0x3f, 0x19, 0x3a, 0x0b, 0x3b, 0x0b, 0x02,
+  0x18, 0x00, 0x00, 0x04, 0x26, 0x00, 0x49, 0x13, 0x00, 0x00, 0x05, 0x35,
+  0x00, 0x49, 0x13, 0x00, 0x00, 0x06, 0x13, 0x01, 0x03, 0x25, 0x0b, 0x0b,
+  0x3a, 0x0b, 0x3b, 0x0b, 0x00, 0x00, 0x07, 0x0d, 0x00, 0x03, 0x25, 0x49,
+  0x13, 0x3a, 0x0b, 0x3b, 0x0b, 0x38, 0x0b, 0x00, 0x00, 0x08, 0x16, 0x00,
+  0x49, 0x13, 0x03, 0x25, 0x3a, 0x0b, 0x3b, 0x0b, 0x00, 0x00, 0x09, 0x24,
+  0x00, 0x03, 0x25, 0x3e, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x0a, 0x01, 0x01,
+  0x49, 0x13, 0x00, 0x00, 0x0b, 0x21, 0x00, 0x49, 0x13, 0x37, 0x0b, 0x00,
+  0x00, 0x0c, 0x24, 0x00, 0x03, 0x25, 0x0b, 0x0b, 0x3e, 0x0b, 0x00, 0x00,
+  0x0d, 0x34, 0x00, 0x03, 0x25, 0x49, 0x13, 0x3f, 0x19, 0x3a, 0x0b, 0x3b,
+  0x05, 0x02, 0x18, 0x00, 0x00, 0x0e, 0x13, 0x01, 0x0b, 0x0b, 0x3a, 0x0b,
+  0x3b, 0x0b, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x49, 0x13, 0x00, 0x00, 0x10,
+  0x21, 0x00, 0x49, 0x13, 0x37, 0x05, 0x00, 0x00, 0x11, 0x13, 0x01, 0x03,
+  0x25, 0x0b, 0x05, 0x3a, 0x0b, 0x3b, 0x0b, 0x88, 0x01, 0x0f, 0x00, 0x00,
+  0x12, 0x13, 0x01, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x05, 0x00, 0x00, 0x13,
+  0x0d, 0x00, 0x03, 0x25, 0x49, 0x13, 0x3a, 0x0b, 0x3b, 0x05, 0x38, 0x0b,
+  0x00, 0x00, 0x14, 0x13, 0x01, 0x03, 0x25, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b,
+  0x05, 0x00, 0x00, 0x15, 0x34, 0x00, 0x03, 0x25, 0x49, 0x13, 0x3a, 0x0b,
+  0x3b, 0x0b, 0x00, 0x00, 0x16, 0x15, 0x00, 0x49, 0x13, 0x27, 0x19, 0x00,
+  0x00, 0x17, 0x15, 0x01, 0x49, 0x13, 0x27, 0x19, 0x00, 0x00, 0x18, 0x05,
+  0x00, 0x49, 0x13, 0x00, 0x00, 0x19, 0x0f, 0x00, 0x00, 0x00, 0x1a, 0x26,
+  0x00, 0x00, 0x00, 0x1b, 0x15, 0x01, 0x27, 0x19, 0x00, 0x00, 0x1c, 0x04,
+  0x01, 0x49, 0x13, 0x03, 0x25, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x0b, 0x00,
+  0x00, 0x1d, 0x28, 0x00, 0x03, 0x25, 0x1c, 0x0f, 0x00, 0x00, 0x1e, 0x04,
+  0x01, 0x49, 0x13, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x05, 0x00, 0x00, 0x1f,
+  0x04, 0x01, 0x49, 0x13, 0x03, 0x26, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x05,
+  0x00, 0x00, 0x20, 0x28, 0x00, 0x03, 0x26, 0x1c, 0x0f, 0x00, 0x00, 0x21,
+  0x04, 0x01, 0x49, 0x13, 0x03, 0x26, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x0b,
+  0x00, 0x00, 0x22, 0x13, 0x01, 0x03, 0x26, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b,
+  0x0b, 0x00, 0x00, 0x23, 0x0d, 0x00, 0x03, 0x26, 0x49, 0x13, 0x3a, 0x0b,
+  0x3b, 0x0b, 0x38, 0x0b, 0x00, 0x00, 0x24, 0x2e, 0x01, 0x03, 0x26, 0x3a,
+  0x0b, 0x3b, 0x05, 0x27, 0x19, 0x49, 0x13, 0x20, 0x21, 0x01, 0x00, 0x00,
+  0x25, 0x05, 0x00, 0x03, 0x25, 0x3a, 0x0b, 0x3b, 0x05, 0x49, 0x13, 0x00,
+  0x00, 0x26, 0x34, 0x00, 0x03, 0x25, 0x3a, 0x0b, 0x3b, 0x05, 0x49, 0x13,
+  0x00, 0x00, 0x27, 0x34, 0x00, 0x03, 0x26, 0x3a, 0x0b, 0x3b, 0x05, 0x49,
+  0x13, 0x00, 0x00, 0x28, 0x2e, 0x01, 0x11, 0x1b, 0x12, 0x06, 0x40, 0x18,
+  0x7a, 0x19, 0x03, 0x26, 0x3a, 0x0b, 0x3b, 0x05, 0x27, 0x19, 0x49, 0x13,
+  0x3f, 0x19, 0x00, 0x00, 0x29, 0x05, 0x00, 0x02, 0x22, 0x03, 0x26, 0x3a,
+  0x0b, 0x3b, 0x05, 0x49, 0x13, 0x00, 0x00, 0x2a, 0x1d, 0x01, 0x31, 0x13,
+  0x55, 0x23, 0x58, 0x0b, 0x59, 0x05, 0x57, 0x0b, 0x00, 0x00, 0x2b, 0x05,
+  0x00, 0x02, 0x18, 0x31, 0x13, 0x00, 0x00, 0x2c, 0x05, 0x00, 0x1c, 0x0f,
+  0x31, 0x13, 0x00, 0x00, 0x2d, 0x34, 0x00, 0x02, 0x18, 0x31, 0x13, 0x00,
+  0x00, 0x2e, 0x34, 0x00, 0x02, 0x22, 0x31, 0x13, 0x00, 0x00, 0x2f, 0x48,
+  0x00, 0x7f, 0x13, 0x7d, 0x1b, 0x00, 0x00, 0x30, 0x2e, 0x01, 0x11, 0x1b,
+  0x12, 0x06, 0x40, 0x18, 0x7a, 0x19, 0x03, 0x26, 0x3a, 0x0b, 0x3b, 0x05,
+  0x27, 0x19, 0x49, 0x13, 0x00, 0x00, 0x31, 0x05, 0x00, 0x02, 0x22, 0x03,
+  0x25, 0x3a, 0x0b, 0x3b, 0x05, 0x49, 0x13, 0x00, 0x00, 0x32, 0x0b, 0x01,
+  0x55, 0x23, 0x00, 0x00, 0x33, 0x34, 0x00, 0x02, 0x22, 0x03, 0x26, 0x3a,
+  0x0b, 0x3b, 0x05, 0x49, 0x13, 0x00, 0x00, 0x34, 0x05, 0x00, 0x02, 0x22,
+  0x31, 0x13, 0x00, 0x00, 0x35, 0x0b, 0x01, 0x11, 0x1b, 0x12, 0x06, 0x00,
+  0x00, 0x36, 0x1d, 0x01, 0x31, 0x13, 0x11, 0x1b, 0x12, 0x06, 0x58, 0x0b,
+  0x59, 0x05, 0x57, 0x0b, 0x00, 0x00, 0x37, 0x34, 0x00, 0x31, 0x13, 0x00,
+  0x00, 0x38, 0x34, 0x00, 0x02, 0x18, 0x03, 0x25, 0x3a, 0x0b, 0x3b, 0x05,
+  0x49, 0x13, 0x00, 0x00, 0x39, 0x2e, 0x01, 0x03, 0x26, 0x3a, 0x0b, 0x3b,
+  0x05, 0x27, 0x19, 0x20, 0x21, 0x01, 0x00, 0x00, 0x3a, 0x05, 0x00, 0x03,
+  0x26, 0x3a, 0x0b, 0x3b, 0x05, 0x49, 0x13, 0x00, 0x00, 0x3b, 0x17, 0x01,
+  0x03, 0x26, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x05, 0x00, 0x00, 0x3c, 0x0d,
+  0x00, 0x03, 0x26, 0x49, 0x13, 0x3a, 0x0b, 0x3b, 0x05, 0x88, 0x01, 0x0f,
+  0x38, 0x0b, 0x00, 0x00, 0x3d, 0x0d, 0x00, 0x03, 0x26, 0x49, 0x13, 0x3a,
+  0x0b, 0x3b, 0x05, 0x38, 0x0b, 0x00, 0x00, 0x3e, 0x13, 0x01, 0x03, 0x26,
+  0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x0b, 0x88, 0x01, 0x0f, 0x00, 0x00, 0x3f,
+  0x21, 0x00, 0x49, 0x13, 0x00, 0x00, 0x40, 0x0b, 0x01, 0x00, 0x00, 0x41,
+  0x34, 0x00, 0x02, 0x22, 0x03, 0x25, 0x3a, 0x0b, 0x3b, 0x05, 0x49, 0x13,
+  0x00, 0x00, 0x42, 0x2e, 0x01, 0x11, 0x1b, 0x12, 0x06, 0x40, 0x18, 0x7a,
+  0x19, 0x03, 0x26, 0x3a, 0x0b, 0x3b, 0x0b, 0x27, 0x19, 0x49, 0x13, 0x3f,
+  0x19, 0x00, 0x00, 0x43, 0x05, 0x00, 0x02, 0x22, 0x03, 0x26, 0x3a, 0x0b,
+  0x3b, 0x0b, 0x49, 0x13, 0x00, 0x00, 0x44, 0x34, 0x00, 0x02, 0x22, 0x03,
+  0x25, 0x3a, 0x0b, 0x3b, 0x0b, 0x49, 0x13, 0x00, 0x00, 0x45, 0x0a, 0x00,
+  0x31, 0x13, 0x11, 0x1b, 0x00, 0x00, 0x46, 0x2e, 0x01, 0x03, 0x26, 0x3a,
+  0x0b, 0x3b, 0x0b, 0x27, 0x19, 0x49, 0x13, 0x20, 0x21, 0x01, 0x00, 0x00,
+  0x47, 0x05, 0x00, 0x03, 0x26, 0x3a, 0x0b, 0x3b, 0x0b, 0x49, 0x13, 0x00,
+  0x00, 0x48, 0x0a, 0x00, 0x03, 0x25, 0x3a, 0x0b, 0x3b, 0x05, 0x00, 0x00,
+  0x49, 0x1d, 0x01, 0x31, 0x13, 0x55, 0x23, 0x58, 0x0b, 0x59, 0x0b, 0x57,
+  0x0b, 0x00, 0x00, 0x00, 0x9d, 0x21, 0x00, 0x00, 0x05, 0x00, 0x01, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x01, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c,
+  0x00, 0x00, 0x00, 0x02, 0xad, 0x01, 0x07, 0x08, 0x02, 0xac, 0x01, 0x07,
+  0x04, 0x02, 0xab, 0x01, 0x07, 0x01, 0x02, 0xaa, 0x01, 0x07, 0x01, 0x03,
+  0x03, 0x4e, 0x00, 0x00, 0x00, 0x03, 0x9b, 0x02, 0xa1, 0x00, 0x04, 0x53,
+  0x00, 0x00, 0x00, 0x05, 0x58, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x50, 0x02,
+  0x3e, 0x07, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x3f, 0x00, 0x07, 0x07,
+  0x9d, 0x00, 0x00, 0x00, 0x02, 0x40, 0x04, 0x07, 0x08, 0x9d, 0x00, 0x00,
+  0x00, 0x02, 0x41, 0x08, 0x07, 0x09, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x43,
+  0x0c, 0x07, 0x0a, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x44, 0x10, 0x07, 0x0b,
+  0x9d, 0x00, 0x00, 0x00, 0x02, 0x46, 0x14, 0x07, 0x0c, 0xa9, 0x00, 0x00,
+  0x00, 0x02, 0x47, 0x18, 0x00, 0x08, 0xa5, 0x00, 0x00, 0x00, 0x06, 0x01,
+  0x09, 0x09, 0x05, 0x07, 0x04, 0x06, 0x1d, 0x38, 0x02, 0x2b, 0x07, 0x0d,
+  0x09, 0x01, 0x00, 0x00, 0x02, 0x2c, 0x00, 0x07, 0x10, 0x9d, 0x00, 0x00,
+  0x00, 0x02, 0x2e, 0x08, 0x07, 0x11, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x2f,
+  0x0c, 0x07, 0x12, 0x15, 0x01, 0x00, 0x00, 0x02, 0x30, 0x10, 0x07, 0x14,
+  0x15, 0x01, 0x00, 0x00, 0x02, 0x31, 0x20, 0x07, 0x15, 0x25, 0x01, 0x00,
+  0x00, 0x02, 0x33, 0x30, 0x07, 0x18, 0x25, 0x01, 0x00, 0x00, 0x02, 0x34,
+  0x32, 0x07, 0x19, 0x25, 0x01, 0x00, 0x00, 0x02, 0x35, 0x34, 0x07, 0x1a,
+  0x31, 0x01, 0x00, 0x00, 0x02, 0x36, 0x36, 0x07, 0x0a, 0x31, 0x01, 0x00,
+  0x00, 0x02, 0x37, 0x37, 0x00, 0x08, 0x11, 0x01, 0x00, 0x00, 0x0f, 0x01,
+  0x0a, 0x09, 0x0e, 0x07, 0x08, 0x0a, 0x9d, 0x00, 0x00, 0x00, 0x0b, 0x21,
+  0x01, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x2d, 0x01,
+  0x00, 0x00, 0x17, 0x01, 0x08, 0x09, 0x16, 0x07, 0x02, 0x08, 0x39, 0x01,
+  0x00, 0x00, 0x1c, 0x01, 0x07, 0x09, 0x1b, 0x08, 0x01, 0x0d, 0x1f, 0x49,
+  0x01, 0x00, 0x00, 0x03, 0x70, 0x04, 0x02, 0xa1, 0x01, 0x0a, 0x55, 0x01,
+  0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x04, 0x00, 0x09, 0x20, 0x06,
+  0x01, 0x03, 0x21, 0x64, 0x01, 0x00, 0x00, 0x03, 0x81, 0x02, 0xa1, 0x02,
+  0x0e, 0x18, 0x03, 0x7d, 0x07, 0x22, 0x84, 0x01, 0x00, 0x00, 0x03, 0x7e,
+  0x00, 0x07, 0x24, 0x84, 0x01, 0x00, 0x00, 0x03, 0x7f, 0x08, 0x07, 0x25,
+  0x84, 0x01, 0x00, 0x00, 0x03, 0x80, 0x10, 0x00, 0x0f, 0x89, 0x01, 0x00,
+  0x00, 0x0a, 0x95, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x09, 0x23, 0x05, 0x04, 0x03, 0x26, 0xa4, 0x01, 0x00, 0x00, 0x03,
+  0x88, 0x02, 0xa1, 0x03, 0x0e, 0x20, 0x03, 0x83, 0x07, 0x22, 0xcd, 0x01,
+  0x00, 0x00, 0x03, 0x84, 0x00, 0x07, 0x27, 0xde, 0x01, 0x00, 0x00, 0x03,
+  0x85, 0x08, 0x07, 0x28, 0xef, 0x01, 0x00, 0x00, 0x03, 0x86, 0x10, 0x07,
+  0x29, 0xf4, 0x01, 0x00, 0x00, 0x03, 0x87, 0x18, 0x00, 0x0f, 0xd2, 0x01,
+  0x00, 0x00, 0x0a, 0x95, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00,
+  0x06, 0x00, 0x0f, 0xe3, 0x01, 0x00, 0x00, 0x0a, 0x95, 0x01, 0x00, 0x00,
+  0x0b, 0x21, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x9d, 0x00, 0x00, 0x00,
+  0x0f, 0xf9, 0x01, 0x00, 0x00, 0x06, 0x2c, 0x10, 0x02, 0x4d, 0x07, 0x2a,
+  0x09, 0x01, 0x00, 0x00, 0x02, 0x4f, 0x00, 0x07, 0x2b, 0x09, 0x01, 0x00,
+  0x00, 0x02, 0x51, 0x08, 0x00, 0x03, 0x2d, 0x1c, 0x02, 0x00, 0x00, 0x03,
+  0x92, 0x02, 0xa1, 0x04, 0x0e, 0x10, 0x03, 0x8f, 0x07, 0x22, 0x33, 0x02,
+  0x00, 0x00, 0x03, 0x90, 0x00, 0x07, 0x27, 0x44, 0x02, 0x00, 0x00, 0x03,
+  0x91, 0x08, 0x00, 0x0f, 0x38, 0x02, 0x00, 0x00, 0x0a, 0x95, 0x01, 0x00,
+  0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x0f, 0x49, 0x02, 0x00,
+  0x00, 0x0a, 0x95, 0x01, 0x00, 0x00, 0x10, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x03, 0x2e, 0x61, 0x02, 0x00, 0x00, 0x03, 0xa6, 0x02, 0xa1,
+  0x05, 0x0e, 0x20, 0x03, 0xa1, 0x07, 0x22, 0x8a, 0x02, 0x00, 0x00, 0x03,
+  0xa2, 0x00, 0x07, 0x27, 0x9b, 0x02, 0x00, 0x00, 0x03, 0xa3, 0x08, 0x07,
+  0x28, 0xad, 0x02, 0x00, 0x00, 0x03, 0xa4, 0x10, 0x07, 0x29, 0xb2, 0x02,
+  0x00, 0x00, 0x03, 0xa5, 0x18, 0x00, 0x0f, 0x8f, 0x02, 0x00, 0x00, 0x0a,
+  0x95, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x09, 0x00, 0x0f,
+  0xa0, 0x02, 0x00, 0x00, 0x0a, 0x95, 0x01, 0x00, 0x00, 0x10, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x09, 0x01, 0x00, 0x00, 0x0f, 0xb7,
+  0x02, 0x00, 0x00, 0x11, 0x3b, 0x18, 0x06, 0x02, 0x96, 0x08, 0x07, 0x2f,
+  0x09, 0x01, 0x00, 0x00, 0x02, 0x97, 0x00, 0x07, 0x30, 0x09, 0x01, 0x00,
+  0x00, 0x02, 0x98, 0x08, 0x07, 0x31, 0x25, 0x01, 0x00, 0x00, 0x02, 0x99,
+  0x10, 0x07, 0x32, 0x31, 0x01, 0x00, 0x00, 0x02, 0x9a, 0x12, 0x07, 0x33,
+  0xfe, 0x02, 0x00, 0x00, 0x02, 0x9b, 0x13, 0x07, 0x34, 0x9d, 0x00, 0x00,
+  0x00, 0x02, 0x9d, 0x14, 0x07, 0x35, 0x0a, 0x03, 0x00, 0x00, 0x02, 0x9e,
+  0x18, 0x00, 0x0a, 0x31, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x0a, 0x16, 0x03, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00,
+  0x80, 0x00, 0x06, 0x3a, 0x0c, 0x02, 0x89, 0x07, 0x36, 0x9d, 0x00, 0x00,
+  0x00, 0x02, 0x8a, 0x00, 0x07, 0x37, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x8c,
+  0x04, 0x07, 0x38, 0x25, 0x01, 0x00, 0x00, 0x02, 0x8d, 0x08, 0x07, 0x39,
+  0x31, 0x01, 0x00, 0x00, 0x02, 0x8e, 0x0a, 0x07, 0x33, 0xfe, 0x02, 0x00,
+  0x00, 0x02, 0x8f, 0x0b, 0x00, 0x03, 0x3c, 0x54, 0x03, 0x00, 0x00, 0x03,
+  0xb1, 0x02, 0xa1, 0x06, 0x0e, 0x20, 0x03, 0xac, 0x07, 0x22, 0x7d, 0x03,
+  0x00, 0x00, 0x03, 0xad, 0x00, 0x07, 0x27, 0xde, 0x01, 0x00, 0x00, 0x03,
+  0xae, 0x08, 0x07, 0x28, 0xef, 0x01, 0x00, 0x00, 0x03, 0xaf, 0x10, 0x07,
+  0x29, 0xb2, 0x02, 0x00, 0x00, 0x03, 0xb0, 0x18, 0x00, 0x0f, 0x82, 0x03,
+  0x00, 0x00, 0x0a, 0x95, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x03, 0x3d, 0x99, 0x03, 0x00, 0x00, 0x03, 0xcf, 0x02, 0xa1,
+  0x07, 0x0e, 0x20, 0x03, 0xca, 0x07, 0x22, 0x8a, 0x02, 0x00, 0x00, 0x03,
+  0xcb, 0x00, 0x07, 0x27, 0x9b, 0x02, 0x00, 0x00, 0x03, 0xcc, 0x08, 0x07,
+  0x28, 0xad, 0x02, 0x00, 0x00, 0x03, 0xcd, 0x10, 0x07, 0x29, 0xc2, 0x03,
+  0x00, 0x00, 0x03, 0xce, 0x18, 0x00, 0x0f, 0xc7, 0x03, 0x00, 0x00, 0x06,
+  0x44, 0x48, 0x03, 0xc4, 0x07, 0x3e, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xc5,
+  0x00, 0x07, 0x33, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x04, 0x07, 0x3f,
+  0xe8, 0x03, 0x00, 0x00, 0x03, 0xc7, 0x08, 0x00, 0x0a, 0xf4, 0x03, 0x00,
+  0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x04, 0x00, 0x06, 0x43, 0x10, 0x03,
+  0xbc, 0x07, 0x40, 0x09, 0x01, 0x00, 0x00, 0x03, 0xbd, 0x00, 0x07, 0x41,
+  0x9d, 0x00, 0x00, 0x00, 0x03, 0xbe, 0x08, 0x07, 0x32, 0x31, 0x01, 0x00,
+  0x00, 0x03, 0xbf, 0x0c, 0x07, 0x42, 0x31, 0x01, 0x00, 0x00, 0x03, 0xc0,
+  0x0d, 0x07, 0x33, 0x27, 0x04, 0x00, 0x00, 0x03, 0xc1, 0x0e, 0x00, 0x0a,
+  0x31, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x02, 0x00, 0x03,
+  0x45, 0x3e, 0x04, 0x00, 0x00, 0x03, 0xdc, 0x02, 0xa1, 0x08, 0x0e, 0x20,
+  0x03, 0xd7, 0x07, 0x22, 0x8a, 0x02, 0x00, 0x00, 0x03, 0xd8, 0x00, 0x07,
+  0x27, 0x9b, 0x02, 0x00, 0x00, 0x03, 0xd9, 0x08, 0x07, 0x28, 0xad, 0x02,
+  0x00, 0x00, 0x03, 0xda, 0x10, 0x07, 0x29, 0x67, 0x04, 0x00, 0x00, 0x03,
+  0xdb, 0x18, 0x00, 0x0f, 0x31, 0x01, 0x00, 0x00, 0x03, 0x46, 0x77, 0x04,
+  0x00, 0x00, 0x03, 0xee, 0x02, 0xa1, 0x09, 0x0e, 0x20, 0x03, 0xe9, 0x07,
+  0x22, 0x8a, 0x02, 0x00, 0x00, 0x03, 0xea, 0x00, 0x07, 0x27, 0x9b, 0x02,
+  0x00, 0x00, 0x03, 0xeb, 0x08, 0x07, 0x28, 0xa0, 0x04, 0x00, 0x00, 0x03,
+  0xec, 0x10, 0x07, 0x29, 0xad, 0x02, 0x00, 0x00, 0x03, 0xed, 0x18, 0x00,
+  0x0f, 0xa5, 0x04, 0x00, 0x00, 0x06, 0x49, 0x10, 0x03, 0xe3, 0x07, 0x47,
+  0x09, 0x01, 0x00, 0x00, 0x03, 0xe4, 0x00, 0x07, 0x48, 0x9d, 0x00, 0x00,
+  0x00, 0x03, 0xe5, 0x08, 0x07, 0x33, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xe6,
+  0x0c, 0x00, 0x03, 0x4a, 0xd1, 0x04, 0x00, 0x00, 0x03, 0xf9, 0x02, 0xa1,
+  0x0a, 0x0e, 0x20, 0x03, 0xf4, 0x07, 0x22, 0xde, 0x01, 0x00, 0x00, 0x03,
+  0xf5, 0x00, 0x07, 0x27, 0xde, 0x01, 0x00, 0x00, 0x03, 0xf6, 0x08, 0x07,
+  0x28, 0xad, 0x02, 0x00, 0x00, 0x03, 0xf7, 0x10, 0x07, 0x29, 0xef, 0x01,
+  0x00, 0x00, 0x03, 0xf8, 0x18, 0x00, 0x0d, 0x4b, 0x06, 0x05, 0x00, 0x00,
+  0x03, 0x07, 0x01, 0x02, 0xa1, 0x0b, 0x12, 0x20, 0x03, 0x02, 0x01, 0x13,
+  0x22, 0x7d, 0x03, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x13, 0x27, 0xde,
+  0x01, 0x00, 0x00, 0x03, 0x04, 0x01, 0x08, 0x13, 0x28, 0xef, 0x01, 0x00,
+  0x00, 0x03, 0x05, 0x01, 0x10, 0x13, 0x29, 0xad, 0x02, 0x00, 0x00, 0x03,
+  0x06, 0x01, 0x18, 0x00, 0x0d, 0x4c, 0x40, 0x05, 0x00, 0x00, 0x03, 0x2a,
+  0x01, 0x02, 0xa1, 0x0c, 0x12, 0x20, 0x03, 0x25, 0x01, 0x13, 0x22, 0x8a,
+  0x02, 0x00, 0x00, 0x03, 0x26, 0x01, 0x00, 0x13, 0x27, 0x9b, 0x02, 0x00,
+  0x00, 0x03, 0x27, 0x01, 0x08, 0x13, 0x28, 0x6e, 0x05, 0x00, 0x00, 0x03,
+  0x28, 0x01, 0x10, 0x13, 0x29, 0xad, 0x02, 0x00, 0x00, 0x03, 0x29, 0x01,
+  0x18, 0x00, 0x0f, 0x73, 0x05, 0x00, 0x00, 0x14, 0x4d, 0x10, 0x03, 0x1f,
+  0x01, 0x13, 0x47, 0x09, 0x01, 0x00, 0x00, 0x03, 0x20, 0x01, 0x00, 0x13,
+  0x36, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x21, 0x01, 0x08, 0x13, 0x33, 0x9d,
+  0x00, 0x00, 0x00, 0x03, 0x22, 0x01, 0x0c, 0x00, 0x15, 0x4e, 0xa0, 0x05,
+  0x00, 0x00, 0x05, 0x0a, 0x0f, 0xa5, 0x05, 0x00, 0x00, 0x16, 0xaa, 0x05,
+  0x00, 0x00, 0x08, 0xb2, 0x05, 0x00, 0x00, 0x50, 0x04, 0x1f, 0x09, 0x4f,
+  0x07, 0x08, 0x15, 0x51, 0xbe, 0x05, 0x00, 0x00, 0x05, 0x03, 0x0f, 0xc3,
+  0x05, 0x00, 0x00, 0x17, 0xd3, 0x05, 0x00, 0x00, 0x18, 0xd3, 0x05, 0x00,
+  0x00, 0x18, 0xd4, 0x05, 0x00, 0x00, 0x00, 0x19, 0x0f, 0xd9, 0x05, 0x00,
+  0x00, 0x1a, 0x15, 0x52, 0xe2, 0x05, 0x00, 0x00, 0x05, 0x0c, 0x0f, 0xe7,
+  0x05, 0x00, 0x00, 0x17, 0xfc, 0x05, 0x00, 0x00, 0x18, 0xd3, 0x05, 0x00,
+  0x00, 0x18, 0x00, 0x06, 0x00, 0x00, 0x18, 0xd4, 0x05, 0x00, 0x00, 0x00,
+  0x09, 0x53, 0x05, 0x08, 0x08, 0xa5, 0x00, 0x00, 0x00, 0x54, 0x04, 0x1b,
+  0x15, 0x55, 0x10, 0x06, 0x00, 0x00, 0x05, 0x04, 0x0f, 0x15, 0x06, 0x00,
+  0x00, 0x17, 0xfc, 0x05, 0x00, 0x00, 0x18, 0xd3, 0x05, 0x00, 0x00, 0x18,
+  0xd4, 0x05, 0x00, 0x00, 0x18, 0xd4, 0x05, 0x00, 0x00, 0x18, 0xaa, 0x05,
+  0x00, 0x00, 0x00, 0x15, 0x56, 0x37, 0x06, 0x00, 0x00, 0x05, 0x05, 0x0f,
+  0x3c, 0x06, 0x00, 0x00, 0x17, 0xfc, 0x05, 0x00, 0x00, 0x18, 0xd3, 0x05,
+  0x00, 0x00, 0x18, 0xd4, 0x05, 0x00, 0x00, 0x00, 0x15, 0x57, 0xa0, 0x05,
+  0x00, 0x00, 0x05, 0x07, 0x15, 0x58, 0x5c, 0x06, 0x00, 0x00, 0x05, 0x09,
+  0x0f, 0x61, 0x06, 0x00, 0x00, 0x16, 0x00, 0x06, 0x00, 0x00, 0x15, 0x59,
+  0x6e, 0x06, 0x00, 0x00, 0x05, 0x0d, 0x0f, 0x73, 0x06, 0x00, 0x00, 0x17,
+  0xfc, 0x05, 0x00, 0x00, 0x18, 0xd3, 0x05, 0x00, 0x00, 0x18, 0xd3, 0x05,
+  0x00, 0x00, 0x18, 0xaa, 0x05, 0x00, 0x00, 0x18, 0xaa, 0x05, 0x00, 0x00,
+  0x00, 0x15, 0x5a, 0x95, 0x06, 0x00, 0x00, 0x05, 0x0b, 0x0f, 0x9a, 0x06,
+  0x00, 0x00, 0x17, 0xfc, 0x05, 0x00, 0x00, 0x18, 0xd3, 0x05, 0x00, 0x00,
+  0x18, 0xd3, 0x05, 0x00, 0x00, 0x18, 0xaa, 0x05, 0x00, 0x00, 0x18, 0xd3,
+  0x05, 0x00, 0x00, 0x18, 0xaa, 0x05, 0x00, 0x00, 0x00, 0x15, 0x5b, 0xc1,
+  0x06, 0x00, 0x00, 0x05, 0x12, 0x0f, 0xc6, 0x06, 0x00, 0x00, 0x17, 0xaa,
+  0x05, 0x00, 0x00, 0x18, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x15, 0x5c, 0xd9,
+  0x06, 0x00, 0x00, 0x05, 0x0e, 0x0f, 0xde, 0x06, 0x00, 0x00, 0x17, 0xd3,
+  0x05, 0x00, 0x00, 0x18, 0xd3, 0x05, 0x00, 0x00, 0x18, 0xaa, 0x05, 0x00,
+  0x00, 0x18, 0xaa, 0x05, 0x00, 0x00, 0x00, 0x15, 0x5d, 0xfb, 0x06, 0x00,
+  0x00, 0x05, 0x0f, 0x0f, 0x00, 0x07, 0x00, 0x00, 0x1b, 0x18, 0xd3, 0x05,
+  0x00, 0x00, 0x18, 0xaa, 0x05, 0x00, 0x00, 0x00, 0x15, 0x5e, 0xfb, 0x06,
+  0x00, 0x00, 0x05, 0x10, 0x1c, 0xa5, 0x00, 0x00, 0x00, 0x65, 0x04, 0x02,
+  0x61, 0x1d, 0x5f, 0x00, 0x1d, 0x60, 0x01, 0x1d, 0x61, 0x02, 0x1d, 0x62,
+  0x03, 0x1d, 0x63, 0x04, 0x1d, 0x64, 0x05, 0x00, 0x1e, 0xa5, 0x00, 0x00,
+  0x00, 0x04, 0x06, 0xa0, 0x04, 0x1d, 0x66, 0x00, 0x1d, 0x67, 0x01, 0x1d,
+  0x68, 0x02, 0x1d, 0x69, 0x04, 0x00, 0x1c, 0xa5, 0x00, 0x00, 0x00, 0x70,
+  0x04, 0x07, 0x03, 0x1d, 0x6a, 0x00, 0x1d, 0x6b, 0x01, 0x1d, 0x6c, 0x02,
+  0x1d, 0x6d, 0x03, 0x1d, 0x6e, 0x04, 0x1d, 0x6f, 0x05, 0x00, 0x1c, 0xa5,
+  0x00, 0x00, 0x00, 0x74, 0x04, 0x02, 0x57, 0x1d, 0x71, 0x00, 0x1d, 0x72,
+  0x01, 0x1d, 0x73, 0x02, 0x00, 0x1f, 0xa5, 0x00, 0x00, 0x00, 0x3a, 0x01,
+  0x04, 0x06, 0x03, 0x15, 0x1d, 0x75, 0x00, 0x1d, 0x76, 0x01, 0x1d, 0x77,
+  0x02, 0x1d, 0x78, 0x03, 0x1d, 0x79, 0x04, 0x1d, 0x7a, 0x05, 0x1d, 0x7b,
+  0x06, 0x1d, 0x7c, 0x07, 0x1d, 0x7d, 0x08, 0x1d, 0x7e, 0x09, 0x1d, 0x7f,
+  0x0a, 0x1d, 0x80, 0x0b, 0x1d, 0x81, 0x0c, 0x1d, 0x82, 0x0d, 0x1d, 0x83,
+  0x0e, 0x1d, 0x84, 0x0f, 0x1d, 0x85, 0x10, 0x1d, 0x86, 0x11, 0x1d, 0x87,
+  0x12, 0x1d, 0x88, 0x13, 0x1d, 0x89, 0x14, 0x1d, 0x8a, 0x15, 0x1d, 0x8b,
+  0x16, 0x1d, 0x8c, 0x17, 0x1d, 0x8d, 0x18, 0x1d, 0x8e, 0x19, 0x1d, 0x8f,
+  0x1a, 0x1d, 0x90, 0x1b, 0x1d, 0x91, 0x1c, 0x1d, 0x92, 0x1d, 0x1d, 0x93,
+  0x1e, 0x1d, 0x94, 0x1f, 0x1d, 0x95, 0x20, 0x1d, 0x96, 0x21, 0x1d, 0x97,
+  0x22, 0x1d, 0x98, 0x23, 0x1d, 0x99, 0x24, 0x1d, 0x9a, 0x25, 0x1d, 0x9b,
+  0x26, 0x1d, 0x9c, 0x27, 0x1d, 0x9d, 0x28, 0x1d, 0x9e, 0x29, 0x1d, 0x9f,
+  0x2a, 0x1d, 0xa0, 0x2b, 0x1d, 0xa1, 0x2c, 0x1d, 0xa2, 0x2d, 0x1d, 0xa3,
+  0x2e, 0x1d, 0xa4, 0x2f, 0x1d, 0xa5, 0x30, 0x1d, 0xa6, 0x31, 0x1d, 0xa7,
+  0x32, 0x1d, 0xa8, 0x33, 0x1d, 0xa9, 0x34, 0x1d, 0xaa, 0x35, 0x1d, 0xab,
+  0x36, 0x1d, 0xac, 0x37, 0x1d, 0xad, 0x38, 0x1d, 0xae, 0x39, 0x1d, 0xaf,
+  0x3a, 0x1d, 0xb0, 0x3b, 0x1d, 0xb1, 0x3c, 0x1d, 0xb2, 0x3d, 0x1d, 0xb3,
+  0x3e, 0x1d, 0xb4, 0x3f, 0x1d, 0xb5, 0x40, 0x1d, 0xb6, 0x41, 0x1d, 0xb7,
+  0x42, 0x1d, 0xb8, 0x43, 0x1d, 0xb9, 0x44, 0x1d, 0xba, 0x45, 0x1d, 0xbb,
+  0x46, 0x1d, 0xbc, 0x47, 0x1d, 0xbd, 0x48, 0x1d, 0xbe, 0x49, 0x1d, 0xbf,
+  0x4a, 0x1d, 0xc0, 0x4b, 0x1d, 0xc1, 0x4c, 0x1d, 0xc2, 0x4d, 0x1d, 0xc3,
+  0x4e, 0x1d, 0xc4, 0x4f, 0x1d, 0xc5, 0x50, 0x1d, 0xc6, 0x51, 0x1d, 0xc7,
+  0x52, 0x1d, 0xc8, 0x53, 0x1d, 0xc9, 0x54, 0x1d, 0xca, 0x55, 0x1d, 0xcb,
+  0x56, 0x1d, 0xcc, 0x57, 0x1d, 0xcd, 0x58, 0x1d, 0xce, 0x59, 0x1d, 0xcf,
+  0x5a, 0x1d, 0xd0, 0x5b, 0x1d, 0xd1, 0x5c, 0x1d, 0xd2, 0x5d, 0x1d, 0xd3,
+  0x5e, 0x1d, 0xd4, 0x5f, 0x1d, 0xd5, 0x60, 0x1d, 0xd6, 0x61, 0x1d, 0xd7,
+  0x62, 0x1d, 0xd8, 0x63, 0x1d, 0xd9, 0x64, 0x1d, 0xda, 0x65, 0x1d, 0xdb,
+  0x66, 0x1d, 0xdc, 0x67, 0x1d, 0xdd, 0x68, 0x1d, 0xde, 0x69, 0x1d, 0xdf,
+  0x6a, 0x1d, 0xe0, 0x6b, 0x1d, 0xe1, 0x6c, 0x1d, 0xe2, 0x6d, 0x1d, 0xe3,
+  0x6e, 0x1d, 0xe4, 0x6f, 0x1d, 0xe5, 0x70, 0x1d, 0xe6, 0x71, 0x1d, 0xe7,
+  0x72, 0x1d, 0xe8, 0x73, 0x1d, 0xe9, 0x74, 0x1d, 0xea, 0x75, 0x1d, 0xeb,
+  0x76, 0x1d, 0xec, 0x77, 0x1d, 0xed, 0x78, 0x1d, 0xee, 0x79, 0x1d, 0xef,
+  0x7a, 0x1d, 0xf0, 0x7b, 0x1d, 0xf1, 0x7c, 0x1d, 0xf2, 0x7d, 0x1d, 0xf3,
+  0x7e, 0x1d, 0xf4, 0x7f, 0x1d, 0xf5, 0x80, 0x01, 0x1d, 0xf6, 0x81, 0x01,
+  0x1d, 0xf7, 0x82, 0x01, 0x1d, 0xf8, 0x83, 0x01, 0x1d, 0xf9, 0x84, 0x01,
+  0x1d, 0xfa, 0x85, 0x01, 0x1d, 0xfb, 0x86, 0x01, 0x1d, 0xfc, 0x87, 0x01,
+  0x1d, 0xfd, 0x88, 0x01, 0x1d, 0xfe, 0x89, 0x01, 0x1d, 0xff, 0x8a, 0x01,
+  0x20, 0x00, 0x01, 0x8b, 0x01, 0x20, 0x01, 0x01, 0x8c, 0x01, 0x20, 0x02,
+  0x01, 0x8d, 0x01, 0x20, 0x03, 0x01, 0x8e, 0x01, 0x20, 0x04, 0x01, 0x8f,
+  0x01, 0x20, 0x05, 0x01, 0x90, 0x01, 0x20, 0x06, 0x01, 0x91, 0x01, 0x20,
+  0x07, 0x01, 0x92, 0x01, 0x20, 0x08, 0x01, 0x93, 0x01, 0x20, 0x09, 0x01,
+  0x94, 0x01, 0x20, 0x0a, 0x01, 0x95, 0x01, 0x20, 0x0b, 0x01, 0x96, 0x01,
+  0x20, 0x0c, 0x01, 0x97, 0x01, 0x20, 0x0d, 0x01, 0x98, 0x01, 0x20, 0x0e,
+  0x01, 0x99, 0x01, 0x20, 0x0f, 0x01, 0x9a, 0x01, 0x20, 0x10, 0x01, 0x9b,
+  0x01, 0x20, 0x11, 0x01, 0x9c, 0x01, 0x20, 0x12, 0x01, 0x9d, 0x01, 0x20,
+  0x13, 0x01, 0x9e, 0x01, 0x20, 0x14, 0x01, 0x9f, 0x01, 0x20, 0x15, 0x01,
+  0xa0, 0x01, 0x20, 0x16, 0x01, 0xa1, 0x01, 0x20, 0x17, 0x01, 0xa2, 0x01,
+  0x20, 0x18, 0x01, 0xa3, 0x01, 0x20, 0x19, 0x01, 0xa4, 0x01, 0x20, 0x1a,
+  0x01, 0xa5, 0x01, 0x20, 0x1b, 0x01, 0xa6, 0x01, 0x20, 0x1c, 0x01, 0xa7,
+  0x01, 0x20, 0x1d, 0x01, 0xa8, 0x01, 0x20, 0x1e, 0x01, 0xa9, 0x01, 0x20,
+  0x1f, 0x01, 0xaa, 0x01, 0x20, 0x20, 0x01, 0xab, 0x01, 0x20, 0x21, 0x01,
+  0xac, 0x01, 0x20, 0x22, 0x01, 0xad, 0x01, 0x20, 0x23, 0x01, 0xae, 0x01,
+  0x20, 0x24, 0x01, 0xaf, 0x01, 0x20, 0x25, 0x01, 0xb0, 0x01, 0x20, 0x26,
+  0x01, 0xb1, 0x01, 0x20, 0x27, 0x01, 0xb2, 0x01, 0x20, 0x28, 0x01, 0xb3,
+  0x01, 0x20, 0x29, 0x01, 0xb4, 0x01, 0x20, 0x2a, 0x01, 0xb5, 0x01, 0x20,
+  0x2b, 0x01, 0xb6, 0x01, 0x20, 0x2c, 0x01, 0xb7, 0x01, 0x20, 0x2d, 0x01,
+  0xb8, 0x01, 0x20, 0x2e, 0x01, 0xb9, 0x01, 0x20, 0x2f, 0x01, 0xba, 0x01,
+  0x20, 0x30, 0x01, 0xbb, 0x01, 0x20, 0x31, 0x01, 0xbc, 0x01, 0x20, 0x32,
+  0x01, 0xbd, 0x01, 0x20, 0x33, 0x01, 0xbe, 0x01, 0x20, 0x34, 0x01, 0xbf,
+  0x01, 0x20, 0x35, 0x01, 0xc0, 0x01, 0x20, 0x36, 0x01, 0xc1, 0x01, 0x20,
+  0x37, 0x01, 0xc2, 0x01, 0x20, 0x38, 0x01, 0xc3, 0x01, 0x20, 0x39, 0x01,
+  0xc4, 0x01, 0x00, 0x21, 0xa5, 0x00, 0x00, 0x00, 0x3d, 0x01, 0x04, 0x07,
+  0x0a, 0x20, 0x3b, 0x01, 0x00, 0x20, 0x3c, 0x01, 0x01, 0x00, 0x21, 0xa5,
+  0x00, 0x00, 0x00, 0x41, 0x01, 0x04, 0x02, 0x09, 0x20, 0x3e, 0x01, 0x00,
+  0x20, 0x3f, 0x01, 0x01, 0x20, 0x40, 0x01, 0x02, 0x00, 0x1e, 0x11, 0x01,
+  0x00, 0x00, 0x08, 0x06, 0x3e, 0x15, 0x20, 0x42, 0x01, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0x20, 0x43, 0x01, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x20, 0x44,
+  0x01, 0x80, 0x80, 0x80, 0x80, 0xf0, 0xff, 0xff, 0x07, 0x00, 0x0f, 0xa3,
+  0x0a, 0x00, 0x00, 0x22, 0x5e, 0x01, 0x38, 0x03, 0x3b, 0x23, 0x45, 0x01,
+  0x9e, 0x0a, 0x00, 0x00, 0x03, 0x3c, 0x00, 0x23, 0x46, 0x01, 0x20, 0x0b,
+  0x00, 0x00, 0x03, 0x3d, 0x08, 0x23, 0x55, 0x01, 0xc4, 0x0b, 0x00, 0x00,
+  0x03, 0x3e, 0x10, 0x07, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x3f, 0x18,
+  0x07, 0x15, 0x25, 0x01, 0x00, 0x00, 0x03, 0x40, 0x1c, 0x23, 0x58, 0x01,
+  0x25, 0x01, 0x00, 0x00, 0x03, 0x41, 0x1e, 0x23, 0x59, 0x01, 0x25, 0x01,
+  0x00, 0x00, 0x03, 0x42, 0x20, 0x23, 0x5a, 0x01, 0xf2, 0x0b, 0x00, 0x00,
+  0x03, 0x43, 0x28, 0x23, 0x5b, 0x01, 0x01, 0x0b, 0x00, 0x00, 0x03, 0x48,
+  0x30, 0x0e, 0x04, 0x03, 0x44, 0x23, 0x5c, 0x01, 0x0f, 0x0b, 0x00, 0x00,
+  0x03, 0x47, 0x00, 0x0e, 0x04, 0x03, 0x45, 0x23, 0x5d, 0x01, 0x95, 0x01,
+  0x00, 0x00, 0x03, 0x46, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x25, 0x0b, 0x00,
+  0x00, 0x22, 0x54, 0x01, 0x10, 0x03, 0x36, 0x23, 0x47, 0x01, 0x40, 0x0b,
+  0x00, 0x00, 0x03, 0x37, 0x00, 0x23, 0x4e, 0x01, 0x87, 0x0b, 0x00, 0x00,
+  0x03, 0x38, 0x08, 0x00, 0x22, 0x4d, 0x01, 0x08, 0x03, 0x30, 0x23, 0x48,
+  0x01, 0x50, 0x0b, 0x00, 0x00, 0x03, 0x33, 0x00, 0x0e, 0x08, 0x03, 0x31,
+  0x23, 0x49, 0x01, 0x60, 0x0b, 0x00, 0x00, 0x03, 0x32, 0x00, 0x00, 0x00,
+  0x0f, 0x65, 0x0b, 0x00, 0x00, 0x22, 0x49, 0x01, 0x04, 0x03, 0x19, 0x23,
+  0x4a, 0x01, 0x76, 0x0b, 0x00, 0x00, 0x03, 0x1a, 0x00, 0x00, 0x22, 0x4c,
+  0x01, 0x04, 0x03, 0x15, 0x23, 0x4b, 0x01, 0xa5, 0x00, 0x00, 0x00, 0x03,
+  0x16, 0x00, 0x00, 0x22, 0x53, 0x01, 0x08, 0x03, 0x2c, 0x23, 0x4f, 0x01,
+  0x98, 0x0b, 0x00, 0x00, 0x03, 0x2d, 0x00, 0x00, 0x0f, 0x9d, 0x0b, 0x00,
+  0x00, 0x22, 0x4f, 0x01, 0x08, 0x03, 0x28, 0x23, 0x50, 0x01, 0xae, 0x0b,
+  0x00, 0x00, 0x03, 0x29, 0x00, 0x00, 0x0f, 0xb3, 0x0b, 0x00, 0x00, 0x22,
+  0x52, 0x01, 0x08, 0x03, 0x24, 0x23, 0x51, 0x01, 0x09, 0x01, 0x00, 0x00,
+  0x03, 0x25, 0x00, 0x00, 0x0f, 0xc9, 0x0b, 0x00, 0x00, 0x22, 0x57, 0x01,
+  0x10, 0x03, 0x1d, 0x07, 0x11, 0x95, 0x01, 0x00, 0x00, 0x03, 0x1e, 0x00,
+  0x23, 0x56, 0x01, 0xe2, 0x0b, 0x00, 0x00, 0x03, 0x21, 0x08, 0x0e, 0x08,
+  0x03, 0x1f, 0x23, 0x49, 0x01, 0x60, 0x0b, 0x00, 0x00, 0x03, 0x20, 0x00,
+  0x00, 0x00, 0x0f, 0x39, 0x01, 0x00, 0x00, 0x0f, 0xfc, 0x0b, 0x00, 0x00,
+  0x22, 0x60, 0x01, 0x10, 0x02, 0x7f, 0x23, 0x5f, 0x01, 0x09, 0x01, 0x00,
+  0x00, 0x02, 0x80, 0x00, 0x07, 0x48, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x82,
+  0x08, 0x07, 0x33, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x83, 0x0c, 0x00, 0x24,
+  0x61, 0x01, 0x03, 0x86, 0x03, 0x95, 0x01, 0x00, 0x00, 0x25, 0x40, 0x03,
+  0x86, 0x03, 0x9e, 0x0a, 0x00, 0x00, 0x25, 0x48, 0x03, 0x86, 0x03, 0x9d,
+  0x00, 0x00, 0x00, 0x26, 0x28, 0x03, 0x8a, 0x03, 0xa5, 0x04, 0x00, 0x00,
+  0x27, 0x62, 0x01, 0x03, 0x88, 0x03, 0x09, 0x01, 0x00, 0x00, 0x27, 0x63,
+  0x01, 0x03, 0x89, 0x03, 0x59, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x4e, 0x00,
+  0x00, 0x00, 0x28, 0x0d, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xae, 0x01,
+  0x03, 0xd3, 0x03, 0x95, 0x01, 0x00, 0x00, 0x29, 0x00, 0x65, 0x01, 0x03,
+  0xd3, 0x03, 0xc2, 0x20, 0x00, 0x00, 0x2a, 0x1f, 0x0c, 0x00, 0x00, 0x00,
+  0x03, 0xd3, 0x03, 0x01, 0x2b, 0x01, 0x56, 0x29, 0x0c, 0x00, 0x00, 0x2c,
+  0x00, 0x32, 0x0c, 0x00, 0x00, 0x2d, 0x02, 0x91, 0x00, 0x3b, 0x0c, 0x00,
+  0x00, 0x2e, 0x01, 0x44, 0x0c, 0x00, 0x00, 0x00, 0x2f, 0xa7, 0x0c, 0x00,
+  0x00, 0x0e, 0x00, 0x30, 0x66, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x5a, 0xcd,
+  0x01, 0x03, 0xfd, 0x02, 0xc3, 0x1a, 0x00, 0x00, 0x31, 0x96, 0x01, 0x40,
+  0x03, 0xfd, 0x02, 0x9e, 0x0a, 0x00, 0x00, 0x29, 0x98, 0x01, 0x63, 0x01,
+  0x03, 0xfd, 0x02, 0x59, 0x0c, 0x00, 0x00, 0x26, 0x04, 0x03, 0xff, 0x02,
+  0x9d, 0x00, 0x00, 0x00, 0x32, 0x0f, 0x33, 0x97, 0x01, 0x78, 0x01, 0x03,
+  0x01, 0x03, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x35, 0x1e, 0x00, 0x00,
+  0x10, 0x03, 0x06, 0x03, 0x0a, 0x34, 0x99, 0x01, 0x3f, 0x1e, 0x00, 0x00,
+  0x2e, 0xa6, 0x01, 0x52, 0x1e, 0x00, 0x00, 0x35, 0x67, 0x58, 0x00, 0x00,
+  0x00, 0x2e, 0x9b, 0x01, 0x66, 0x1e, 0x00, 0x00, 0x35, 0x67, 0x50, 0x00,
+  0x00, 0x00, 0x2e, 0x9a, 0x01, 0x71, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x36,
+  0x99, 0x1e, 0x00, 0x00, 0x68, 0x10, 0x01, 0x00, 0x00, 0x03, 0xe6, 0x02,
+  0x18, 0x2b, 0x01, 0x58, 0xa3, 0x1e, 0x00, 0x00, 0x2e, 0x9e, 0x01, 0xac,
+  0x1e, 0x00, 0x00, 0x35, 0x68, 0x58, 0x00, 0x00, 0x00, 0x2e, 0x9d, 0x01,
+  0xb7, 0x1e, 0x00, 0x00, 0x35, 0x68, 0x50, 0x00, 0x00, 0x00, 0x2e, 0x9c,
+  0x01, 0xc2, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x35, 0x69, 0x58, 0x00, 0x00,
+  0x00, 0x2e, 0xa0, 0x01, 0xcf, 0x1e, 0x00, 0x00, 0x35, 0x69, 0x50, 0x00,
+  0x00, 0x00, 0x2e, 0x9f, 0x01, 0xda, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x35,
+  0x6a, 0x18, 0x00, 0x00, 0x00, 0x2e, 0xa1, 0x01, 0xe7, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x36, 0xf3, 0x1e, 0x00, 0x00, 0x6b, 0xf8, 0x00, 0x00, 0x00,
+  0x03, 0xea, 0x02, 0x1c, 0x2b, 0x01, 0x58, 0xfd, 0x1e, 0x00, 0x00, 0x2e,
+  0xa3, 0x01, 0x06, 0x1f, 0x00, 0x00, 0x35, 0x6b, 0x30, 0x00, 0x00, 0x00,
+  0x2e, 0xa2, 0x01, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x35, 0x6c, 0x90, 0x00,
+  0x00, 0x00, 0x2e, 0xa5, 0x01, 0x1d, 0x1f, 0x00, 0x00, 0x35, 0x6c, 0x88,
+  0x00, 0x00, 0x00, 0x2e, 0xa4, 0x01, 0x28, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x35, 0x6d, 0x20, 0x00, 0x00, 0x00, 0x2e, 0xa7, 0x01, 0x7e, 0x1e,
+  0x00, 0x00, 0x00, 0x36, 0x35, 0x1f, 0x00, 0x00, 0x6e, 0x30, 0x07, 0x00,
+  0x00, 0x03, 0xf9, 0x02, 0x14, 0x34, 0xac, 0x01, 0x3f, 0x1f, 0x00, 0x00,
+  0x2b, 0x01, 0x59, 0x48, 0x1f, 0x00, 0x00, 0x2d, 0x03, 0x91, 0xc8, 0x00,
+  0x5b, 0x1f, 0x00, 0x00, 0x2d, 0x03, 0x91, 0xd0, 0x00, 0x65, 0x1f, 0x00,
+  0x00, 0x2d, 0x03, 0x91, 0xd0, 0x00, 0x6f, 0x1f, 0x00, 0x00, 0x2e, 0xa9,
+  0x01, 0x79, 0x1f, 0x00, 0x00, 0x2e, 0xaa, 0x01, 0x82, 0x1f, 0x00, 0x00,
+  0x2e, 0xab, 0x01, 0x8b, 0x1f, 0x00, 0x00, 0x2e, 0xae, 0x01, 0x95, 0x1f,
+  0x00, 0x00, 0x37, 0x9f, 0x1f, 0x00, 0x00, 0x2e, 0xaf, 0x01, 0xa9, 0x1f,
+  0x00, 0x00, 0x2e, 0xb0, 0x01, 0xb3, 0x1f, 0x00, 0x00, 0x35, 0x6e, 0x40,
+  0x00, 0x00, 0x00, 0x2e, 0xa8, 0x01, 0xbd, 0x1f, 0x00, 0x00, 0x00, 0x35,
+  0x6f, 0x28, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x01, 0xc9, 0x1f, 0x00, 0x00,
+  0x00, 0x36, 0x8a, 0x20, 0x00, 0x00, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x03,
+  0xb3, 0x02, 0x0a, 0x34, 0xb1, 0x01, 0x94, 0x20, 0x00, 0x00, 0x2b, 0x0d,
+  0x74, 0x00, 0xa8, 0xb9, 0x80, 0x80, 0x00, 0xa8, 0xbe, 0x80, 0x80, 0x00,
+  0x9f, 0xa8, 0x20, 0x00, 0x00, 0x00, 0x36, 0x8a, 0x20, 0x00, 0x00, 0x71,
+  0xd8, 0x00, 0x00, 0x00, 0x03, 0xb8, 0x02, 0x0a, 0x34, 0xb3, 0x01, 0x94,
+  0x20, 0x00, 0x00, 0x34, 0xb2, 0x01, 0xa8, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0x0f, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xaf, 0x01,
+  0x03, 0xd3, 0x03, 0x95, 0x01, 0x00, 0x00, 0x29, 0x02, 0x65, 0x01, 0x03,
+  0xd3, 0x03, 0xc2, 0x20, 0x00, 0x00, 0x2f, 0xc1, 0x0e, 0x00, 0x00, 0x10,
+  0x00, 0x30, 0x11, 0x98, 0x03, 0x00, 0x00, 0x01, 0x5a, 0xb0, 0x01, 0x03,
+  0x9d, 0x03, 0x95, 0x01, 0x00, 0x00, 0x29, 0x03, 0x65, 0x01, 0x03, 0x9d,
+  0x03, 0xd3, 0x05, 0x00, 0x00, 0x29, 0x04, 0x66, 0x01, 0x03, 0x9d, 0x03,
+  0x9e, 0x0a, 0x00, 0x00, 0x31, 0x05, 0x48, 0x03, 0x9d, 0x03, 0x9d, 0x00,
+  0x00, 0x00, 0x38, 0x02, 0x91, 0x10, 0x28, 0x03, 0xa1, 0x03, 0xa5, 0x04,
+  0x00, 0x00, 0x33, 0x06, 0x62, 0x01, 0x03, 0x9f, 0x03, 0xad, 0x02, 0x00,
+  0x00, 0x33, 0x07, 0x67, 0x01, 0x03, 0x9f, 0x03, 0x09, 0x01, 0x00, 0x00,
+  0x27, 0x63, 0x01, 0x03, 0xa0, 0x03, 0x59, 0x0c, 0x00, 0x00, 0x32, 0x01,
+  0x33, 0x08, 0xe4, 0x01, 0x03, 0xb4, 0x03, 0x95, 0x01, 0x00, 0x00, 0x35,
+  0x12, 0x28, 0x00, 0x00, 0x00, 0x33, 0x09, 0x78, 0x01, 0x03, 0xbb, 0x03,
+  0x9e, 0x0a, 0x00, 0x00, 0x00, 0x2a, 0x99, 0x0f, 0x00, 0x00, 0x02, 0x03,
+  0xb5, 0x03, 0x05, 0x2b, 0x02, 0x91, 0x00, 0x9f, 0x0f, 0x00, 0x00, 0x2b,
+  0x01, 0x58, 0xa9, 0x0f, 0x00, 0x00, 0x2b, 0x02, 0x91, 0x08, 0xb3, 0x0f,
+  0x00, 0x00, 0x2b, 0x01, 0x56, 0xbd, 0x0f, 0x00, 0x00, 0x2d, 0x02, 0x91,
+  0x20, 0xd0, 0x0f, 0x00, 0x00, 0x2e, 0x0a, 0xda, 0x0f, 0x00, 0x00, 0x2e,
+  0x0b, 0xe4, 0x0f, 0x00, 0x00, 0x2e, 0x0c, 0xed, 0x0f, 0x00, 0x00, 0x2e,
+  0x0e, 0xf7, 0x0f, 0x00, 0x00, 0x2a, 0x89, 0x10, 0x00, 0x00, 0x03, 0x03,
+  0x65, 0x03, 0x0a, 0x2e, 0x0d, 0x93, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x39, 0x64, 0x01, 0x03, 0x5a, 0x03, 0x3a, 0x65, 0x01, 0x03, 0x5a,
+  0x03, 0xd3, 0x05, 0x00, 0x00, 0x3a, 0x66, 0x01, 0x03, 0x5a, 0x03, 0x9e,
+  0x0a, 0x00, 0x00, 0x3a, 0x67, 0x01, 0x03, 0x5a, 0x03, 0x09, 0x01, 0x00,
+  0x00, 0x25, 0x48, 0x03, 0x5a, 0x03, 0x9d, 0x00, 0x00, 0x00, 0x3a, 0x63,
+  0x01, 0x03, 0x5b, 0x03, 0x59, 0x0c, 0x00, 0x00, 0x27, 0x68, 0x01, 0x03,
+  0x60, 0x03, 0x02, 0x10, 0x00, 0x00, 0x27, 0x6e, 0x01, 0x03, 0x5d, 0x03,
+  0x31, 0x01, 0x00, 0x00, 0x26, 0x28, 0x03, 0x5f, 0x03, 0x09, 0x01, 0x00,
+  0x00, 0x27, 0x6f, 0x01, 0x03, 0x61, 0x03, 0xf7, 0x0b, 0x00, 0x00, 0x27,
+  0x70, 0x01, 0x03, 0x5e, 0x03, 0xf4, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x6d,
+  0x01, 0x30, 0x03, 0x50, 0x03, 0x3c, 0x69, 0x01, 0x21, 0x10, 0x00, 0x00,
+  0x03, 0x51, 0x03, 0x08, 0x00, 0x3d, 0x6c, 0x01, 0x7d, 0x10, 0x00, 0x00,
+  0x03, 0x52, 0x03, 0x00, 0x00, 0x3e, 0x6b, 0x01, 0x20, 0x02, 0x6e, 0x08,
+  0x07, 0x2f, 0x09, 0x01, 0x00, 0x00, 0x02, 0x6f, 0x00, 0x07, 0x30, 0x09,
+  0x01, 0x00, 0x00, 0x02, 0x70, 0x08, 0x07, 0x2a, 0x09, 0x01, 0x00, 0x00,
+  0x02, 0x72, 0x10, 0x07, 0x36, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x74, 0x18,
+  0x07, 0x38, 0x25, 0x01, 0x00, 0x00, 0x02, 0x75, 0x1c, 0x07, 0x22, 0x31,
+  0x01, 0x00, 0x00, 0x02, 0x76, 0x1e, 0x07, 0x09, 0x31, 0x01, 0x00, 0x00,
+  0x02, 0x77, 0x1f, 0x23, 0x6a, 0x01, 0x72, 0x10, 0x00, 0x00, 0x02, 0x79,
+  0x20, 0x00, 0x0a, 0x31, 0x01, 0x00, 0x00, 0x3f, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x0a, 0x31, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x30,
+  0x00, 0x24, 0x71, 0x01, 0x03, 0x69, 0x01, 0xf4, 0x01, 0x00, 0x00, 0x27,
+  0x72, 0x01, 0x03, 0x6b, 0x01, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x28, 0x13,
+  0xc8, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb1, 0x01, 0x03, 0xd4, 0x03, 0x95,
+  0x01, 0x00, 0x00, 0x29, 0x0f, 0x65, 0x01, 0x03, 0xd4, 0x03, 0xc2, 0x20,
+  0x00, 0x00, 0x2a, 0x1f, 0x0c, 0x00, 0x00, 0x04, 0x03, 0xd4, 0x03, 0x01,
+  0x2b, 0x01, 0x56, 0x29, 0x0c, 0x00, 0x00, 0x2c, 0x01, 0x32, 0x0c, 0x00,
+  0x00, 0x2d, 0x02, 0x91, 0x00, 0x3b, 0x0c, 0x00, 0x00, 0x2e, 0x10, 0x44,
+  0x0c, 0x00, 0x00, 0x00, 0x2f, 0xa7, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x28,
+  0x15, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb2, 0x01, 0x03, 0xd4, 0x03,
+  0x95, 0x01, 0x00, 0x00, 0x29, 0x11, 0x65, 0x01, 0x03, 0xd4, 0x03, 0xc2,
+  0x20, 0x00, 0x00, 0x2f, 0xc1, 0x0e, 0x00, 0x00, 0x16, 0x00, 0x28, 0x17,
+  0xc8, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb3, 0x01, 0x03, 0xd5, 0x03, 0x95,
+  0x01, 0x00, 0x00, 0x29, 0x12, 0x65, 0x01, 0x03, 0xd5, 0x03, 0xc2, 0x20,
+  0x00, 0x00, 0x2a, 0x1f, 0x0c, 0x00, 0x00, 0x05, 0x03, 0xd5, 0x03, 0x01,
+  0x2b, 0x01, 0x56, 0x29, 0x0c, 0x00, 0x00, 0x2c, 0x02, 0x32, 0x0c, 0x00,
+  0x00, 0x2d, 0x02, 0x91, 0x00, 0x3b, 0x0c, 0x00, 0x00, 0x2e, 0x13, 0x44,
+  0x0c, 0x00, 0x00, 0x00, 0x2f, 0xa7, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x28,
+  0x19, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb4, 0x01, 0x03, 0xd5, 0x03,
+  0x95, 0x01, 0x00, 0x00, 0x29, 0x14, 0x65, 0x01, 0x03, 0xd5, 0x03, 0xc2,
+  0x20, 0x00, 0x00, 0x2f, 0xc1, 0x0e, 0x00, 0x00, 0x1a, 0x00, 0x28, 0x1b,
+  0xc8, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb5, 0x01, 0x03, 0xd6, 0x03, 0x95,
+  0x01, 0x00, 0x00, 0x29, 0x15, 0x65, 0x01, 0x03, 0xd6, 0x03, 0xc2, 0x20,
+  0x00, 0x00, 0x2a, 0x1f, 0x0c, 0x00, 0x00, 0x06, 0x03, 0xd6, 0x03, 0x01,
+  0x2b, 0x01, 0x56, 0x29, 0x0c, 0x00, 0x00, 0x2c, 0x03, 0x32, 0x0c, 0x00,
+  0x00, 0x2d, 0x02, 0x91, 0x00, 0x3b, 0x0c, 0x00, 0x00, 0x2e, 0x16, 0x44,
+  0x0c, 0x00, 0x00, 0x00, 0x2f, 0xa7, 0x0c, 0x00, 0x00, 0x1c, 0x00, 0x28,
+  0x1d, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb6, 0x01, 0x03, 0xd6, 0x03,
+  0x95, 0x01, 0x00, 0x00, 0x29, 0x17, 0x65, 0x01, 0x03, 0xd6, 0x03, 0xc2,
+  0x20, 0x00, 0x00, 0x2f, 0xc1, 0x0e, 0x00, 0x00, 0x1e, 0x00, 0x28, 0x1f,
+  0xc8, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb7, 0x01, 0x03, 0xd7, 0x03, 0x95,
+  0x01, 0x00, 0x00, 0x29, 0x18, 0x65, 0x01, 0x03, 0xd7, 0x03, 0xc2, 0x20,
+  0x00, 0x00, 0x2a, 0x1f, 0x0c, 0x00, 0x00, 0x07, 0x03, 0xd7, 0x03, 0x01,
+  0x2b, 0x01, 0x56, 0x29, 0x0c, 0x00, 0x00, 0x2c, 0x04, 0x32, 0x0c, 0x00,
+  0x00, 0x2d, 0x02, 0x91, 0x00, 0x3b, 0x0c, 0x00, 0x00, 0x2e, 0x19, 0x44,
+  0x0c, 0x00, 0x00, 0x00, 0x2f, 0xa7, 0x0c, 0x00, 0x00, 0x20, 0x00, 0x28,
+  0x21, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xb8, 0x01, 0x03, 0xd7, 0x03,
+  0x95, 0x01, 0x00, 0x00, 0x29, 0x1a, 0x65, 0x01, 0x03, 0xd7, 0x03, 0xc2,
+  0x20, 0x00, 0x00, 0x2f, 0xc1, 0x0e, 0x00, 0x00, 0x22, 0x00, 0x24, 0x73,
+  0x01, 0x03, 0x0b, 0x04, 0x95, 0x01, 0x00, 0x00, 0x25, 0x40, 0x03, 0x0b,
+  0x04, 0x9e, 0x0a, 0x00, 0x00, 0x25, 0x32, 0x03, 0x0b, 0x04, 0x31, 0x01,
+  0x00, 0x00, 0x27, 0x74, 0x01, 0x03, 0x0f, 0x04, 0xc7, 0x03, 0x00, 0x00,
+  0x26, 0x28, 0x03, 0x10, 0x04, 0x09, 0x01, 0x00, 0x00, 0x27, 0x75, 0x01,
+  0x03, 0x0f, 0x04, 0xc2, 0x03, 0x00, 0x00, 0x27, 0x76, 0x01, 0x03, 0x0d,
+  0x04, 0x9d, 0x00, 0x00, 0x00, 0x27, 0x77, 0x01, 0x03, 0x0e, 0x04, 0xa8,
+  0x12, 0x00, 0x00, 0x40, 0x27, 0x78, 0x01, 0x03, 0x31, 0x04, 0x95, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xf4, 0x03, 0x00, 0x00, 0x24, 0x79, 0x01,
+  0x03, 0xde, 0x03, 0x09, 0x01, 0x00, 0x00, 0x26, 0x47, 0x03, 0xe0, 0x03,
+  0x09, 0x01, 0x00, 0x00, 0x00, 0x28, 0x23, 0xb0, 0x02, 0x00, 0x00, 0x01,
+  0x5a, 0xb9, 0x01, 0x03, 0x69, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x1b,
+  0x65, 0x01, 0x03, 0x69, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x36, 0x4e, 0x12,
+  0x00, 0x00, 0x24, 0x90, 0x02, 0x00, 0x00, 0x03, 0x69, 0x04, 0x01, 0x34,
+  0x1c, 0x58, 0x12, 0x00, 0x00, 0x2c, 0x01, 0x61, 0x12, 0x00, 0x00, 0x2d,
+  0x02, 0x91, 0x10, 0x6a, 0x12, 0x00, 0x00, 0x2e, 0x1e, 0x74, 0x12, 0x00,
+  0x00, 0x2e, 0x1f, 0x7d, 0x12, 0x00, 0x00, 0x2e, 0x20, 0x87, 0x12, 0x00,
+  0x00, 0x2e, 0x21, 0x91, 0x12, 0x00, 0x00, 0x36, 0xad, 0x12, 0x00, 0x00,
+  0x25, 0x38, 0x00, 0x00, 0x00, 0x03, 0x10, 0x04, 0x12, 0x2e, 0x1d, 0xb7,
+  0x12, 0x00, 0x00, 0x00, 0x35, 0x26, 0x30, 0x00, 0x00, 0x00, 0x2e, 0x22,
+  0x9c, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x27, 0x18, 0x00, 0x00,
+  0x00, 0x01, 0x5a, 0xba, 0x01, 0x03, 0x69, 0x04, 0x95, 0x01, 0x00, 0x00,
+  0x29, 0x23, 0x65, 0x01, 0x03, 0x69, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x2f,
+  0x5e, 0x13, 0x00, 0x00, 0x28, 0x00, 0x30, 0x29, 0x98, 0x03, 0x00, 0x00,
+  0x01, 0x5a, 0xbb, 0x01, 0x03, 0x38, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29,
+  0x24, 0x65, 0x01, 0x03, 0x38, 0x04, 0xd3, 0x05, 0x00, 0x00, 0x41, 0x26,
+  0x28, 0x03, 0x3d, 0x04, 0x09, 0x01, 0x00, 0x00, 0x33, 0x27, 0x75, 0x01,
+  0x03, 0x3c, 0x04, 0xc2, 0x03, 0x00, 0x00, 0x33, 0x28, 0x76, 0x01, 0x03,
+  0x3a, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x33, 0x29, 0x77, 0x01, 0x03, 0x3b,
+  0x04, 0xa8, 0x12, 0x00, 0x00, 0x27, 0x63, 0x01, 0x03, 0x3e, 0x04, 0x59,
+  0x0c, 0x00, 0x00, 0x36, 0xad, 0x12, 0x00, 0x00, 0x2a, 0x38, 0x00, 0x00,
+  0x00, 0x03, 0x3d, 0x04, 0x12, 0x2e, 0x25, 0xb7, 0x12, 0x00, 0x00, 0x00,
+  0x36, 0x2e, 0x14, 0x00, 0x00, 0x2b, 0x30, 0x02, 0x00, 0x00, 0x03, 0x54,
+  0x04, 0x05, 0x34, 0x2b, 0x34, 0x14, 0x00, 0x00, 0x34, 0x2a, 0x3e, 0x14,
+  0x00, 0x00, 0x34, 0x2c, 0x50, 0x14, 0x00, 0x00, 0x2e, 0x2d, 0x5a, 0x14,
+  0x00, 0x00, 0x36, 0x65, 0x14, 0x00, 0x00, 0x2c, 0x28, 0x01, 0x00, 0x00,
+  0x03, 0x04, 0x04, 0x05, 0x34, 0x2f, 0x6b, 0x14, 0x00, 0x00, 0x34, 0x2e,
+  0x75, 0x14, 0x00, 0x00, 0x2e, 0x30, 0x89, 0x14, 0x00, 0x00, 0x2e, 0x31,
+  0x93, 0x14, 0x00, 0x00, 0x2e, 0x33, 0x9d, 0x14, 0x00, 0x00, 0x36, 0x89,
+  0x10, 0x00, 0x00, 0x2d, 0x30, 0x00, 0x00, 0x00, 0x03, 0xe8, 0x01, 0x0e,
+  0x2e, 0x32, 0x93, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x7a,
+  0x01, 0x03, 0xf0, 0x03, 0x3a, 0x65, 0x01, 0x03, 0xf0, 0x03, 0xd3, 0x05,
+  0x00, 0x00, 0x25, 0x2f, 0x03, 0xf0, 0x03, 0x09, 0x01, 0x00, 0x00, 0x25,
+  0x32, 0x03, 0xf0, 0x03, 0x31, 0x01, 0x00, 0x00, 0x3a, 0x63, 0x01, 0x03,
+  0xf1, 0x03, 0x59, 0x0c, 0x00, 0x00, 0x27, 0x7b, 0x01, 0x03, 0xf3, 0x03,
+  0xb2, 0x02, 0x00, 0x00, 0x00, 0x39, 0x7c, 0x01, 0x03, 0xd7, 0x01, 0x3a,
+  0x65, 0x01, 0x03, 0xd7, 0x01, 0xd3, 0x05, 0x00, 0x00, 0x3a, 0x7b, 0x01,
+  0x03, 0xd7, 0x01, 0xb2, 0x02, 0x00, 0x00, 0x3a, 0x63, 0x01, 0x03, 0xd8,
+  0x01, 0x59, 0x0c, 0x00, 0x00, 0x27, 0x76, 0x01, 0x03, 0xdc, 0x01, 0x9d,
+  0x00, 0x00, 0x00, 0x27, 0x7d, 0x01, 0x03, 0xda, 0x01, 0x09, 0x01, 0x00,
+  0x00, 0x27, 0x70, 0x01, 0x03, 0xdb, 0x01, 0xf4, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x2e, 0xb0, 0x02, 0x00, 0x00, 0x01, 0x5a, 0xbc, 0x01, 0x03, 0x6a,
+  0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x34, 0x65, 0x01, 0x03, 0x6a, 0x04,
+  0xc2, 0x20, 0x00, 0x00, 0x36, 0x4e, 0x12, 0x00, 0x00, 0x2f, 0x90, 0x02,
+  0x00, 0x00, 0x03, 0x6a, 0x04, 0x01, 0x34, 0x35, 0x58, 0x12, 0x00, 0x00,
+  0x2c, 0x01, 0x61, 0x12, 0x00, 0x00, 0x2d, 0x02, 0x91, 0x10, 0x6a, 0x12,
+  0x00, 0x00, 0x2e, 0x37, 0x74, 0x12, 0x00, 0x00, 0x2e, 0x38, 0x7d, 0x12,
+  0x00, 0x00, 0x2e, 0x39, 0x87, 0x12, 0x00, 0x00, 0x2e, 0x3a, 0x91, 0x12,
+  0x00, 0x00, 0x36, 0xad, 0x12, 0x00, 0x00, 0x30, 0x38, 0x00, 0x00, 0x00,
+  0x03, 0x10, 0x04, 0x12, 0x2e, 0x36, 0xb7, 0x12, 0x00, 0x00, 0x00, 0x35,
+  0x31, 0x30, 0x00, 0x00, 0x00, 0x2e, 0x3b, 0x9c, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0x32, 0x18, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xbd, 0x01,
+  0x03, 0x6a, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x3c, 0x65, 0x01, 0x03,
+  0x6a, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x2f, 0x5e, 0x13, 0x00, 0x00, 0x33,
+  0x00, 0x28, 0x34, 0xb0, 0x02, 0x00, 0x00, 0x01, 0x5a, 0xbe, 0x01, 0x03,
+  0x6b, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x3d, 0x65, 0x01, 0x03, 0x6b,
+  0x04, 0xc2, 0x20, 0x00, 0x00, 0x36, 0x4e, 0x12, 0x00, 0x00, 0x35, 0x90,
+  0x02, 0x00, 0x00, 0x03, 0x6b, 0x04, 0x01, 0x34, 0x3e, 0x58, 0x12, 0x00,
+  0x00, 0x2c, 0x01, 0x61, 0x12, 0x00, 0x00, 0x2d, 0x02, 0x91, 0x10, 0x6a,
+  0x12, 0x00, 0x00, 0x2e, 0x40, 0x74, 0x12, 0x00, 0x00, 0x2e, 0x41, 0x7d,
+  0x12, 0x00, 0x00, 0x2e, 0x42, 0x87, 0x12, 0x00, 0x00, 0x2e, 0x43, 0x91,
+  0x12, 0x00, 0x00, 0x36, 0xad, 0x12, 0x00, 0x00, 0x36, 0x38, 0x00, 0x00,
+  0x00, 0x03, 0x10, 0x04, 0x12, 0x2e, 0x3f, 0xb7, 0x12, 0x00, 0x00, 0x00,
+  0x35, 0x37, 0x30, 0x00, 0x00, 0x00, 0x2e, 0x44, 0x9c, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x38, 0x18, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xbf,
+  0x01, 0x03, 0x6b, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x45, 0x65, 0x01,
+  0x03, 0x6b, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x2f, 0x5e, 0x13, 0x00, 0x00,
+  0x39, 0x00, 0x28, 0x3a, 0xb0, 0x02, 0x00, 0x00, 0x01, 0x5a, 0xc0, 0x01,
+  0x03, 0x6c, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x46, 0x65, 0x01, 0x03,
+  0x6c, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x36, 0x4e, 0x12, 0x00, 0x00, 0x3b,
+  0x90, 0x02, 0x00, 0x00, 0x03, 0x6c, 0x04, 0x01, 0x34, 0x47, 0x58, 0x12,
+  0x00, 0x00, 0x2c, 0x00, 0x61, 0x12, 0x00, 0x00, 0x2d, 0x02, 0x91, 0x10,
+  0x6a, 0x12, 0x00, 0x00, 0x2e, 0x49, 0x74, 0x12, 0x00, 0x00, 0x2e, 0x4a,
+  0x7d, 0x12, 0x00, 0x00, 0x2e, 0x4b, 0x87, 0x12, 0x00, 0x00, 0x2e, 0x4c,
+  0x91, 0x12, 0x00, 0x00, 0x36, 0xad, 0x12, 0x00, 0x00, 0x3c, 0x38, 0x00,
+  0x00, 0x00, 0x03, 0x10, 0x04, 0x12, 0x2e, 0x48, 0xb7, 0x12, 0x00, 0x00,
+  0x00, 0x35, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x2e, 0x4d, 0x9c, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x3e, 0x18, 0x00, 0x00, 0x00, 0x01, 0x5a,
+  0xc1, 0x01, 0x03, 0x6c, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x4e, 0x65,
+  0x01, 0x03, 0x6c, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x2f, 0x5e, 0x13, 0x00,
+  0x00, 0x3f, 0x00, 0x28, 0x40, 0xb0, 0x02, 0x00, 0x00, 0x01, 0x5a, 0xc2,
+  0x01, 0x03, 0x6d, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x4f, 0x65, 0x01,
+  0x03, 0x6d, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x36, 0x4e, 0x12, 0x00, 0x00,
+  0x41, 0x90, 0x02, 0x00, 0x00, 0x03, 0x6d, 0x04, 0x01, 0x34, 0x50, 0x58,
+  0x12, 0x00, 0x00, 0x2c, 0x00, 0x61, 0x12, 0x00, 0x00, 0x2d, 0x02, 0x91,
+  0x10, 0x6a, 0x12, 0x00, 0x00, 0x2e, 0x52, 0x74, 0x12, 0x00, 0x00, 0x2e,
+  0x53, 0x7d, 0x12, 0x00, 0x00, 0x2e, 0x54, 0x87, 0x12, 0x00, 0x00, 0x2e,
+  0x55, 0x91, 0x12, 0x00, 0x00, 0x36, 0xad, 0x12, 0x00, 0x00, 0x42, 0x38,
+  0x00, 0x00, 0x00, 0x03, 0x10, 0x04, 0x12, 0x2e, 0x51, 0xb7, 0x12, 0x00,
+  0x00, 0x00, 0x35, 0x43, 0x40, 0x00, 0x00, 0x00, 0x2e, 0x56, 0x9c, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x44, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x5a, 0xc3, 0x01, 0x03, 0x6d, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x57,
+  0x65, 0x01, 0x03, 0x6d, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x2f, 0x5e, 0x13,
+  0x00, 0x00, 0x45, 0x00, 0x28, 0x46, 0xb0, 0x02, 0x00, 0x00, 0x01, 0x5a,
+  0xc4, 0x01, 0x03, 0x6e, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29, 0x58, 0x65,
+  0x01, 0x03, 0x6e, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x36, 0x4e, 0x12, 0x00,
+  0x00, 0x47, 0x90, 0x02, 0x00, 0x00, 0x03, 0x6e, 0x04, 0x01, 0x34, 0x59,
+  0x58, 0x12, 0x00, 0x00, 0x2c, 0x00, 0x61, 0x12, 0x00, 0x00, 0x2d, 0x02,
+  0x91, 0x10, 0x6a, 0x12, 0x00, 0x00, 0x2e, 0x5b, 0x74, 0x12, 0x00, 0x00,
+  0x2e, 0x5c, 0x7d, 0x12, 0x00, 0x00, 0x2e, 0x5d, 0x87, 0x12, 0x00, 0x00,
+  0x2e, 0x5e, 0x91, 0x12, 0x00, 0x00, 0x36, 0xad, 0x12, 0x00, 0x00, 0x48,
+  0x38, 0x00, 0x00, 0x00, 0x03, 0x10, 0x04, 0x12, 0x2e, 0x5a, 0xb7, 0x12,
+  0x00, 0x00, 0x00, 0x35, 0x49, 0x40, 0x00, 0x00, 0x00, 0x2e, 0x5f, 0x9c,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x4a, 0x18, 0x00, 0x00, 0x00,
+  0x01, 0x5a, 0xc5, 0x01, 0x03, 0x6e, 0x04, 0x95, 0x01, 0x00, 0x00, 0x29,
+  0x60, 0x65, 0x01, 0x03, 0x6e, 0x04, 0xc2, 0x20, 0x00, 0x00, 0x2f, 0x5e,
+  0x13, 0x00, 0x00, 0x4b, 0x00, 0x42, 0x4c, 0x28, 0x00, 0x00, 0x00, 0x01,
+  0x5a, 0xc6, 0x01, 0x00, 0x1d, 0x95, 0x01, 0x00, 0x00, 0x43, 0x61, 0x65,
+  0x01, 0x00, 0x1d, 0xc2, 0x20, 0x00, 0x00, 0x44, 0x62, 0x40, 0x00, 0x1d,
+  0x9e, 0x0a, 0x00, 0x00, 0x2f, 0xe3, 0x17, 0x00, 0x00, 0x4d, 0x00, 0x30,
+  0x4e, 0x88, 0x09, 0x00, 0x00, 0x01, 0x5a, 0xc7, 0x01, 0x03, 0x25, 0x03,
+  0x95, 0x01, 0x00, 0x00, 0x29, 0x63, 0x65, 0x01, 0x03, 0x25, 0x03, 0xd3,
+  0x05, 0x00, 0x00, 0x31, 0x64, 0x40, 0x03, 0x25, 0x03, 0x9e, 0x0a, 0x00,
+  0x00, 0x31, 0x65, 0x39, 0x03, 0x25, 0x03, 0x31, 0x01, 0x00, 0x00, 0x33,
+  0x66, 0x63, 0x01, 0x03, 0x27, 0x03, 0x59, 0x0c, 0x00, 0x00, 0x36, 0x89,
+  0x1a, 0x00, 0x00, 0x4f, 0xa8, 0x00, 0x00, 0x00, 0x03, 0x2a, 0x03, 0x0a,
+  0x2b, 0x01, 0x58, 0x93, 0x1a, 0x00, 0x00, 0x2b, 0x01, 0x56, 0x9c, 0x1a,
+  0x00, 0x00, 0x2e, 0x67, 0xaf, 0x1a, 0x00, 0x00, 0x2e, 0x68, 0xb9, 0x1a,
+  0x00, 0x00, 0x00, 0x36, 0xc8, 0x1a, 0x00, 0x00, 0x50, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0x33, 0x03, 0x05, 0x2b, 0x01, 0x57, 0xce, 0x1a, 0x00, 0x00,
+  0x2b, 0x01, 0x58, 0xd8, 0x1a, 0x00, 0x00, 0x2d, 0x02, 0x91, 0x10, 0xe1,
+  0x1a, 0x00, 0x00, 0x2e, 0x69, 0xea, 0x1a, 0x00, 0x00, 0x36, 0xf5, 0x1a,
+  0x00, 0x00, 0x51, 0x10, 0x00, 0x00, 0x00, 0x03, 0x32, 0x01, 0x12, 0x2b,
+  0x01, 0x57, 0xfe, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x36, 0x56, 0x1c, 0x00,
+  0x00, 0x52, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x38, 0x03, 0x0c, 0x2b, 0x01,
+  0x57, 0x60, 0x1c, 0x00, 0x00, 0x34, 0x7d, 0x73, 0x1c, 0x00, 0x00, 0x2e,
+  0x7c, 0x7d, 0x1c, 0x00, 0x00, 0x2e, 0x7e, 0x87, 0x1c, 0x00, 0x00, 0x2e,
+  0x7f, 0x91, 0x1c, 0x00, 0x00, 0x2a, 0xf5, 0x1a, 0x00, 0x00, 0x08, 0x03,
+  0x3c, 0x02, 0x08, 0x2b, 0x01, 0x57, 0xfe, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0x08, 0x1b, 0x00, 0x00, 0x09, 0x03, 0x3c, 0x03, 0x0c, 0x34, 0x6d,
+  0x12, 0x1b, 0x00, 0x00, 0x34, 0x6c, 0x1c, 0x1b, 0x00, 0x00, 0x34, 0x6b,
+  0x25, 0x1b, 0x00, 0x00, 0x2e, 0x6a, 0x38, 0x1b, 0x00, 0x00, 0x2e, 0x6e,
+  0x42, 0x1b, 0x00, 0x00, 0x2e, 0x6f, 0x4b, 0x1b, 0x00, 0x00, 0x2e, 0x70,
+  0x55, 0x1b, 0x00, 0x00, 0x2e, 0x71, 0x5e, 0x1b, 0x00, 0x00, 0x2e, 0x72,
+  0x68, 0x1b, 0x00, 0x00, 0x2e, 0x73, 0x72, 0x1b, 0x00, 0x00, 0x2e, 0x74,
+  0x7c, 0x1b, 0x00, 0x00, 0x36, 0xf5, 0x1a, 0x00, 0x00, 0x53, 0x20, 0x00,
+  0x00, 0x00, 0x03, 0x04, 0x02, 0x0d, 0x2b, 0x01, 0x57, 0xfe, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x2a, 0x96, 0x1b, 0x00, 0x00, 0x0a, 0x03, 0x45, 0x03,
+  0x0c, 0x34, 0x78, 0xa0, 0x1b, 0x00, 0x00, 0x34, 0x77, 0xaa, 0x1b, 0x00,
+  0x00, 0x34, 0x76, 0xb3, 0x1b, 0x00, 0x00, 0x2e, 0x79, 0xc6, 0x1b, 0x00,
+  0x00, 0x2e, 0x7a, 0xd0, 0x1b, 0x00, 0x00, 0x2e, 0x87, 0x01, 0xda, 0x1b,
+  0x00, 0x00, 0x2e, 0x89, 0x01, 0xe4, 0x1b, 0x00, 0x00, 0x45, 0xee, 0x1b,
+  0x00, 0x00, 0x72, 0x36, 0x89, 0x10, 0x00, 0x00, 0x54, 0x30, 0x00, 0x00,
+  0x00, 0x03, 0xa3, 0x01, 0x0a, 0x2e, 0x75, 0x93, 0x10, 0x00, 0x00, 0x00,
+  0x2a, 0x29, 0x1c, 0x00, 0x00, 0x0b, 0x03, 0xb0, 0x01, 0x05, 0x34, 0x7b,
+  0x2f, 0x1c, 0x00, 0x00, 0x2b, 0x01, 0x58, 0x39, 0x1c, 0x00, 0x00, 0x2b,
+  0x01, 0x56, 0x42, 0x1c, 0x00, 0x00, 0x2b, 0x01, 0x59, 0x4b, 0x1c, 0x00,
+  0x00, 0x36, 0xf5, 0x1a, 0x00, 0x00, 0x55, 0x10, 0x00, 0x00, 0x00, 0x03,
+  0x63, 0x01, 0x10, 0x2b, 0x01, 0x57, 0xfe, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0x29, 0x1c, 0x00, 0x00, 0x0c, 0x03, 0xc0, 0x01, 0x03, 0x34, 0x88,
+  0x01, 0x2f, 0x1c, 0x00, 0x00, 0x2b, 0x01, 0x58, 0x39, 0x1c, 0x00, 0x00,
+  0x2b, 0x01, 0x56, 0x42, 0x1c, 0x00, 0x00, 0x2b, 0x01, 0x59, 0x4b, 0x1c,
+  0x00, 0x00, 0x36, 0xf5, 0x1a, 0x00, 0x00, 0x56, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x63, 0x01, 0x10, 0x2b, 0x01, 0x57, 0xfe, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x36, 0x9c, 0x1c, 0x00, 0x00, 0x57, 0xa0, 0x01, 0x00, 0x00,
+  0x03, 0x48, 0x03, 0x0a, 0x2b, 0x01, 0x57, 0xa6, 0x1c, 0x00, 0x00, 0x2b,
+  0x01, 0x58, 0xb0, 0x1c, 0x00, 0x00, 0x34, 0x81, 0x01, 0xb9, 0x1c, 0x00,
+  0x00, 0x2d, 0x02, 0x91, 0x10, 0xcc, 0x1c, 0x00, 0x00, 0x2e, 0x82, 0x01,
+  0xd6, 0x1c, 0x00, 0x00, 0x2e, 0x86, 0x01, 0xe0, 0x1c, 0x00, 0x00, 0x36,
+  0x89, 0x10, 0x00, 0x00, 0x57, 0x30, 0x00, 0x00, 0x00, 0x03, 0x77, 0x01,
+  0x0a, 0x2e, 0x80, 0x01, 0x93, 0x10, 0x00, 0x00, 0x00, 0x2a, 0x29, 0x1c,
+  0x00, 0x00, 0x0d, 0x03, 0x7e, 0x01, 0x03, 0x34, 0x85, 0x01, 0x2f, 0x1c,
+  0x00, 0x00, 0x34, 0x84, 0x01, 0x39, 0x1c, 0x00, 0x00, 0x34, 0x83, 0x01,
+  0x4b, 0x1c, 0x00, 0x00, 0x36, 0xf5, 0x1a, 0x00, 0x00, 0x58, 0x10, 0x00,
+  0x00, 0x00, 0x03, 0x63, 0x01, 0x10, 0x2b, 0x01, 0x57, 0xfe, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xa7, 0x0c, 0x00, 0x00, 0x59, 0x2f, 0xa7,
+  0x0c, 0x00, 0x00, 0x5a, 0x00, 0x24, 0x7e, 0x01, 0x03, 0x11, 0x03, 0xc3,
+  0x1a, 0x00, 0x00, 0x25, 0x40, 0x03, 0x11, 0x03, 0x9e, 0x0a, 0x00, 0x00,
+  0x25, 0x39, 0x03, 0x11, 0x03, 0x31, 0x01, 0x00, 0x00, 0x3a, 0x63, 0x01,
+  0x03, 0x12, 0x03, 0x59, 0x0c, 0x00, 0x00, 0x27, 0x6e, 0x01, 0x03, 0x14,
+  0x03, 0x31, 0x01, 0x00, 0x00, 0x26, 0x28, 0x03, 0x15, 0x03, 0x09, 0x01,
+  0x00, 0x00, 0x00, 0x02, 0x7f, 0x01, 0x02, 0x01, 0x39, 0x80, 0x01, 0x03,
+  0x2d, 0x01, 0x3a, 0x65, 0x01, 0x03, 0x2d, 0x01, 0xd3, 0x05, 0x00, 0x00,
+  0x25, 0x40, 0x03, 0x2d, 0x01, 0x9e, 0x0a, 0x00, 0x00, 0x26, 0x28, 0x03,
+  0x30, 0x01, 0x73, 0x05, 0x00, 0x00, 0x27, 0x62, 0x01, 0x03, 0x2f, 0x01,
+  0x09, 0x01, 0x00, 0x00, 0x00, 0x46, 0x81, 0x01, 0x00, 0x10, 0x9d, 0x00,
+  0x00, 0x00, 0x47, 0x65, 0x01, 0x00, 0x10, 0xd3, 0x05, 0x00, 0x00, 0x00,
+  0x24, 0x82, 0x01, 0x03, 0xfa, 0x01, 0x95, 0x01, 0x00, 0x00, 0x3a, 0x65,
+  0x01, 0x03, 0xfa, 0x01, 0xd3, 0x05, 0x00, 0x00, 0x25, 0x40, 0x03, 0xfa,
+  0x01, 0x9e, 0x0a, 0x00, 0x00, 0x25, 0x39, 0x03, 0xfa, 0x01, 0x31, 0x01,
+  0x00, 0x00, 0x3a, 0x63, 0x01, 0x03, 0xfb, 0x01, 0x59, 0x0c, 0x00, 0x00,
+  0x27, 0x72, 0x01, 0x03, 0xfe, 0x01, 0x9d, 0x00, 0x00, 0x00, 0x26, 0x2f,
+  0x03, 0xff, 0x01, 0x09, 0x01, 0x00, 0x00, 0x27, 0x83, 0x01, 0x03, 0xfd,
+  0x01, 0x09, 0x01, 0x00, 0x00, 0x26, 0x36, 0x03, 0xfe, 0x01, 0x9d, 0x00,
+  0x00, 0x00, 0x27, 0x7b, 0x01, 0x03, 0x01, 0x02, 0xb2, 0x02, 0x00, 0x00,
+  0x27, 0x74, 0x01, 0x03, 0x01, 0x02, 0xb2, 0x02, 0x00, 0x00, 0x27, 0x84,
+  0x01, 0x03, 0x00, 0x02, 0x91, 0x1b, 0x00, 0x00, 0x27, 0x85, 0x01, 0x03,
+  0xfd, 0x01, 0x09, 0x01, 0x00, 0x00, 0x27, 0x76, 0x01, 0x03, 0xfe, 0x01,
+  0x9d, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x03, 0x00, 0x00, 0x24, 0x86,
+  0x01, 0x03, 0x9b, 0x01, 0x95, 0x01, 0x00, 0x00, 0x3a, 0x65, 0x01, 0x03,
+  0x9b, 0x01, 0xd3, 0x05, 0x00, 0x00, 0x25, 0x40, 0x03, 0x9b, 0x01, 0x9e,
+  0x0a, 0x00, 0x00, 0x25, 0x39, 0x03, 0x9b, 0x01, 0x31, 0x01, 0x00, 0x00,
+  0x3a, 0x63, 0x01, 0x03, 0x9c, 0x01, 0x59, 0x0c, 0x00, 0x00, 0x27, 0x70,
+  0x01, 0x03, 0xa0, 0x01, 0xf4, 0x01, 0x00, 0x00, 0x27, 0x69, 0x01, 0x03,
+  0x9f, 0x01, 0xf4, 0x1b, 0x00, 0x00, 0x27, 0x87, 0x01, 0x03, 0xa1, 0x01,
+  0xf9, 0x1b, 0x00, 0x00, 0x27, 0x89, 0x01, 0x03, 0x9e, 0x01, 0x95, 0x01,
+  0x00, 0x00, 0x48, 0x2b, 0x03, 0xcf, 0x01, 0x00, 0x0f, 0x21, 0x10, 0x00,
+  0x00, 0x0f, 0xfe, 0x1b, 0x00, 0x00, 0x3b, 0x88, 0x01, 0x60, 0x03, 0x58,
+  0x01, 0x3c, 0x69, 0x01, 0x21, 0x10, 0x00, 0x00, 0x03, 0x59, 0x01, 0x08,
+  0x00, 0x3d, 0x6c, 0x01, 0x1d, 0x1c, 0x00, 0x00, 0x03, 0x5a, 0x01, 0x00,
+  0x00, 0x0a, 0x31, 0x01, 0x00, 0x00, 0x0b, 0x21, 0x01, 0x00, 0x00, 0x60,
+  0x00, 0x39, 0x8a, 0x01, 0x03, 0x5e, 0x01, 0x3a, 0x65, 0x01, 0x03, 0x5e,
+  0x01, 0xd3, 0x05, 0x00, 0x00, 0x25, 0x40, 0x03, 0x5e, 0x01, 0x9e, 0x0a,
+  0x00, 0x00, 0x25, 0x39, 0x03, 0x5e, 0x01, 0x31, 0x01, 0x00, 0x00, 0x3a,
+  0x69, 0x01, 0x03, 0x5f, 0x01, 0xf4, 0x1b, 0x00, 0x00, 0x00, 0x24, 0x8b,
+  0x01, 0x03, 0x32, 0x02, 0x95, 0x01, 0x00, 0x00, 0x3a, 0x65, 0x01, 0x03,
+  0x32, 0x02, 0xd3, 0x05, 0x00, 0x00, 0x25, 0x39, 0x03, 0x32, 0x02, 0x31,
+  0x01, 0x00, 0x00, 0x3a, 0x63, 0x01, 0x03, 0x33, 0x02, 0x59, 0x0c, 0x00,
+  0x00, 0x27, 0x51, 0x01, 0x03, 0x36, 0x02, 0x9d, 0x00, 0x00, 0x00, 0x27,
+  0x72, 0x01, 0x03, 0x36, 0x02, 0x9d, 0x00, 0x00, 0x00, 0x27, 0x8c, 0x01,
+  0x03, 0x35, 0x02, 0xad, 0x02, 0x00, 0x00, 0x00, 0x24, 0x8d, 0x01, 0x03,
+  0x70, 0x01, 0x95, 0x01, 0x00, 0x00, 0x3a, 0x65, 0x01, 0x03, 0x70, 0x01,
+  0xd3, 0x05, 0x00, 0x00, 0x25, 0x40, 0x03, 0x70, 0x01, 0x9e, 0x0a, 0x00,
+  0x00, 0x25, 0x39, 0x03, 0x70, 0x01, 0x31, 0x01, 0x00, 0x00, 0x3a, 0x63,
+  0x01, 0x03, 0x71, 0x01, 0x59, 0x0c, 0x00, 0x00, 0x27, 0x87, 0x01, 0x03,
+  0x75, 0x01, 0xfe, 0x1b, 0x00, 0x00, 0x27, 0x70, 0x01, 0x03, 0x74, 0x01,
+  0xf4, 0x01, 0x00, 0x00, 0x27, 0x89, 0x01, 0x03, 0x73, 0x01, 0x95, 0x01,
+  0x00, 0x00, 0x00, 0x42, 0x5b, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xc8,
+  0x01, 0x00, 0x1d, 0x95, 0x01, 0x00, 0x00, 0x43, 0x8a, 0x01, 0x65, 0x01,
+  0x00, 0x1d, 0xc2, 0x20, 0x00, 0x00, 0x44, 0x8b, 0x01, 0x40, 0x00, 0x1d,
+  0x9e, 0x0a, 0x00, 0x00, 0x2f, 0xe3, 0x17, 0x00, 0x00, 0x5c, 0x00, 0x42,
+  0x5d, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xc9, 0x01, 0x00, 0x1d, 0x95,
+  0x01, 0x00, 0x00, 0x43, 0x8c, 0x01, 0x65, 0x01, 0x00, 0x1d, 0xc2, 0x20,
+  0x00, 0x00, 0x44, 0x8d, 0x01, 0x40, 0x00, 0x1d, 0x9e, 0x0a, 0x00, 0x00,
+  0x2f, 0xe3, 0x17, 0x00, 0x00, 0x5e, 0x00, 0x42, 0x5f, 0x28, 0x00, 0x00,
+  0x00, 0x01, 0x5a, 0xca, 0x01, 0x00, 0x1d, 0x95, 0x01, 0x00, 0x00, 0x43,
+  0x8e, 0x01, 0x65, 0x01, 0x00, 0x1d, 0xc2, 0x20, 0x00, 0x00, 0x44, 0x8f,
+  0x01, 0x40, 0x00, 0x1d, 0x9e, 0x0a, 0x00, 0x00, 0x2f, 0xe3, 0x17, 0x00,
+  0x00, 0x60, 0x00, 0x42, 0x61, 0x28, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xcb,
+  0x01, 0x00, 0x1d, 0x95, 0x01, 0x00, 0x00, 0x43, 0x90, 0x01, 0x65, 0x01,
+  0x00, 0x1d, 0xc2, 0x20, 0x00, 0x00, 0x44, 0x91, 0x01, 0x40, 0x00, 0x1d,
+  0x9e, 0x0a, 0x00, 0x00, 0x2f, 0xe3, 0x17, 0x00, 0x00, 0x62, 0x00, 0x24,
+  0x8e, 0x01, 0x03, 0x3e, 0x01, 0x9e, 0x0a, 0x00, 0x00, 0x3a, 0x65, 0x01,
+  0x03, 0x3e, 0x01, 0xd3, 0x05, 0x00, 0x00, 0x26, 0x28, 0x03, 0x41, 0x01,
+  0x73, 0x05, 0x00, 0x00, 0x27, 0x62, 0x01, 0x03, 0x40, 0x01, 0xad, 0x02,
+  0x00, 0x00, 0x26, 0x40, 0x03, 0x40, 0x01, 0x09, 0x01, 0x00, 0x00, 0x00,
+  0x42, 0x63, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xcc, 0x01, 0x00, 0x24,
+  0x95, 0x01, 0x00, 0x00, 0x43, 0x92, 0x01, 0x65, 0x01, 0x00, 0x24, 0xc2,
+  0x20, 0x00, 0x00, 0x44, 0x95, 0x01, 0x40, 0x00, 0x26, 0x9e, 0x0a, 0x00,
+  0x00, 0x49, 0x9b, 0x1d, 0x00, 0x00, 0x0e, 0x00, 0x26, 0x19, 0x2b, 0x01,
+  0x56, 0xa5, 0x1d, 0x00, 0x00, 0x2d, 0x02, 0x91, 0x00, 0xaf, 0x1d, 0x00,
+  0x00, 0x2e, 0x93, 0x01, 0xb8, 0x1d, 0x00, 0x00, 0x2e, 0x94, 0x01, 0xc2,
+  0x1d, 0x00, 0x00, 0x36, 0xf5, 0x1a, 0x00, 0x00, 0x64, 0x18, 0x00, 0x00,
+  0x00, 0x03, 0x43, 0x01, 0x12, 0x2b, 0x01, 0x56, 0xfe, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x2f, 0xe3, 0x17, 0x00, 0x00, 0x65, 0x00, 0x24, 0x8f, 0x01,
+  0x03, 0xdd, 0x02, 0xc3, 0x1a, 0x00, 0x00, 0x25, 0x40, 0x03, 0xdd, 0x02,
+  0x9e, 0x0a, 0x00, 0x00, 0x3a, 0x77, 0x01, 0x03, 0xdd, 0x02, 0x8a, 0x1e,
+  0x00, 0x00, 0x27, 0x90, 0x01, 0x03, 0xdf, 0x02, 0xc3, 0x1a, 0x00, 0x00,
+  0x26, 0x15, 0x03, 0xe0, 0x02, 0x25, 0x01, 0x00, 0x00, 0x40, 0x27, 0x78,
+  0x01, 0x03, 0xe2, 0x02, 0x95, 0x01, 0x00, 0x00, 0x40, 0x27, 0x91, 0x01,
+  0x03, 0xe2, 0x02, 0xd4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x27, 0x78,
+  0x01, 0x03, 0xf4, 0x02, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x8f,
+  0x1e, 0x00, 0x00, 0x04, 0x94, 0x1e, 0x00, 0x00, 0x05, 0xa9, 0x00, 0x00,
+  0x00, 0x24, 0x92, 0x01, 0x03, 0x56, 0x02, 0x9d, 0x00, 0x00, 0x00, 0x25,
+  0x40, 0x03, 0x56, 0x02, 0x9e, 0x0a, 0x00, 0x00, 0x27, 0x49, 0x01, 0x03,
+  0x58, 0x02, 0x60, 0x0b, 0x00, 0x00, 0x40, 0x27, 0x78, 0x01, 0x03, 0x5a,
+  0x02, 0x60, 0x0b, 0x00, 0x00, 0x40, 0x27, 0x91, 0x01, 0x03, 0x5a, 0x02,
+  0xd4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x27, 0x78, 0x01, 0x03, 0x5c,
+  0x02, 0x60, 0x0b, 0x00, 0x00, 0x40, 0x27, 0x91, 0x01, 0x03, 0x5c, 0x02,
+  0xd4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x27, 0x78, 0x01, 0x03, 0x5f,
+  0x02, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x93, 0x01, 0x03, 0x67,
+  0x02, 0x09, 0x01, 0x00, 0x00, 0x25, 0x40, 0x03, 0x67, 0x02, 0x9e, 0x0a,
+  0x00, 0x00, 0x27, 0x46, 0x01, 0x03, 0x69, 0x02, 0x20, 0x0b, 0x00, 0x00,
+  0x40, 0x27, 0x78, 0x01, 0x03, 0x69, 0x02, 0x20, 0x0b, 0x00, 0x00, 0x00,
+  0x40, 0x27, 0x78, 0x01, 0x03, 0x6f, 0x02, 0x09, 0x01, 0x00, 0x00, 0x40,
+  0x27, 0x91, 0x01, 0x03, 0x6f, 0x02, 0xd4, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x24, 0x94, 0x01, 0x03, 0x83, 0x02, 0xc3, 0x1a, 0x00, 0x00, 0x25,
+  0x40, 0x03, 0x83, 0x02, 0x9e, 0x0a, 0x00, 0x00, 0x25, 0x15, 0x03, 0x83,
+  0x02, 0x25, 0x01, 0x00, 0x00, 0x3a, 0x77, 0x01, 0x03, 0x84, 0x02, 0x8a,
+  0x1e, 0x00, 0x00, 0x27, 0x95, 0x01, 0x03, 0x87, 0x02, 0xd5, 0x1f, 0x00,
+  0x00, 0x27, 0x96, 0x01, 0x03, 0x88, 0x02, 0xe1, 0x1f, 0x00, 0x00, 0x27,
+  0x9e, 0x01, 0x03, 0x89, 0x02, 0x49, 0x20, 0x00, 0x00, 0x26, 0x14, 0x03,
+  0x8b, 0x02, 0x15, 0x01, 0x00, 0x00, 0x26, 0x12, 0x03, 0x8b, 0x02, 0x15,
+  0x01, 0x00, 0x00, 0x27, 0xa4, 0x01, 0x03, 0x86, 0x02, 0xc3, 0x1a, 0x00,
+  0x00, 0x27, 0x5a, 0x01, 0x03, 0x8c, 0x02, 0xf2, 0x0b, 0x00, 0x00, 0x27,
+  0xa5, 0x01, 0x03, 0x8d, 0x02, 0x9d, 0x00, 0x00, 0x00, 0x27, 0xa6, 0x01,
+  0x03, 0x86, 0x02, 0xc3, 0x1a, 0x00, 0x00, 0x26, 0x1a, 0x03, 0x8a, 0x02,
+  0x31, 0x01, 0x00, 0x00, 0x40, 0x27, 0x78, 0x01, 0x03, 0x8c, 0x02, 0xf2,
+  0x0b, 0x00, 0x00, 0x00, 0x40, 0x27, 0x78, 0x01, 0x03, 0x8d, 0x02, 0x25,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x01, 0x00, 0x00, 0x0b, 0x21,
+  0x01, 0x00, 0x00, 0x02, 0x00, 0x22, 0x9d, 0x01, 0x14, 0x03, 0x4b, 0x23,
+  0x97, 0x01, 0x31, 0x01, 0x00, 0x00, 0x03, 0x4c, 0x00, 0x23, 0x98, 0x01,
+  0x31, 0x01, 0x00, 0x00, 0x03, 0x4d, 0x01, 0x23, 0x99, 0x01, 0x25, 0x01,
+  0x00, 0x00, 0x03, 0x4e, 0x02, 0x23, 0x51, 0x01, 0x25, 0x01, 0x00, 0x00,
+  0x03, 0x4f, 0x04, 0x23, 0x9a, 0x01, 0x25, 0x01, 0x00, 0x00, 0x03, 0x50,
+  0x06, 0x23, 0x9b, 0x01, 0x31, 0x01, 0x00, 0x00, 0x03, 0x51, 0x08, 0x07,
+  0x15, 0x31, 0x01, 0x00, 0x00, 0x03, 0x52, 0x09, 0x23, 0x9c, 0x01, 0x25,
+  0x01, 0x00, 0x00, 0x03, 0x53, 0x0a, 0x07, 0x12, 0x9d, 0x00, 0x00, 0x00,
+  0x03, 0x54, 0x0c, 0x07, 0x14, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x55, 0x10,
+  0x00, 0x22, 0xa3, 0x01, 0x28, 0x03, 0x58, 0x23, 0x9f, 0x01, 0x9d, 0x00,
+  0x00, 0x00, 0x03, 0x59, 0x00, 0x23, 0xa0, 0x01, 0x25, 0x01, 0x00, 0x00,
+  0x03, 0x5a, 0x04, 0x23, 0xa1, 0x01, 0x31, 0x01, 0x00, 0x00, 0x03, 0x5b,
+  0x06, 0x23, 0xa2, 0x01, 0x31, 0x01, 0x00, 0x00, 0x03, 0x5c, 0x07, 0x07,
+  0x12, 0x15, 0x01, 0x00, 0x00, 0x03, 0x5d, 0x08, 0x07, 0x14, 0x15, 0x01,
+  0x00, 0x00, 0x03, 0x5e, 0x18, 0x00, 0x24, 0xa7, 0x01, 0x03, 0x73, 0x02,
+  0xc3, 0x1a, 0x00, 0x00, 0x3a, 0xa8, 0x01, 0x03, 0x73, 0x02, 0xb3, 0x20,
+  0x00, 0x00, 0x3a, 0xa9, 0x01, 0x03, 0x73, 0x02, 0xef, 0x01, 0x00, 0x00,
+  0x3a, 0xa6, 0x01, 0x03, 0x73, 0x02, 0xc3, 0x1a, 0x00, 0x00, 0x00, 0x0f,
+  0xb8, 0x20, 0x00, 0x00, 0x04, 0xbd, 0x20, 0x00, 0x00, 0x05, 0x9d, 0x00,
+  0x00, 0x00, 0x0f, 0xc7, 0x20, 0x00, 0x00, 0x22, 0xe3, 0x01, 0xa8, 0x08,
+  0x29, 0x23, 0xce, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x2e, 0x00, 0x23,
+  0xcf, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x2f, 0x08, 0x23, 0xd0, 0x01,
+  0x11, 0x01, 0x00, 0x00, 0x08, 0x30, 0x10, 0x23, 0xd1, 0x01, 0x11, 0x01,
+  0x00, 0x00, 0x08, 0x31, 0x18, 0x23, 0xd2, 0x01, 0x11, 0x01, 0x00, 0x00,
+  0x08, 0x32, 0x20, 0x23, 0xd3, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x33,
+  0x28, 0x23, 0xd4, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x35, 0x30, 0x23,
+  0xd5, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x36, 0x38, 0x23, 0xd6, 0x01,
+  0x11, 0x01, 0x00, 0x00, 0x08, 0x37, 0x40, 0x23, 0xd7, 0x01, 0x11, 0x01,
+  0x00, 0x00, 0x08, 0x38, 0x48, 0x23, 0xd8, 0x01, 0x11, 0x01, 0x00, 0x00,
+  0x08, 0x39, 0x50, 0x23, 0xd9, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x3a,
+  0x58, 0x23, 0xda, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x3b, 0x60, 0x23,
+  0xdb, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x3c, 0x68, 0x23, 0xdc, 0x01,
+  0x11, 0x01, 0x00, 0x00, 0x08, 0x3d, 0x70, 0x23, 0xdd, 0x01, 0x11, 0x01,
+  0x00, 0x00, 0x08, 0x42, 0x78, 0x23, 0xde, 0x01, 0x11, 0x01, 0x00, 0x00,
+  0x08, 0x44, 0x80, 0x23, 0xdf, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x45,
+  0x88, 0x23, 0xe0, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x46, 0x90, 0x23,
+  0xe1, 0x01, 0x11, 0x01, 0x00, 0x00, 0x08, 0x47, 0x98, 0x23, 0xe2, 0x01,
+  0x11, 0x01, 0x00, 0x00, 0x08, 0x48, 0xa0, 0x00, 0x00, 0xa0, 0x01, 0x00,
+  0x00, 0x05, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x52, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00,
+  0x00, 0xa6, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00,
+  0x00, 0xca, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00,
+  0x00, 0xf1, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00,
+  0x00, 0x15, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 0x01, 0x0d, 0x04,
+  0x08, 0x38, 0x04, 0x40, 0xb8, 0x01, 0x00, 0x01, 0x11, 0x04, 0xe0, 0x01,
+  0xe8, 0x02, 0x04, 0xf0, 0x02, 0x90, 0x03, 0x04, 0xa8, 0x03, 0xe0, 0x03,
+  0x04, 0xe8, 0x03, 0x98, 0x07, 0x00, 0x01, 0x11, 0x04, 0xf0, 0x02, 0x90,
+  0x03, 0x04, 0xa8, 0x03, 0xe0, 0x03, 0x04, 0xe8, 0x03, 0x98, 0x07, 0x00,
+  0x01, 0x11, 0x04, 0xc8, 0x03, 0xe0, 0x03, 0x04, 0xe8, 0x03, 0x88, 0x04,
+  0x00, 0x01, 0x13, 0x04, 0x08, 0x38, 0x04, 0x40, 0xb8, 0x01, 0x00, 0x01,
+  0x17, 0x04, 0x08, 0x38, 0x04, 0x40, 0xb8, 0x01, 0x00, 0x01, 0x1b, 0x04,
+  0x08, 0x38, 0x04, 0x40, 0xb8, 0x01, 0x00, 0x01, 0x1f, 0x04, 0x08, 0x38,
+  0x04, 0x40, 0xb8, 0x01, 0x00, 0x01, 0x11, 0x04, 0xa0, 0x19, 0xb8, 0x19,
+  0x04, 0xc0, 0x19, 0xd8, 0x19, 0x00, 0x01, 0x11, 0x04, 0xc8, 0x12, 0xb8,
+  0x16, 0x04, 0x88, 0x1e, 0xa8, 0x1e, 0x00, 0x01, 0x11, 0x04, 0x90, 0x17,
+  0xa0, 0x19, 0x04, 0xa8, 0x1e, 0xb0, 0x21, 0x00, 0x01, 0x11, 0x04, 0xa8,
+  0x18, 0xb8, 0x18, 0x04, 0xd0, 0x18, 0xa0, 0x19, 0x00, 0x01, 0x11, 0x04,
+  0xe0, 0x1e, 0xf0, 0x1e, 0x04, 0xc8, 0x1f, 0x98, 0x20, 0x00, 0x01, 0x11,
+  0x04, 0xb0, 0x1b, 0xb8, 0x1b, 0x04, 0x88, 0x1c, 0xd8, 0x1c, 0x00, 0x01,
+  0x63, 0x04, 0x08, 0x48, 0x04, 0x50, 0xa8, 0x01, 0x00, 0x01, 0x11, 0x04,
+  0xe8, 0x21, 0xf8, 0x21, 0x04, 0xa8, 0x22, 0xb0, 0x22, 0x00, 0x01, 0x11,
+  0x04, 0xe8, 0x22, 0xa8, 0x2c, 0x04, 0xc8, 0x2c, 0xa8, 0x3b, 0x00, 0x03,
+  0x0d, 0xc8, 0x01, 0x03, 0x0f, 0x28, 0x01, 0x11, 0x04, 0x00, 0x98, 0x07,
+  0x04, 0x98, 0x07, 0xb0, 0x0e, 0x04, 0xb0, 0x0e, 0xb8, 0x21, 0x04, 0xb8,
+  0x21, 0xb8, 0x3b, 0x03, 0x13, 0xc8, 0x01, 0x03, 0x15, 0x28, 0x03, 0x17,
+  0xc8, 0x01, 0x03, 0x19, 0x28, 0x03, 0x1b, 0xc8, 0x01, 0x03, 0x1d, 0x28,
+  0x03, 0x1f, 0xc8, 0x01, 0x03, 0x21, 0x28, 0x03, 0x23, 0xb0, 0x05, 0x03,
+  0x27, 0x18, 0x03, 0x2e, 0xb0, 0x05, 0x03, 0x32, 0x18, 0x03, 0x34, 0xb0,
+  0x05, 0x03, 0x38, 0x18, 0x03, 0x3a, 0xb0, 0x05, 0x03, 0x3e, 0x18, 0x03,
+  0x40, 0xb0, 0x05, 0x03, 0x44, 0x18, 0x03, 0x46, 0xb0, 0x05, 0x03, 0x4a,
+  0x18, 0x03, 0x4c, 0x28, 0x03, 0x5b, 0x28, 0x03, 0x5d, 0x28, 0x03, 0x5f,
+  0x28, 0x03, 0x61, 0x28, 0x03, 0x63, 0xe0, 0x01, 0x00, 0x98, 0x07, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00,
+  0x00, 0x34, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00,
+  0x00, 0x4e, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x69, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x00, 0x82, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x9a, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00,
+  0x00, 0xb7, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00,
+  0x00, 0xd9, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00,
+  0x00, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00,
+  0x00, 0x0c, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x26, 0x01, 0x00,
+  0x00, 0x2e, 0x01, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x00,
+  0x00, 0x54, 0x01, 0x00, 0x00, 0x59, 0x01, 0x00, 0x00, 0x60, 0x01, 0x00,
+  0x00, 0x65, 0x01, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00,
+  0x00, 0x7d, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0x93, 0x01, 0x00,
+  0x00, 0x97, 0x01, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0xa1, 0x01, 0x00,
+  0x00, 0xa6, 0x01, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x00,
+  0x00, 0xd1, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x00,
+  0x00, 0xeb, 0x01, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xf8, 0x01, 0x00,
+  0x00, 0x03, 0x02, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00,
+  0x00, 0x20, 0x02, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x37, 0x02, 0x00,
+  0x00, 0x4f, 0x02, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x73, 0x02, 0x00,
+  0x00, 0x83, 0x02, 0x00, 0x00, 0x87, 0x02, 0x00, 0x00, 0x8e, 0x02, 0x00,
+  0x00, 0x92, 0x02, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x9d, 0x02, 0x00,
+  0x00, 0xac, 0x02, 0x00, 0x00, 0xbb, 0x02, 0x00, 0x00, 0xc8, 0x02, 0x00,
+  0x00, 0xd6, 0x02, 0x00, 0x00, 0xdf, 0x02, 0x00, 0x00, 0xe4, 0x02, 0x00,
+  0x00, 0xf6, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x09, 0x03, 0x00,
+  0x00, 0x13, 0x03, 0x00, 0x00, 0x21, 0x03, 0x00, 0x00, 0x3a, 0x03, 0x00,
+  0x00, 0x4d, 0x03, 0x00, 0x00, 0x53, 0x03, 0x00, 0x00, 0x67, 0x03, 0x00,
+  0x00, 0x7d, 0x03, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00,
+  0x00, 0x9c, 0x03, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0xc1, 0x03, 0x00,
+  0x00, 0xda, 0x03, 0x00, 0x00, 0xed, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00,
+  0x00, 0x19, 0x04, 0x00, 0x00, 0x2d, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00,
+  0x00, 0x54, 0x04, 0x00, 0x00, 0x6b, 0x04, 0x00, 0x00, 0x81, 0x04, 0x00,
+  0x00, 0x98, 0x04, 0x00, 0x00, 0xb5, 0x04, 0x00, 0x00, 0xce, 0x04, 0x00,
+  0x00, 0xdf, 0x04, 0x00, 0x00, 0xf2, 0x04, 0x00, 0x00, 0xfa, 0x04, 0x00,
+  0x00, 0x06, 0x05, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00, 0x1b, 0x05, 0x00,
+  0x00, 0x31, 0x05, 0x00, 0x00, 0x45, 0x05, 0x00, 0x00, 0x56, 0x05, 0x00,
+  0x00, 0x67, 0x05, 0x00, 0x00, 0x7c, 0x05, 0x00, 0x00, 0x91, 0x05, 0x00,
+  0x00, 0xa5, 0x05, 0x00, 0x00, 0xb6, 0x05, 0x00, 0x00, 0xc8, 0x05, 0x00,
+  0x00, 0xdb, 0x05, 0x00, 0x00, 0xec, 0x05, 0x00, 0x00, 0xfc, 0x05, 0x00,
+  0x00, 0x15, 0x06, 0x00, 0x00, 0x2e, 0x06, 0x00, 0x00, 0x47, 0x06, 0x00,
+  0x00, 0x5b, 0x06, 0x00, 0x00, 0x71, 0x06, 0x00, 0x00, 0x87, 0x06, 0x00,
+  0x00, 0xa0, 0x06, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00, 0xd7, 0x06, 0x00,
+  0x00, 0xf0, 0x06, 0x00, 0x00, 0x09, 0x07, 0x00, 0x00, 0x1c, 0x07, 0x00,
+  0x00, 0x34, 0x07, 0x00, 0x00, 0x52, 0x07, 0x00, 0x00, 0x6f, 0x07, 0x00,
+  0x00, 0x89, 0x07, 0x00, 0x00, 0xa5, 0x07, 0x00, 0x00, 0xbc, 0x07, 0x00,
+  0x00, 0xd2, 0x07, 0x00, 0x00, 0xee, 0x07, 0x00, 0x00, 0x0a, 0x08, 0x00,
+  0x00, 0x23, 0x08, 0x00, 0x00, 0x35, 0x08, 0x00, 0x00, 0x4e, 0x08, 0x00,
+  0x00, 0x69, 0x08, 0x00, 0x00, 0x81, 0x08, 0x00, 0x00, 0x96, 0x08, 0x00,
+  0x00, 0xa9, 0x08, 0x00, 0x00, 0xc5, 0x08, 0x00, 0x00, 0xe1, 0x08, 0x00,
+  0x00, 0xfb, 0x08, 0x00, 0x00, 0x14, 0x09, 0x00, 0x00, 0x2e, 0x09, 0x00,
+  0x00, 0x47, 0x09, 0x00, 0x00, 0x61, 0x09, 0x00, 0x00, 0x7b, 0x09, 0x00,
+  0x00, 0x9e, 0x09, 0x00, 0x00, 0xb7, 0x09, 0x00, 0x00, 0xce, 0x09, 0x00,
+  0x00, 0xe3, 0x09, 0x00, 0x00, 0xfd, 0x09, 0x00, 0x00, 0x17, 0x0a, 0x00,
+  0x00, 0x30, 0x0a, 0x00, 0x00, 0x49, 0x0a, 0x00, 0x00, 0x61, 0x0a, 0x00,
+  0x00, 0x7c, 0x0a, 0x00, 0x00, 0x94, 0x0a, 0x00, 0x00, 0xa6, 0x0a, 0x00,
+  0x00, 0xba, 0x0a, 0x00, 0x00, 0xd3, 0x0a, 0x00, 0x00, 0xe9, 0x0a, 0x00,
+  0x00, 0x02, 0x0b, 0x00, 0x00, 0x1b, 0x0b, 0x00, 0x00, 0x34, 0x0b, 0x00,
+  0x00, 0x53, 0x0b, 0x00, 0x00, 0x71, 0x0b, 0x00, 0x00, 0x85, 0x0b, 0x00,
+  0x00, 0x9e, 0x0b, 0x00, 0x00, 0xbd, 0x0b, 0x00, 0x00, 0xd7, 0x0b, 0x00,
+  0x00, 0xf0, 0x0b, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x1f, 0x0c, 0x00,
+  0x00, 0x2d, 0x0c, 0x00, 0x00, 0x46, 0x0c, 0x00, 0x00, 0x62, 0x0c, 0x00,
+  0x00, 0x75, 0x0c, 0x00, 0x00, 0x96, 0x0c, 0x00, 0x00, 0xaa, 0x0c, 0x00,
+  0x00, 0xc4, 0x0c, 0x00, 0x00, 0xdf, 0x0c, 0x00, 0x00, 0xf9, 0x0c, 0x00,
+  0x00, 0x11, 0x0d, 0x00, 0x00, 0x2f, 0x0d, 0x00, 0x00, 0x4c, 0x0d, 0x00,
+  0x00, 0x65, 0x0d, 0x00, 0x00, 0x78, 0x0d, 0x00, 0x00, 0x8c, 0x0d, 0x00,
+  0x00, 0xa3, 0x0d, 0x00, 0x00, 0xc2, 0x0d, 0x00, 0x00, 0xdd, 0x0d, 0x00,
+  0x00, 0xfa, 0x0d, 0x00, 0x00, 0x1a, 0x0e, 0x00, 0x00, 0x31, 0x0e, 0x00,
+  0x00, 0x48, 0x0e, 0x00, 0x00, 0x5c, 0x0e, 0x00, 0x00, 0x73, 0x0e, 0x00,
+  0x00, 0x89, 0x0e, 0x00, 0x00, 0xa0, 0x0e, 0x00, 0x00, 0xb7, 0x0e, 0x00,
+  0x00, 0xcd, 0x0e, 0x00, 0x00, 0xe5, 0x0e, 0x00, 0x00, 0xf8, 0x0e, 0x00,
+  0x00, 0x0d, 0x0f, 0x00, 0x00, 0x22, 0x0f, 0x00, 0x00, 0x34, 0x0f, 0x00,
+  0x00, 0x4c, 0x0f, 0x00, 0x00, 0x67, 0x0f, 0x00, 0x00, 0x7f, 0x0f, 0x00,
+  0x00, 0x9c, 0x0f, 0x00, 0x00, 0xb5, 0x0f, 0x00, 0x00, 0xd7, 0x0f, 0x00,
+  0x00, 0xf5, 0x0f, 0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x23, 0x10, 0x00,
+  0x00, 0x34, 0x10, 0x00, 0x00, 0x4c, 0x10, 0x00, 0x00, 0x67, 0x10, 0x00,
+  0x00, 0x7c, 0x10, 0x00, 0x00, 0x97, 0x10, 0x00, 0x00, 0xab, 0x10, 0x00,
+  0x00, 0xc4, 0x10, 0x00, 0x00, 0xdf, 0x10, 0x00, 0x00, 0xfc, 0x10, 0x00,
+  0x00, 0x1b, 0x11, 0x00, 0x00, 0x31, 0x11, 0x00, 0x00, 0x4d, 0x11, 0x00,
+  0x00, 0x60, 0x11, 0x00, 0x00, 0x7d, 0x11, 0x00, 0x00, 0x9e, 0x11, 0x00,
+  0x00, 0xb2, 0x11, 0x00, 0x00, 0xcc, 0x11, 0x00, 0x00, 0xf4, 0x11, 0x00,
+  0x00, 0x07, 0x12, 0x00, 0x00, 0x22, 0x12, 0x00, 0x00, 0x36, 0x12, 0x00,
+  0x00, 0x49, 0x12, 0x00, 0x00, 0x5f, 0x12, 0x00, 0x00, 0x7e, 0x12, 0x00,
+  0x00, 0x96, 0x12, 0x00, 0x00, 0xaf, 0x12, 0x00, 0x00, 0xc7, 0x12, 0x00,
+  0x00, 0xe0, 0x12, 0x00, 0x00, 0xf7, 0x12, 0x00, 0x00, 0x0b, 0x13, 0x00,
+  0x00, 0x25, 0x13, 0x00, 0x00, 0x3e, 0x13, 0x00, 0x00, 0x60, 0x13, 0x00,
+  0x00, 0x81, 0x13, 0x00, 0x00, 0x9b, 0x13, 0x00, 0x00, 0xb3, 0x13, 0x00,
+  0x00, 0xc9, 0x13, 0x00, 0x00, 0xe0, 0x13, 0x00, 0x00, 0xf9, 0x13, 0x00,
+  0x00, 0x14, 0x14, 0x00, 0x00, 0x32, 0x14, 0x00, 0x00, 0x42, 0x14, 0x00,
+  0x00, 0x5a, 0x14, 0x00, 0x00, 0x70, 0x14, 0x00, 0x00, 0x88, 0x14, 0x00,
+  0x00, 0xa4, 0x14, 0x00, 0x00, 0xbc, 0x14, 0x00, 0x00, 0xd1, 0x14, 0x00,
+  0x00, 0xe7, 0x14, 0x00, 0x00, 0xfe, 0x14, 0x00, 0x00, 0x18, 0x15, 0x00,
+  0x00, 0x35, 0x15, 0x00, 0x00, 0x53, 0x15, 0x00, 0x00, 0x6a, 0x15, 0x00,
+  0x00, 0x87, 0x15, 0x00, 0x00, 0x9f, 0x15, 0x00, 0x00, 0xb7, 0x15, 0x00,
+  0x00, 0xca, 0x15, 0x00, 0x00, 0xe5, 0x15, 0x00, 0x00, 0xf7, 0x15, 0x00,
+  0x00, 0x08, 0x16, 0x00, 0x00, 0x27, 0x16, 0x00, 0x00, 0x3a, 0x16, 0x00,
+  0x00, 0x4e, 0x16, 0x00, 0x00, 0x6a, 0x16, 0x00, 0x00, 0x7f, 0x16, 0x00,
+  0x00, 0x95, 0x16, 0x00, 0x00, 0xaa, 0x16, 0x00, 0x00, 0xc5, 0x16, 0x00,
+  0x00, 0xdb, 0x16, 0x00, 0x00, 0xf8, 0x16, 0x00, 0x00, 0x0f, 0x17, 0x00,
+  0x00, 0x29, 0x17, 0x00, 0x00, 0x47, 0x17, 0x00, 0x00, 0x59, 0x17, 0x00,
+  0x00, 0x67, 0x17, 0x00, 0x00, 0x78, 0x17, 0x00, 0x00, 0x8e, 0x17, 0x00,
+  0x00, 0xa4, 0x17, 0x00, 0x00, 0xbe, 0x17, 0x00, 0x00, 0xd2, 0x17, 0x00,
+  0x00, 0xe6, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00,
+  0x00, 0x31, 0x18, 0x00, 0x00, 0x4e, 0x18, 0x00, 0x00, 0x66, 0x18, 0x00,
+  0x00, 0x7d, 0x18, 0x00, 0x00, 0x90, 0x18, 0x00, 0x00, 0xb0, 0x18, 0x00,
+  0x00, 0xc2, 0x18, 0x00, 0x00, 0xce, 0x18, 0x00, 0x00, 0xe1, 0x18, 0x00,
+  0x00, 0xf3, 0x18, 0x00, 0x00, 0x07, 0x19, 0x00, 0x00, 0x1d, 0x19, 0x00,
+  0x00, 0x31, 0x19, 0x00, 0x00, 0x48, 0x19, 0x00, 0x00, 0x58, 0x19, 0x00,
+  0x00, 0x69, 0x19, 0x00, 0x00, 0x7b, 0x19, 0x00, 0x00, 0x8d, 0x19, 0x00,
+  0x00, 0x92, 0x19, 0x00, 0x00, 0x95, 0x19, 0x00, 0x00, 0xa1, 0x19, 0x00,
+  0x00, 0xa9, 0x19, 0x00, 0x00, 0xad, 0x19, 0x00, 0x00, 0xb0, 0x19, 0x00,
+  0x00, 0xb5, 0x19, 0x00, 0x00, 0xbf, 0x19, 0x00, 0x00, 0xcb, 0x19, 0x00,
+  0x00, 0xd8, 0x19, 0x00, 0x00, 0xdf, 0x19, 0x00, 0x00, 0xe2, 0x19, 0x00,
+  0x00, 0xe5, 0x19, 0x00, 0x00, 0xf1, 0x19, 0x00, 0x00, 0x02, 0x1a, 0x00,
+  0x00, 0x07, 0x1a, 0x00, 0x00, 0x0b, 0x1a, 0x00, 0x00, 0x12, 0x1a, 0x00,
+  0x00, 0x1d, 0x1a, 0x00, 0x00, 0x2e, 0x1a, 0x00, 0x00, 0x3d, 0x1a, 0x00,
+  0x00, 0x42, 0x1a, 0x00, 0x00, 0x48, 0x1a, 0x00, 0x00, 0x4d, 0x1a, 0x00,
+  0x00, 0x55, 0x1a, 0x00, 0x00, 0x5d, 0x1a, 0x00, 0x00, 0x67, 0x1a, 0x00,
+  0x00, 0x74, 0x1a, 0x00, 0x00, 0x82, 0x1a, 0x00, 0x00, 0x86, 0x1a, 0x00,
+  0x00, 0x8b, 0x1a, 0x00, 0x00, 0x98, 0x1a, 0x00, 0x00, 0x9c, 0x1a, 0x00,
+  0x00, 0xa2, 0x1a, 0x00, 0x00, 0xa9, 0x1a, 0x00, 0x00, 0xac, 0x1a, 0x00,
+  0x00, 0xae, 0x1a, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0xbe, 0x1a, 0x00,
+  0x00, 0xc2, 0x1a, 0x00, 0x00, 0xd5, 0x1a, 0x00, 0x00, 0xd9, 0x1a, 0x00,
+  0x00, 0xdb, 0x1a, 0x00, 0x00, 0xe0, 0x1a, 0x00, 0x00, 0xed, 0x1a, 0x00,
+  0x00, 0xf1, 0x1a, 0x00, 0x00, 0xfc, 0x1a, 0x00, 0x00, 0x01, 0x1b, 0x00,
+  0x00, 0x04, 0x1b, 0x00, 0x00, 0x06, 0x1b, 0x00, 0x00, 0x08, 0x1b, 0x00,
+  0x00, 0x0c, 0x1b, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x26, 0x1b, 0x00,
+  0x00, 0x2a, 0x1b, 0x00, 0x00, 0x3c, 0x1b, 0x00, 0x00, 0x41, 0x1b, 0x00,
+  0x00, 0x4b, 0x1b, 0x00, 0x00, 0x51, 0x1b, 0x00, 0x00, 0x5b, 0x1b, 0x00,
+  0x00, 0x67, 0x1b, 0x00, 0x00, 0x73, 0x1b, 0x00, 0x00, 0x77, 0x1b, 0x00,
+  0x00, 0x7b, 0x1b, 0x00, 0x00, 0x81, 0x1b, 0x00, 0x00, 0x8e, 0x1b, 0x00,
+  0x00, 0x92, 0x1b, 0x00, 0x00, 0xa1, 0x1b, 0x00, 0x00, 0xa7, 0x1b, 0x00,
+  0x00, 0xb2, 0x1b, 0x00, 0x00, 0xbc, 0x1b, 0x00, 0x00, 0xc1, 0x1b, 0x00,
+  0x00, 0xcb, 0x1b, 0x00, 0x00, 0xd7, 0x1b, 0x00, 0x00, 0xe4, 0x1b, 0x00,
+  0x00, 0xea, 0x1b, 0x00, 0x00, 0xee, 0x1b, 0x00, 0x00, 0xf8, 0x1b, 0x00,
+  0x00, 0x06, 0x1c, 0x00, 0x00, 0x12, 0x1c, 0x00, 0x00, 0x18, 0x1c, 0x00,
+  0x00, 0x1c, 0x1c, 0x00, 0x00, 0x24, 0x1c, 0x00, 0x00, 0x28, 0x1c, 0x00,
+  0x00, 0x30, 0x1c, 0x00, 0x00, 0x39, 0x1c, 0x00, 0x00, 0x3d, 0x1c, 0x00,
+  0x00, 0x43, 0x1c, 0x00, 0x00, 0x49, 0x1c, 0x00, 0x00, 0x4e, 0x1c, 0x00,
+  0x00, 0x5a, 0x1c, 0x00, 0x00, 0x66, 0x1c, 0x00, 0x00, 0x6e, 0x1c, 0x00,
+  0x00, 0x78, 0x1c, 0x00, 0x00, 0x80, 0x1c, 0x00, 0x00, 0x85, 0x1c, 0x00,
+  0x00, 0x89, 0x1c, 0x00, 0x00, 0x8f, 0x1c, 0x00, 0x00, 0x9a, 0x1c, 0x00,
+  0x00, 0x9f, 0x1c, 0x00, 0x00, 0xa4, 0x1c, 0x00, 0x00, 0xb6, 0x1c, 0x00,
+  0x00, 0xc8, 0x1c, 0x00, 0x00, 0xdb, 0x1c, 0x00, 0x00, 0xee, 0x1c, 0x00,
+  0x00, 0x05, 0x1d, 0x00, 0x00, 0x23, 0x1d, 0x00, 0x00, 0x32, 0x1d, 0x00,
+  0x00, 0x48, 0x1d, 0x00, 0x00, 0x65, 0x1d, 0x00, 0x00, 0x85, 0x1d, 0x00,
+  0x00, 0xac, 0x1d, 0x00, 0x00, 0xc9, 0x1d, 0x00, 0x00, 0xed, 0x1d, 0x00,
+  0x00, 0x06, 0x1e, 0x00, 0x00, 0x26, 0x1e, 0x00, 0x00, 0x3a, 0x1e, 0x00,
+  0x00, 0x55, 0x1e, 0x00, 0x00, 0x61, 0x1e, 0x00, 0x00, 0x7c, 0x1e, 0x00,
+  0x00, 0x9e, 0x1e, 0x00, 0x00, 0xbb, 0x1e, 0x00, 0x00, 0xdf, 0x1e, 0x00,
+  0x00, 0xf5, 0x1e, 0x00, 0x00, 0x12, 0x1f, 0x00, 0x00, 0x2d, 0x1f, 0x00,
+  0x00, 0x4f, 0x1f, 0x00, 0x00, 0x65, 0x1f, 0x00, 0x00, 0x82, 0x1f, 0x00,
+  0x00, 0x8d, 0x1f, 0x00, 0x00, 0x97, 0x1f, 0x00, 0x00, 0xa2, 0x1f, 0x00,
+  0x00, 0xad, 0x1f, 0x00, 0x00, 0xb8, 0x1f, 0x00, 0x00, 0xc3, 0x1f, 0x00,
+  0x00, 0xd4, 0x1f, 0x00, 0x00, 0xde, 0x1f, 0x00, 0x00, 0xe2, 0x1f, 0x00,
+  0x00, 0xe6, 0x1f, 0x00, 0x00, 0xea, 0x1f, 0x00, 0x00, 0xee, 0x1f, 0x00,
+  0x00, 0xf2, 0x1f, 0x00, 0x00, 0xf6, 0x1f, 0x00, 0x00, 0xfa, 0x1f, 0x00,
+  0x00, 0xfe, 0x1f, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x04, 0x20, 0x00,
+  0x00, 0x08, 0x20, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x10, 0x20, 0x00,
+  0x00, 0x14, 0x20, 0x00, 0x00, 0x18, 0x20, 0x00, 0x00, 0x21, 0x20, 0x00,
+  0x00, 0x25, 0x20, 0x00, 0x00, 0x28, 0x20, 0x00, 0x00, 0x2f, 0x20, 0x00,
+  0x00, 0x33, 0x20, 0x00, 0x00, 0x36, 0x20, 0x00, 0x00, 0x3e, 0x20, 0x00,
+  0x00, 0x44, 0x65, 0x62, 0x69, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x6e,
+  0x67, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34,
+  0x2e, 0x30, 0x2e, 0x36, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6b, 0x70,
+  0x72, 0x6f, 0x62, 0x65, 0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2e, 0x62,
+  0x70, 0x66, 0x2e, 0x63, 0x00, 0x2f, 0x6d, 0x6e, 0x74, 0x2f, 0x73, 0x72,
+  0x63, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69,
+  0x67, 0x00, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x75, 0x6e, 0x73, 0x69, 0x67,
+  0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x00, 0x75, 0x69, 0x6e, 0x74,
+  0x33, 0x32, 0x5f, 0x74, 0x00, 0x6d, 0x61, 0x73, 0x6b, 0x00, 0x74, 0x72,
+  0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x00, 0x64, 0x61, 0x74, 0x61,
+  0x5f, 0x6c, 0x65, 0x6e, 0x00, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 0x6e,
+  0x66, 0x75, 0x6e, 0x63, 0x73, 0x00, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72,
+  0x00, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x75,
+  0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+  0x00, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x00, 0x6e, 0x65,
+  0x74, 0x6e, 0x73, 0x00, 0x69, 0x66, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00,
+  0x73, 0x61, 0x64, 0x64, 0x72, 0x00, 0x5f, 0x5f, 0x41, 0x52, 0x52, 0x41,
+  0x59, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f,
+  0x5f, 0x00, 0x64, 0x61, 0x64, 0x64, 0x72, 0x00, 0x70, 0x72, 0x6f, 0x74,
+  0x6f, 0x63, 0x6f, 0x6c, 0x00, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+  0x64, 0x20, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x00, 0x75, 0x69, 0x6e, 0x74,
+  0x31, 0x36, 0x5f, 0x74, 0x00, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x00, 0x64,
+  0x70, 0x6f, 0x72, 0x74, 0x00, 0x6c, 0x34, 0x5f, 0x70, 0x72, 0x6f, 0x74,
+  0x6f, 0x63, 0x6f, 0x6c, 0x00, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+  0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x00, 0x75, 0x69, 0x6e, 0x74, 0x38,
+  0x5f, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x74,
+  0x65, 0x72, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63,
+  0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x00, 0x4c, 0x49, 0x43,
+  0x45, 0x4e, 0x53, 0x45, 0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x65, 0x76,
+  0x65, 0x6e, 0x74, 0x73, 0x00, 0x74, 0x79, 0x70, 0x65, 0x00, 0x69, 0x6e,
+  0x74, 0x00, 0x6b, 0x65, 0x79, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x63, 0x70,
+  0x75, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00, 0x6d, 0x61, 0x78, 0x5f,
+  0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x6b, 0x65, 0x79, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x73, 0x65, 0x71, 0x00, 0x6c, 0x6f,
+  0x73, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x63, 0x70, 0x75, 0x5f,
+  0x73, 0x74, 0x61, 0x74, 0x00, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x5f,
+  0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x00, 0x70, 0x61, 0x63, 0x6b,
+  0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x73, 0x00, 0x70, 0x61,
+  0x63, 0x6b, 0x65, 0x74, 0x5f, 0x69, 0x64, 0x00, 0x74, 0x73, 0x74, 0x61,
+  0x6d, 0x70, 0x00, 0x6e, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00,
+  0x64, 0x72, 0x6f, 0x70, 0x70, 0x65, 0x64, 0x00, 0x5f, 0x70, 0x61, 0x64,
+  0x00, 0x6e, 0x74, 0x72, 0x75, 0x6e, 0x63, 0x61, 0x74, 0x65, 0x64, 0x00,
+  0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x66, 0x75, 0x6e, 0x63,
+  0x5f, 0x69, 0x64, 0x00, 0x74, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x5f, 0x64,
+  0x65, 0x6c, 0x74, 0x61, 0x00, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x6f, 0x72, 0x5f, 0x69, 0x64, 0x00, 0x69, 0x73, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x70, 0x61, 0x63,
+  0x6b, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x65, 0x6e,
+  0x74, 0x72, 0x79, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x70, 0x61, 0x63,
+  0x6b, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x00, 0x70, 0x61,
+  0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x00, 0x74, 0x6f, 0x70, 0x00,
+  0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x00, 0x73, 0x6b, 0x62, 0x00, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x00, 0x6c, 0x61, 0x73, 0x74, 0x00, 0x73, 0x6b,
+  0x62, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x66, 0x72, 0x61, 0x6d, 0x65,
+  0x00, 0x73, 0x6b, 0x62, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x74,
+  0x61, 0x63, 0x6b, 0x00, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x5f,
+  0x73, 0x6b, 0x62, 0x73, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x73, 0x68, 0x00, 0x70, 0x69, 0x64, 0x5f, 0x74,
+  0x67, 0x69, 0x64, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x73, 0x68, 0x5f, 0x6b,
+  0x65, 0x79, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x69, 0x64, 0x73, 0x00,
+  0x66, 0x75, 0x6e, 0x63, 0x5f, 0x68, 0x69, 0x74, 0x73, 0x00, 0x73, 0x6b,
+  0x62, 0x5f, 0x73, 0x74, 0x61, 0x73, 0x68, 0x00, 0x73, 0x6b, 0x62, 0x5f,
+  0x73, 0x74, 0x61, 0x73, 0x68, 0x5f, 0x6b, 0x65, 0x79, 0x00, 0x62, 0x70,
+  0x66, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x5f, 0x70, 0x69, 0x64, 0x5f, 0x74, 0x67, 0x69, 0x64, 0x00, 0x75,
+  0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x5f, 0x5f, 0x75, 0x36, 0x34, 0x00,
+  0x62, 0x70, 0x66, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b,
+  0x75, 0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x62, 0x70, 0x66, 0x5f,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6b,
+  0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x5f,
+  0x5f, 0x75, 0x33, 0x32, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x6d, 0x61, 0x70,
+  0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x65, 0x6c, 0x65, 0x6d,
+  0x00, 0x62, 0x70, 0x66, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x62, 0x70, 0x66,
+  0x5f, 0x6b, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6e,
+  0x73, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x6d,
+  0x70, 0x5f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x5f,
+  0x69, 0x64, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62,
+  0x75, 0x66, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x62, 0x70,
+  0x66, 0x5f, 0x70, 0x65, 0x72, 0x66, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74,
+  0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x62, 0x70, 0x66, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x5f, 0x63,
+  0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x72, 0x69,
+  0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76,
+  0x65, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75,
+  0x66, 0x5f, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x00, 0x62, 0x70, 0x66,
+  0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f, 0x64, 0x69, 0x73,
+  0x63, 0x61, 0x72, 0x64, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x4c, 0x49,
+  0x4e, 0x45, 0x41, 0x47, 0x45, 0x5f, 0x53, 0x4b, 0x42, 0x5f, 0x43, 0x4c,
+  0x4f, 0x4e, 0x45, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x4c, 0x49, 0x4e,
+  0x45, 0x41, 0x47, 0x45, 0x5f, 0x53, 0x4b, 0x42, 0x5f, 0x43, 0x4f, 0x50,
+  0x59, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x41,
+  0x47, 0x45, 0x5f, 0x50, 0x53, 0x4b, 0x42, 0x5f, 0x43, 0x4f, 0x50, 0x59,
+  0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x41, 0x47,
+  0x45, 0x5f, 0x53, 0x4b, 0x42, 0x5f, 0x43, 0x4f, 0x50, 0x59, 0x5f, 0x45,
+  0x58, 0x50, 0x41, 0x4e, 0x44, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x4c,
+  0x49, 0x4e, 0x45, 0x41, 0x47, 0x45, 0x5f, 0x53, 0x4b, 0x42, 0x5f, 0x53,
+  0x45, 0x47, 0x4d, 0x45, 0x4e, 0x54, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f,
+  0x4c, 0x49, 0x4e, 0x45, 0x41, 0x47, 0x45, 0x5f, 0x4d, 0x41, 0x58, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65,
+  0x5f, 0x66, 0x75, 0x6e, 0x63, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x41,
+  0x4e, 0x59, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x4e, 0x4f, 0x45, 0x58, 0x49,
+  0x53, 0x54, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x45, 0x58, 0x49, 0x53, 0x54,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x5f, 0x4c, 0x4f, 0x43, 0x4b, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x49, 0x45, 0x4c, 0x44, 0x5f, 0x42, 0x59,
+  0x54, 0x45, 0x5f, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x49, 0x45, 0x4c, 0x44, 0x5f, 0x42, 0x59, 0x54, 0x45,
+  0x5f, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x49,
+  0x45, 0x4c, 0x44, 0x5f, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x49, 0x45, 0x4c, 0x44, 0x5f, 0x53, 0x49, 0x47,
+  0x4e, 0x45, 0x44, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x49, 0x45, 0x4c,
+  0x44, 0x5f, 0x4c, 0x53, 0x48, 0x49, 0x46, 0x54, 0x5f, 0x55, 0x36, 0x34,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x49, 0x45, 0x4c, 0x44, 0x5f, 0x52,
+  0x53, 0x48, 0x49, 0x46, 0x54, 0x5f, 0x55, 0x36, 0x34, 0x00, 0x62, 0x70,
+  0x66, 0x5f, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x5f, 0x69, 0x6e, 0x66, 0x6f,
+  0x5f, 0x6b, 0x69, 0x6e, 0x64, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x45,
+  0x56, 0x45, 0x4e, 0x54, 0x5f, 0x45, 0x4e, 0x54, 0x52, 0x59, 0x00, 0x49,
+  0x50, 0x46, 0x54, 0x5f, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x5f, 0x52, 0x45,
+  0x54, 0x55, 0x52, 0x4e, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x45, 0x56,
+  0x45, 0x4e, 0x54, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x41, 0x47, 0x45, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x74,
+  0x79, 0x70, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x75, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f,
+  0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x75,
+  0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f,
+  0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6b, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x6e, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d,
+  0x5f, 0x75, 0x33, 0x32, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x6d, 0x70, 0x5f, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x5f, 0x69, 0x64, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x33, 0x5f,
+  0x63, 0x73, 0x75, 0x6d, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x34,
+  0x5f, 0x63, 0x73, 0x75, 0x6d, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63,
+  0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74,
+  0x61, 0x69, 0x6c, 0x5f, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x5f,
+  0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x70, 0x69, 0x64, 0x5f, 0x74, 0x67,
+  0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f,
+  0x75, 0x69, 0x64, 0x5f, 0x67, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69,
+  0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6b, 0x62, 0x5f, 0x76, 0x6c, 0x61, 0x6e, 0x5f, 0x70, 0x75, 0x73, 0x68,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b,
+  0x62, 0x5f, 0x76, 0x6c, 0x61, 0x6e, 0x5f, 0x70, 0x6f, 0x70, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x74, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x5f, 0x6b,
+  0x65, 0x79, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x75, 0x6e, 0x6e,
+  0x65, 0x6c, 0x5f, 0x6b, 0x65, 0x79, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x70, 0x65, 0x72, 0x66, 0x5f, 0x65, 0x76, 0x65,
+  0x6e, 0x74, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63,
+  0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x61,
+  0x6c, 0x6d, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x70, 0x65, 0x72, 0x66, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f,
+  0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b,
+  0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x63, 0x73, 0x75, 0x6d, 0x5f, 0x64, 0x69, 0x66, 0x66, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x74, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x5f, 0x6f, 0x70,
+  0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6b, 0x62, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x75, 0x6e, 0x6e, 0x65,
+  0x6c, 0x5f, 0x6f, 0x70, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x75, 0x6e,
+  0x64, 0x65, 0x72, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+  0x68, 0x61, 0x73, 0x68, 0x5f, 0x72, 0x65, 0x63, 0x61, 0x6c, 0x63, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x61, 0x73,
+  0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70,
+  0x72, 0x6f, 0x62, 0x65, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x75,
+  0x73, 0x65, 0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x61, 0x73,
+  0x6b, 0x5f, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x5f, 0x63, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74,
+  0x61, 0x69, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x70, 0x75, 0x6c, 0x6c, 0x5f, 0x64, 0x61,
+  0x74, 0x61, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x63, 0x73, 0x75, 0x6d, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x74,
+  0x5f, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+  0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x6e, 0x75, 0x6d, 0x61, 0x5f, 0x6e, 0x6f, 0x64, 0x65,
+  0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f,
+  0x68, 0x65, 0x61, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74,
+  0x5f, 0x68, 0x65, 0x61, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72, 0x65, 0x61,
+  0x64, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+  0x74, 0x5f, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x6f,
+  0x63, 0x6b, 0x65, 0x74, 0x5f, 0x75, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x61,
+  0x73, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x65, 0x74, 0x73, 0x6f, 0x63, 0x6b, 0x6f, 0x70, 0x74, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x5f, 0x72, 0x6f, 0x6f, 0x6d, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65, 0x64,
+  0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x72, 0x65,
+  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6f, 0x63, 0x6b,
+  0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70,
+  0x5f, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x61,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x65,
+  0x72, 0x66, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x61,
+  0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x65, 0x72, 0x66, 0x5f, 0x70, 0x72,
+  0x6f, 0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67,
+  0x65, 0x74, 0x73, 0x6f, 0x63, 0x6b, 0x6f, 0x70, 0x74, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6f, 0x76, 0x65, 0x72, 0x72,
+  0x69, 0x64, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6f, 0x63, 0x6b,
+  0x5f, 0x6f, 0x70, 0x73, 0x5f, 0x63, 0x62, 0x5f, 0x66, 0x6c, 0x61, 0x67,
+  0x73, 0x5f, 0x73, 0x65, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72,
+  0x65, 0x63, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x63, 0x6f,
+  0x72, 0x6b, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x70, 0x75,
+  0x6c, 0x6c, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x62, 0x69, 0x6e, 0x64, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x61,
+  0x64, 0x6a, 0x75, 0x73, 0x74, 0x5f, 0x74, 0x61, 0x69, 0x6c, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x78, 0x66, 0x72, 0x6d, 0x5f, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x6c,
+  0x6f, 0x61, 0x64, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x5f, 0x72, 0x65,
+  0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x66, 0x69, 0x62, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b,
+  0x75, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6f, 0x63, 0x6b, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x75, 0x70,
+  0x64, 0x61, 0x74, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65,
+  0x63, 0x74, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x72, 0x65, 0x64, 0x69,
+  0x72, 0x65, 0x63, 0x74, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x77, 0x74, 0x5f, 0x70,
+  0x75, 0x73, 0x68, 0x5f, 0x65, 0x6e, 0x63, 0x61, 0x70, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x77, 0x74, 0x5f, 0x73,
+  0x65, 0x67, 0x36, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x5f, 0x62, 0x79,
+  0x74, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x6c, 0x77, 0x74, 0x5f, 0x73, 0x65, 0x67, 0x36, 0x5f, 0x61, 0x64,
+  0x6a, 0x75, 0x73, 0x74, 0x5f, 0x73, 0x72, 0x68, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x77, 0x74, 0x5f, 0x73, 0x65,
+  0x67, 0x36, 0x5f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x63, 0x5f, 0x72, 0x65,
+  0x70, 0x65, 0x61, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x72, 0x63, 0x5f, 0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b,
+  0x62, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x63, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x5f, 0x72, 0x65, 0x75, 0x73, 0x65, 0x70, 0x6f,
+  0x72, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6b, 0x62, 0x5f, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72,
+  0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x6c,
+  0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x74, 0x63, 0x70, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x6c, 0x6f,
+  0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x75, 0x64, 0x70, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x72, 0x65, 0x6c,
+  0x65, 0x61, 0x73, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x65,
+  0x6c, 0x65, 0x6d, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x70, 0x6f, 0x70, 0x5f, 0x65, 0x6c, 0x65,
+  0x6d, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d,
+  0x61, 0x70, 0x5f, 0x70, 0x65, 0x65, 0x6b, 0x5f, 0x65, 0x6c, 0x65, 0x6d,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x73,
+  0x67, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67,
+  0x5f, 0x70, 0x6f, 0x70, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x63, 0x5f, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x5f, 0x72, 0x65, 0x6c, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x70, 0x69, 0x6e, 0x5f,
+  0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x70, 0x69, 0x6e, 0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63,
+  0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6b, 0x5f, 0x66, 0x75, 0x6c, 0x6c, 0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x63, 0x70, 0x5f,
+  0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x65, 0x63, 0x6e, 0x5f, 0x73, 0x65,
+  0x74, 0x5f, 0x63, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+  0x65, 0x72, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x6c, 0x6f, 0x6f,
+  0x6b, 0x75, 0x70, 0x5f, 0x74, 0x63, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x5f, 0x73, 0x79, 0x6e, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x79,
+  0x73, 0x63, 0x74, 0x6c, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x61, 0x6d,
+  0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x79, 0x73, 0x63, 0x74, 0x6c, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x79, 0x73,
+  0x63, 0x74, 0x6c, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x65, 0x77, 0x5f,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x79, 0x73, 0x63, 0x74, 0x6c, 0x5f, 0x73, 0x65,
+  0x74, 0x5f, 0x6e, 0x65, 0x77, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x74, 0x72,
+  0x74, 0x6f, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x74, 0x72, 0x74, 0x6f, 0x75, 0x6c, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x74, 0x6f,
+  0x72, 0x61, 0x67, 0x65, 0x5f, 0x67, 0x65, 0x74, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x74, 0x6f,
+  0x72, 0x61, 0x67, 0x65, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x6e,
+  0x64, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x67, 0x65,
+  0x6e, 0x5f, 0x73, 0x79, 0x6e, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62,
+  0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72,
+  0x65, 0x61, 0x64, 0x5f, 0x75, 0x73, 0x65, 0x72, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f,
+  0x72, 0x65, 0x61, 0x64, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x75, 0x73, 0x65, 0x72,
+  0x5f, 0x73, 0x74, 0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64,
+  0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x5f, 0x73, 0x74, 0x72, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x63, 0x70,
+  0x5f, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x61, 0x63, 0x6b, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x6e, 0x64, 0x5f,
+  0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61,
+  0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6a,
+  0x69, 0x66, 0x66, 0x69, 0x65, 0x73, 0x36, 0x34, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x62,
+  0x72, 0x61, 0x6e, 0x63, 0x68, 0x5f, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64,
+  0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x6e, 0x73, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x5f, 0x70, 0x69, 0x64, 0x5f, 0x74, 0x67, 0x69, 0x64, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x65, 0x74, 0x6e,
+  0x73, 0x5f, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74,
+  0x6f, 0x72, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b,
+  0x5f, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6b, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x62, 0x6f, 0x6f, 0x74, 0x5f, 0x6e, 0x73, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x71, 0x5f,
+  0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x71, 0x5f, 0x77, 0x72, 0x69, 0x74,
+  0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6b, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f,
+  0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x5f, 0x63, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f,
+  0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66,
+  0x5f, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66,
+  0x5f, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75,
+  0x66, 0x5f, 0x71, 0x75, 0x65, 0x72, 0x79, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x73, 0x75, 0x6d, 0x5f, 0x6c, 0x65,
+  0x76, 0x65, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x63, 0x70, 0x36,
+  0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x63,
+  0x70, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74,
+  0x63, 0x70, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x77, 0x61, 0x69, 0x74, 0x5f,
+  0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x63, 0x70,
+  0x5f, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x5f, 0x73, 0x6f, 0x63,
+  0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x75, 0x64, 0x70, 0x36, 0x5f, 0x73,
+  0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f, 0x73, 0x74,
+  0x61, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x68, 0x64, 0x72, 0x5f, 0x6f, 0x70,
+  0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x74, 0x6f, 0x72, 0x65, 0x5f, 0x68, 0x64, 0x72, 0x5f, 0x6f, 0x70, 0x74,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65,
+  0x73, 0x65, 0x72, 0x76, 0x65, 0x5f, 0x68, 0x64, 0x72, 0x5f, 0x6f, 0x70,
+  0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x69,
+  0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
+  0x5f, 0x67, 0x65, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x69, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x73, 0x74, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x64, 0x5f, 0x70, 0x61,
+  0x74, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75, 0x73,
+  0x65, 0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6e, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x5f, 0x62, 0x74, 0x66,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65,
+  0x71, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x5f, 0x62, 0x74, 0x66,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b,
+  0x62, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x6e,
+  0x65, 0x69, 0x67, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x63, 0x70, 0x75, 0x5f, 0x70, 0x74,
+  0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74,
+  0x68, 0x69, 0x73, 0x5f, 0x63, 0x70, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65, 0x64,
+  0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x70, 0x65, 0x65, 0x72, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x61, 0x73, 0x6b,
+  0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x67, 0x65, 0x74,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x61,
+  0x73, 0x6b, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x64,
+  0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f, 0x62, 0x74, 0x66, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x62, 0x70, 0x72,
+  0x6d, 0x5f, 0x6f, 0x70, 0x74, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6b, 0x74, 0x69, 0x6d,
+  0x65, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x6f, 0x61, 0x72, 0x73, 0x65,
+  0x5f, 0x6e, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x69, 0x6d, 0x61, 0x5f, 0x69, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x68,
+  0x61, 0x73, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x66,
+  0x69, 0x6c, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x6d, 0x74, 0x75, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x66, 0x6f, 0x72, 0x5f,
+  0x65, 0x61, 0x63, 0x68, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x65, 0x6c, 0x65,
+  0x6d, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6e, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x79, 0x73, 0x5f, 0x62, 0x70, 0x66,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x62, 0x74,
+  0x66, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x62, 0x79, 0x5f, 0x6e, 0x61,
+  0x6d, 0x65, 0x5f, 0x6b, 0x69, 0x6e, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x79, 0x73, 0x5f, 0x63, 0x6c, 0x6f,
+  0x73, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x74, 0x69, 0x6d, 0x65, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x69, 0x6d, 0x65,
+  0x72, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61,
+  0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x74, 0x69, 0x6d, 0x65, 0x72, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x69, 0x6d,
+  0x65, 0x72, 0x5f, 0x63, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x66,
+  0x75, 0x6e, 0x63, 0x5f, 0x69, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x61, 0x74, 0x74, 0x61,
+  0x63, 0x68, 0x5f, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f,
+  0x70, 0x74, 0x5f, 0x72, 0x65, 0x67, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x72, 0x61,
+  0x6e, 0x63, 0x68, 0x5f, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x72,
+  0x61, 0x63, 0x65, 0x5f, 0x76, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6b, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x63,
+  0x5f, 0x74, 0x6f, 0x5f, 0x75, 0x6e, 0x69, 0x78, 0x5f, 0x73, 0x6f, 0x63,
+  0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6b,
+  0x61, 0x6c, 0x6c, 0x73, 0x79, 0x6d, 0x73, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b,
+  0x75, 0x70, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x76, 0x6d,
+  0x61, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c,
+  0x6f, 0x6f, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x74, 0x72, 0x6e, 0x63, 0x6d, 0x70, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x75,
+  0x6e, 0x63, 0x5f, 0x61, 0x72, 0x67, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63,
+  0x5f, 0x72, 0x65, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x61,
+  0x72, 0x67, 0x5f, 0x63, 0x6e, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x74, 0x76,
+  0x61, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x5f, 0x6c, 0x65, 0x6e,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64,
+  0x70, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64,
+  0x70, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65,
+  0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63,
+  0x6f, 0x70, 0x79, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75, 0x73, 0x65,
+  0x72, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+  0x74, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x69, 0x6d, 0x61, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+  0x5f, 0x68, 0x61, 0x73, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x6b, 0x70, 0x74, 0x72, 0x5f, 0x78, 0x63, 0x68, 0x67,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61,
+  0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x70, 0x65, 0x72,
+  0x63, 0x70, 0x75, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x5f, 0x5f, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x4d, 0x41, 0x58, 0x5f,
+  0x49, 0x44, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x5f,
+  0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x45, 0x4e, 0x55, 0x4d, 0x56,
+  0x41, 0x4c, 0x5f, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x45, 0x4e, 0x55, 0x4d, 0x56, 0x41, 0x4c, 0x5f, 0x56, 0x41,
+  0x4c, 0x55, 0x45, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x65, 0x6e, 0x75, 0x6d,
+  0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x5f, 0x6b, 0x69, 0x6e, 0x64, 0x00,
+  0x49, 0x50, 0x46, 0x54, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x50, 0x4f,
+  0x52, 0x54, 0x5f, 0x55, 0x4e, 0x53, 0x50, 0x45, 0x43, 0x00, 0x49, 0x50,
+  0x46, 0x54, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x50, 0x4f, 0x52, 0x54,
+  0x5f, 0x50, 0x45, 0x52, 0x46, 0x00, 0x49, 0x50, 0x46, 0x54, 0x5f, 0x54,
+  0x52, 0x41, 0x4e, 0x53, 0x50, 0x4f, 0x52, 0x54, 0x5f, 0x52, 0x49, 0x4e,
+  0x47, 0x42, 0x55, 0x46, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x74, 0x72,
+  0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x5f, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x5f, 0x4d, 0x41, 0x53,
+  0x4b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x5f, 0x43, 0x55, 0x52, 0x52,
+  0x45, 0x4e, 0x54, 0x5f, 0x43, 0x50, 0x55, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x5f, 0x43, 0x54, 0x58, 0x4c, 0x45, 0x4e, 0x5f, 0x4d, 0x41, 0x53,
+  0x4b, 0x00, 0x6e, 0x65, 0x78, 0x74, 0x00, 0x73, 0x6b, 0x00, 0x5f, 0x5f,
+  0x73, 0x6b, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x00, 0x73, 0x6b,
+  0x63, 0x5f, 0x6e, 0x65, 0x74, 0x00, 0x6e, 0x65, 0x74, 0x00, 0x6e, 0x73,
+  0x00, 0x69, 0x6e, 0x75, 0x6d, 0x00, 0x6e, 0x73, 0x5f, 0x63, 0x6f, 0x6d,
+  0x6d, 0x6f, 0x6e, 0x00, 0x73, 0x6f, 0x63, 0x6b, 0x5f, 0x63, 0x6f, 0x6d,
+  0x6d, 0x6f, 0x6e, 0x00, 0x73, 0x6b, 0x5f, 0x63, 0x67, 0x72, 0x70, 0x5f,
+  0x64, 0x61, 0x74, 0x61, 0x00, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x00,
+  0x6b, 0x6e, 0x00, 0x69, 0x64, 0x00, 0x6b, 0x65, 0x72, 0x6e, 0x66, 0x73,
+  0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x00, 0x73, 0x6f, 0x63, 0x6b, 0x5f, 0x63,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x73,
+  0x6f, 0x63, 0x6b, 0x00, 0x64, 0x65, 0x76, 0x00, 0x6e, 0x64, 0x5f, 0x6e,
+  0x65, 0x74, 0x00, 0x6e, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x76, 0x69, 0x63,
+  0x65, 0x00, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x5f,
+  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x6e, 0x65, 0x74, 0x77, 0x6f,
+  0x72, 0x6b, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x68, 0x65,
+  0x61, 0x64, 0x00, 0x75, 0x73, 0x65, 0x72, 0x73, 0x00, 0x72, 0x65, 0x66,
+  0x73, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x73, 0x6b,
+  0x5f, 0x62, 0x75, 0x66, 0x66, 0x00, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74,
+  0x5f, 0x69, 0x64, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65,
+  0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x76, 0x61, 0x6c, 0x00, 0x63,
+  0x6f, 0x6e, 0x66, 0x00, 0x65, 0x6d, 0x69, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x00, 0x63, 0x74, 0x78, 0x00, 0x63, 0x68, 0x69,
+  0x6c, 0x64, 0x00, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x00, 0x65, 0x76,
+  0x00, 0x65, 0x00, 0x64, 0x61, 0x74, 0x61, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x00, 0x72, 0x61, 0x77, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f,
+  0x65, 0x76, 0x65, 0x6e, 0x74, 0x00, 0x6f, 0x6e, 0x65, 0x00, 0x6c, 0x00,
+  0x73, 0x74, 0x61, 0x74, 0x00, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x70, 0x75,
+  0x5f, 0x73, 0x74, 0x61, 0x74, 0x00, 0x69, 0x64, 0x78, 0x00, 0x66, 0x72,
+  0x65, 0x65, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x69, 0x6e, 0x69,
+  0x74, 0x00, 0x73, 0x74, 0x00, 0x6e, 0x00, 0x66, 0x00, 0x5f, 0x5f, 0x72,
+  0x00, 0x67, 0x65, 0x74, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f,
+  0x6b, 0x65, 0x79, 0x00, 0x65, 0x6e, 0x64, 0x5f, 0x70, 0x61, 0x63, 0x6b,
+  0x65, 0x74, 0x00, 0x72, 0x65, 0x63, 0x00, 0x65, 0x6d, 0x69, 0x74, 0x5f,
+  0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65,
+  0x00, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x5f, 0x42, 0x6f, 0x6f, 0x6c, 0x00, 0x73, 0x74,
+  0x61, 0x73, 0x68, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x67, 0x65, 0x74, 0x5f,
+  0x66, 0x75, 0x6e, 0x63, 0x5f, 0x69, 0x64, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+  0x6f, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x6e, 0x6f, 0x77, 0x00,
+  0x65, 0x6e, 0x74, 0x00, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x00, 0x65, 0x6d,
+  0x69, 0x74, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x00, 0x62,
+  0x75, 0x66, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x65, 0x76, 0x65, 0x6e,
+  0x74, 0x5f, 0x62, 0x75, 0x66, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00,
+  0x66, 0x69, 0x6c, 0x6c, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x00, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x5f, 0x68, 0x69, 0x74, 0x00, 0x68, 0x69, 0x74,
+  0x73, 0x00, 0x65, 0x6d, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x66, 0x00,
+  0x75, 0x6e, 0x73, 0x74, 0x61, 0x73, 0x68, 0x5f, 0x73, 0x6b, 0x62, 0x00,
+  0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x00, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x00, 0x5f, 0x5f, 0x74, 0x00, 0x67,
+  0x65, 0x74, 0x5f, 0x6e, 0x65, 0x74, 0x6e, 0x73, 0x00, 0x67, 0x65, 0x74,
+  0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x74,
+  0x75, 0x70, 0x6c, 0x65, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x70,
+  0x6f, 0x72, 0x74, 0x73, 0x00, 0x69, 0x70, 0x68, 0x00, 0x76, 0x65, 0x72,
+  0x5f, 0x69, 0x68, 0x6c, 0x00, 0x74, 0x6f, 0x73, 0x00, 0x74, 0x6f, 0x74,
+  0x5f, 0x6c, 0x65, 0x6e, 0x00, 0x66, 0x72, 0x61, 0x67, 0x5f, 0x6f, 0x66,
+  0x66, 0x00, 0x74, 0x74, 0x6c, 0x00, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x00,
+  0x69, 0x70, 0x68, 0x64, 0x72, 0x00, 0x69, 0x70, 0x36, 0x68, 0x00, 0x76,
+  0x65, 0x72, 0x5f, 0x74, 0x63, 0x5f, 0x66, 0x6c, 0x6f, 0x77, 0x00, 0x70,
+  0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x6c, 0x65, 0x6e, 0x00, 0x6e,
+  0x65, 0x78, 0x74, 0x68, 0x64, 0x72, 0x00, 0x68, 0x6f, 0x70, 0x5f, 0x6c,
+  0x69, 0x6d, 0x69, 0x74, 0x00, 0x69, 0x70, 0x76, 0x36, 0x68, 0x64, 0x72,
+  0x00, 0x66, 0x72, 0x61, 0x67, 0x00, 0x6f, 0x66, 0x66, 0x00, 0x69, 0x6e,
+  0x65, 0x74, 0x36, 0x00, 0x61, 0x64, 0x64, 0x72, 0x5f, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x00, 0x77, 0x61, 0x6e, 0x74, 0x00, 0x61, 0x64, 0x64, 0x72,
+  0x00, 0x44, 0x57, 0x5f, 0x41, 0x54, 0x45, 0x5f, 0x75, 0x6e, 0x73, 0x69,
+  0x67, 0x6e, 0x65, 0x64, 0x5f, 0x38, 0x00, 0x44, 0x57, 0x5f, 0x41, 0x54,
+  0x45, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x31,
+  0x00, 0x44, 0x57, 0x5f, 0x41, 0x54, 0x45, 0x5f, 0x75, 0x6e, 0x73, 0x69,
+  0x67, 0x6e, 0x65, 0x64, 0x5f, 0x33, 0x32, 0x00, 0x44, 0x57, 0x5f, 0x41,
+  0x54, 0x45, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+  0x36, 0x34, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+  0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e,
+  0x65, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61,
+  0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b,
+  0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x6c, 0x69, 0x6e, 0x65,
+  0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70,
+  0x79, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61,
+  0x67, 0x65, 0x5f, 0x5f, 0x5f, 0x70, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f,
+  0x70, 0x79, 0x5f, 0x66, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x69, 0x70,
+  0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x5f, 0x5f, 0x70, 0x73, 0x6b, 0x62,
+  0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x63, 0x6c, 0x6f, 0x6e, 0x65,
+  0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67,
+  0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73,
+  0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65, 0x67, 0x6d, 0x65,
+  0x6e, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b,
+  0x62, 0x00, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65,
+  0x61, 0x73, 0x6f, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72,
+  0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x6b, 0x66,
+  0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73,
+  0x6f, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73,
+  0x6f, 0x6e, 0x5f, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73,
+  0x6f, 0x6e, 0x5f, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d,
+  0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66,
+  0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x63,
+  0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x6e, 0x61, 0x70,
+  0x69, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b,
+  0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x6e, 0x61, 0x70, 0x69, 0x5f,
+  0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x5f, 0x5f,
+  0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x69, 0x70,
+  0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x5f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73,
+  0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e,
+  0x30, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x62, 0x6f, 0x64, 0x79, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x31, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x32, 0x00, 0x69, 0x70,
+  0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x33, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x34, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x00, 0x73, 0x6b, 0x62, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x72,
+  0x31, 0x35, 0x00, 0x72, 0x31, 0x34, 0x00, 0x72, 0x31, 0x33, 0x00, 0x72,
+  0x31, 0x32, 0x00, 0x72, 0x62, 0x70, 0x00, 0x72, 0x62, 0x78, 0x00, 0x72,
+  0x31, 0x31, 0x00, 0x72, 0x31, 0x30, 0x00, 0x72, 0x39, 0x00, 0x72, 0x38,
+  0x00, 0x72, 0x61, 0x78, 0x00, 0x72, 0x63, 0x78, 0x00, 0x72, 0x64, 0x78,
+  0x00, 0x72, 0x73, 0x69, 0x00, 0x72, 0x64, 0x69, 0x00, 0x6f, 0x72, 0x69,
+  0x67, 0x5f, 0x72, 0x61, 0x78, 0x00, 0x72, 0x69, 0x70, 0x00, 0x63, 0x73,
+  0x00, 0x65, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x00, 0x72, 0x73, 0x70, 0x00,
+  0x73, 0x73, 0x00, 0x70, 0x74, 0x5f, 0x72, 0x65, 0x67, 0x73, 0x00, 0x69,
+  0x00, 0x9c, 0x03, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xd8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x68, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x68, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xd8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xd0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x50, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x78, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xeb, 0x01, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x16, 0x00, 0x00,
+  0xec, 0x16, 0x00, 0x00, 0x1a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04,
+  0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+  0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x18, 0x06, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x24, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x2f, 0x00, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04,
+  0x48, 0x00, 0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04,
+  0x10, 0x00, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+  0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x39, 0x00, 0x00, 0x00,
+  0xdf, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00,
+  0xf1, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x3a, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+  0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x3e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0x00,
+  0x20, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00,
+  0xf1, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3e, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x2e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x42, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x45, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x15, 0x00, 0x00, 0x04,
+  0xa8, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x40, 0x01, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc0, 0x01, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x40, 0x02, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x02, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc0, 0x02, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x40, 0x03, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x03, 0x00, 0x00, 0x7a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc0, 0x03, 0x00, 0x00, 0x83, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x87, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x40, 0x04, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc0, 0x04, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x9c, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x46, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xdf, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x04, 0x38, 0x00, 0x00, 0x00, 0x19, 0x03, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x21, 0x03, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x2a, 0x03, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x33, 0x03, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x53, 0x03, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x5e, 0x03, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x63, 0x03, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x6b, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0xfa, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x71, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x52, 0x00, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x96, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbf, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xf1, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x04, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x4a, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x81, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x9a, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xc6, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xde, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x19, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x33, 0x05, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x4f, 0x05, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x66, 0x05, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x7c, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xb4, 0x05, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xcd, 0x05, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xdf, 0x05, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x13, 0x06, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x2b, 0x06, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x53, 0x06, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x6f, 0x06, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x8b, 0x06, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0xa5, 0x06, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0xf1, 0x06, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x07, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x25, 0x07, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x48, 0x07, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x61, 0x07, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x8d, 0x07, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xa7, 0x07, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0xc1, 0x07, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xda, 0x07, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xf3, 0x07, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x0b, 0x08, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x26, 0x08, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x3e, 0x08, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x64, 0x08, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x7d, 0x08, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x93, 0x08, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xac, 0x08, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc5, 0x08, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xde, 0x08, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xfd, 0x08, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1b, 0x09, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x2f, 0x09, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x48, 0x09, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x67, 0x09, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x81, 0x09, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x9a, 0x09, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xb2, 0x09, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0xc9, 0x09, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xd7, 0x09, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf0, 0x09, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x1f, 0x0a, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x54, 0x0a, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x6e, 0x0a, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x89, 0x0a, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xa3, 0x0a, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0xbb, 0x0a, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xd9, 0x0a, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0xf6, 0x0a, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x0f, 0x0b, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x22, 0x0b, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x36, 0x0b, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x4d, 0x0b, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6c, 0x0b, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x87, 0x0b, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0xa4, 0x0b, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0xc4, 0x0b, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0xdb, 0x0b, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0xf2, 0x0b, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x1d, 0x0c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x33, 0x0c, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x4a, 0x0c, 0x00, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x61, 0x0c, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x77, 0x0c, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x8f, 0x0c, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0xa2, 0x0c, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0xb7, 0x0c, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xcc, 0x0c, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xde, 0x0c, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0xf6, 0x0c, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x11, 0x0d, 0x00, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x29, 0x0d, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x46, 0x0d, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x5f, 0x0d, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x81, 0x0d, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x9f, 0x0d, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xbd, 0x0d, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0xcd, 0x0d, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0xde, 0x0d, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0xf6, 0x0d, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x26, 0x0e, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x55, 0x0e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x6e, 0x0e, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x89, 0x0e, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0xa6, 0x0e, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0xc5, 0x0e, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xdb, 0x0e, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0xf7, 0x0e, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x0a, 0x0f, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x27, 0x0f, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x48, 0x0f, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x5c, 0x0f, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x76, 0x0f, 0x00, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x9e, 0x0f, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0xb1, 0x0f, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xcc, 0x0f, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0xf3, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x28, 0x10, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x40, 0x10, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x59, 0x10, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x71, 0x10, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x8a, 0x10, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0xa1, 0x10, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0xb5, 0x10, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0xcf, 0x10, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xe8, 0x10, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x2b, 0x11, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x45, 0x11, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x5d, 0x11, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x73, 0x11, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8a, 0x11, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0xa3, 0x11, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0xbe, 0x11, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xdc, 0x11, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0xec, 0x11, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x04, 0x12, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x1a, 0x12, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x32, 0x12, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x4e, 0x12, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x66, 0x12, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x7b, 0x12, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x91, 0x12, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa8, 0x12, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xc2, 0x12, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0xdf, 0x12, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xfd, 0x12, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x14, 0x13, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x31, 0x13, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x49, 0x13, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x61, 0x13, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x74, 0x13, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x8f, 0x13, 0x00, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0xa1, 0x13, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0xb2, 0x13, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xd1, 0x13, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xe4, 0x13, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0xf8, 0x13, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x29, 0x14, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x3f, 0x14, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x54, 0x14, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x6f, 0x14, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x85, 0x14, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa2, 0x14, 0x00, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0xb9, 0x14, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0xd3, 0x14, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xf1, 0x14, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0x03, 0x15, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x11, 0x15, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x22, 0x15, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x38, 0x15, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x4e, 0x15, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x68, 0x15, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x7c, 0x15, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x90, 0x15, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xaa, 0x15, 0x00, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0xc2, 0x15, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xdb, 0x15, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xf8, 0x15, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x10, 0x16, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x27, 0x16, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x3a, 0x16, 0x00, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0x5a, 0x16, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x70, 0x16, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x96, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0xc6, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x59, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x44, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x78, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x5f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xb6, 0x17, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xe2, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x18, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x65, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x45, 0x18, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x74, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x80, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x6b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xb3, 0x18, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xf0, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x27, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x71, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x68, 0x19, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x91, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0xc4, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf7, 0x19, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x34, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x5d, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x7d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x90, 0x1a, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x60, 0x01, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xd4, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xde, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x01, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x85, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x24, 0x1b, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x47, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0d,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x6a, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x8b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x8f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00,
+  0x99, 0x1b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x50, 0x00, 0x00, 0x00,
+  0x25, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xab, 0x1b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xb0, 0x1b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xba, 0x1b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xc3, 0x1b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xc9, 0x1b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0xd0, 0x1b, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xd7, 0x1b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x04, 0x38, 0x00, 0x00, 0x00,
+  0xe3, 0x1b, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xed, 0x1b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xf3, 0x1b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xfb, 0x1b, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x1c, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x2a, 0x03, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x07, 0x1c, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
+  0x0d, 0x1c, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00,
+  0x13, 0x1c, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0xc3, 0x1b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x94, 0x00, 0x00, 0x00,
+  0xb3, 0x01, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x24, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x2a, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x93, 0x00, 0x00, 0x00, 0x3c, 0x1c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0xf3, 0x1b, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x1c, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x4e, 0x1c, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x9e, 0x00, 0x00, 0x00, 0x5c, 0x1c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x61, 0x1c, 0x00, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x1c, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7a, 0x1c, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x86, 0x1c, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x4e, 0x1c, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x1c, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x9f, 0x1c, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x00, 0x4e, 0x1c, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0xae, 0x1c, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x1c, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0xbb, 0x1c, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x1c, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0xc6, 0x1c, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xa2, 0x00, 0x00, 0x00, 0xc9, 0x1c, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0xd5, 0x1c, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xf5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0xa5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0x1c, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x12, 0x1d, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x74,
+  0x00, 0x5f, 0x5f, 0x41, 0x52, 0x52, 0x41, 0x59, 0x5f, 0x53, 0x49, 0x5a,
+  0x45, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x5f, 0x00, 0x74, 0x79, 0x70,
+  0x65, 0x00, 0x6b, 0x65, 0x79, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x65, 0x76,
+  0x65, 0x6e, 0x74, 0x73, 0x00, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f,
+  0x74, 0x00, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+  0x6e, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x63, 0x70, 0x75, 0x5f,
+  0x73, 0x74, 0x61, 0x74, 0x00, 0x73, 0x65, 0x71, 0x00, 0x6c, 0x6f, 0x73,
+  0x74, 0x00, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x74, 0x00, 0x75,
+  0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+  0x00, 0x6d, 0x61, 0x78, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73,
+  0x00, 0x6b, 0x65, 0x79, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x63,
+  0x70, 0x75, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00, 0x65, 0x76, 0x65,
+  0x6e, 0x74, 0x73, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x5f,
+  0x74, 0x72, 0x61, 0x63, 0x65, 0x00, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+  0x5f, 0x69, 0x64, 0x00, 0x74, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x00, 0x6e,
+  0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x64, 0x72, 0x6f, 0x70,
+  0x70, 0x65, 0x64, 0x00, 0x5f, 0x70, 0x61, 0x64, 0x00, 0x6e, 0x74, 0x72,
+  0x75, 0x6e, 0x63, 0x61, 0x74, 0x65, 0x64, 0x00, 0x65, 0x6e, 0x74, 0x72,
+  0x69, 0x65, 0x73, 0x00, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x74,
+  0x00, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x73, 0x68,
+  0x6f, 0x72, 0x74, 0x00, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x5f, 0x74, 0x00,
+  0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+  0x72, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x70, 0x61, 0x63, 0x6b, 0x65,
+  0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x65, 0x6e, 0x74, 0x72,
+  0x79, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x69, 0x64, 0x00, 0x74, 0x73,
+  0x74, 0x61, 0x6d, 0x70, 0x5f, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x00, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x5f, 0x69, 0x64, 0x00,
+  0x69, 0x73, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x70, 0x61,
+  0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x73, 0x00,
+  0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x66, 0x72,
+  0x65, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x74, 0x6f, 0x70,
+  0x00, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x00, 0x73, 0x6b, 0x62, 0x5f,
+  0x66, 0x72, 0x65, 0x65, 0x5f, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x00, 0x73,
+  0x6b, 0x62, 0x00, 0x64, 0x65, 0x70, 0x74, 0x68, 0x00, 0x6c, 0x61, 0x73,
+  0x74, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73,
+  0x74, 0x61, 0x63, 0x6b, 0x73, 0x00, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x65,
+  0x64, 0x5f, 0x73, 0x6b, 0x62, 0x73, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x61,
+  0x67, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x73, 0x68, 0x5f, 0x6b, 0x65, 0x79,
+  0x00, 0x70, 0x69, 0x64, 0x5f, 0x74, 0x67, 0x69, 0x64, 0x00, 0x66, 0x75,
+  0x6e, 0x63, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x73,
+  0x74, 0x61, 0x73, 0x68, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x69, 0x64,
+  0x73, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x68, 0x69, 0x74, 0x73, 0x00,
+  0x73, 0x6b, 0x62, 0x5f, 0x73, 0x74, 0x61, 0x73, 0x68, 0x5f, 0x6b, 0x65,
+  0x79, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x74, 0x61, 0x73, 0x68, 0x00,
+  0x70, 0x74, 0x5f, 0x72, 0x65, 0x67, 0x73, 0x00, 0x72, 0x31, 0x35, 0x00,
+  0x72, 0x31, 0x34, 0x00, 0x72, 0x31, 0x33, 0x00, 0x72, 0x31, 0x32, 0x00,
+  0x72, 0x62, 0x70, 0x00, 0x72, 0x62, 0x78, 0x00, 0x72, 0x31, 0x31, 0x00,
+  0x72, 0x31, 0x30, 0x00, 0x72, 0x39, 0x00, 0x72, 0x38, 0x00, 0x72, 0x61,
+  0x78, 0x00, 0x72, 0x63, 0x78, 0x00, 0x72, 0x64, 0x78, 0x00, 0x72, 0x73,
+  0x69, 0x00, 0x72, 0x64, 0x69, 0x00, 0x6f, 0x72, 0x69, 0x67, 0x5f, 0x72,
+  0x61, 0x78, 0x00, 0x72, 0x69, 0x70, 0x00, 0x63, 0x73, 0x00, 0x65, 0x66,
+  0x6c, 0x61, 0x67, 0x73, 0x00, 0x72, 0x73, 0x70, 0x00, 0x73, 0x73, 0x00,
+  0x63, 0x74, 0x78, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6c, 0x6f,
+  0x6e, 0x65, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b,
+  0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x2f, 0x6d, 0x6e, 0x74,
+  0x2f, 0x73, 0x72, 0x63, 0x2f, 0x2e, 0x2f, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x62, 0x6f, 0x64, 0x79, 0x2e, 0x62, 0x70, 0x66, 0x2e, 0x68, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63,
+  0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65,
+  0x00, 0x73, 0x6b, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x00, 0x6e, 0x65, 0x78,
+  0x74, 0x00, 0x73, 0x6b, 0x00, 0x64, 0x65, 0x76, 0x00, 0x6d, 0x61, 0x72,
+  0x6b, 0x00, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x00, 0x74,
+  0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x68, 0x65, 0x61,
+  0x64, 0x65, 0x72, 0x00, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
+  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x68, 0x65, 0x61, 0x64, 0x00,
+  0x75, 0x73, 0x65, 0x72, 0x73, 0x00, 0x72, 0x65, 0x66, 0x73, 0x00, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x63, 0x68, 0x69, 0x6c, 0x64,
+  0x00, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x30, 0x3a,
+  0x30, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x69,
+  0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x75,
+  0x6e, 0x73, 0x70, 0x65, 0x63, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75,
+  0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x75, 0x70, 0x64, 0x61,
+  0x74, 0x65, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f,
+  0x72, 0x65, 0x61, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x6b, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+  0x6e, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6b,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65,
+  0x74, 0x5f, 0x70, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x5f, 0x75, 0x33,
+  0x32, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x73, 0x6d, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x6f, 0x72, 0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x74, 0x6f,
+  0x72, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x33, 0x5f, 0x63, 0x73, 0x75,
+  0x6d, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x34, 0x5f, 0x63, 0x73,
+  0x75, 0x6d, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x61, 0x69, 0x6c,
+  0x5f, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x5f, 0x72, 0x65, 0x64,
+  0x69, 0x72, 0x65, 0x63, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x5f, 0x70, 0x69, 0x64, 0x5f, 0x74, 0x67, 0x69, 0x64, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x75, 0x69, 0x64,
+  0x5f, 0x67, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x5f, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x64, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x76, 0x6c, 0x61, 0x6e, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x76,
+  0x6c, 0x61, 0x6e, 0x5f, 0x70, 0x6f, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x74, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x5f, 0x6b, 0x65, 0x79, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62,
+  0x5f, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x5f,
+  0x6b, 0x65, 0x79, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x70, 0x65, 0x72, 0x66, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f,
+  0x72, 0x65, 0x61, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+  0x72, 0x6f, 0x75, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x6d, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x65, 0x72,
+  0x66, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6b, 0x62, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x62, 0x79, 0x74,
+  0x65, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x69, 0x64, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x73, 0x75,
+  0x6d, 0x5f, 0x64, 0x69, 0x66, 0x66, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+  0x74, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x5f, 0x6f, 0x70, 0x74, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x73, 0x65, 0x74, 0x5f, 0x74, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x5f, 0x6f,
+  0x70, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x70,
+  0x72, 0x6f, 0x74, 0x6f, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x75, 0x6e, 0x64, 0x65, 0x72,
+  0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x61, 0x73,
+  0x68, 0x5f, 0x72, 0x65, 0x63, 0x61, 0x6c, 0x63, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x75, 0x73, 0x65, 0x72,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f, 0x75,
+  0x6e, 0x64, 0x65, 0x72, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62,
+  0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x74, 0x61, 0x69, 0x6c,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b,
+  0x62, 0x5f, 0x70, 0x75, 0x6c, 0x6c, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x73, 0x75,
+  0x6d, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x61,
+  0x73, 0x68, 0x5f, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+  0x6e, 0x75, 0x6d, 0x61, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x69, 0x64,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b,
+  0x62, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x68, 0x65, 0x61,
+  0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78,
+  0x64, 0x70, 0x5f, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x5f, 0x68, 0x65,
+  0x61, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73,
+  0x74, 0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x63,
+  0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+  0x74, 0x5f, 0x75, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x74,
+  0x73, 0x6f, 0x63, 0x6b, 0x6f, 0x70, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x61, 0x64, 0x6a,
+  0x75, 0x73, 0x74, 0x5f, 0x72, 0x6f, 0x6f, 0x6d, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65,
+  0x63, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72,
+  0x65, 0x63, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x5f, 0x6d, 0x61,
+  0x70, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x61, 0x64,
+  0x6a, 0x75, 0x73, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x65, 0x72, 0x66, 0x5f,
+  0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x70, 0x65, 0x72, 0x66, 0x5f, 0x70, 0x72, 0x6f, 0x67, 0x5f,
+  0x72, 0x65, 0x61, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x73,
+  0x6f, 0x63, 0x6b, 0x6f, 0x70, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x6f, 0x76, 0x65, 0x72, 0x72, 0x69, 0x64, 0x65,
+  0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x5f, 0x6f, 0x70,
+  0x73, 0x5f, 0x63, 0x62, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x73,
+  0x65, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x6d, 0x73, 0x67, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+  0x5f, 0x6d, 0x61, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x5f,
+  0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x63, 0x6f, 0x72, 0x6b, 0x5f,
+  0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x70, 0x75, 0x6c, 0x6c, 0x5f,
+  0x64, 0x61, 0x74, 0x61, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x62, 0x69, 0x6e, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x61, 0x64, 0x6a, 0x75,
+  0x73, 0x74, 0x5f, 0x74, 0x61, 0x69, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x78, 0x66, 0x72, 0x6d, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x6c, 0x6f, 0x61, 0x64,
+  0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x5f, 0x72, 0x65, 0x6c, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x66, 0x69, 0x62, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6f, 0x63,
+  0x6b, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74,
+  0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d,
+  0x73, 0x67, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f,
+  0x68, 0x61, 0x73, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63,
+  0x74, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x77, 0x74, 0x5f, 0x70, 0x75, 0x73, 0x68,
+  0x5f, 0x65, 0x6e, 0x63, 0x61, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x77, 0x74, 0x5f, 0x73, 0x65, 0x67, 0x36,
+  0x5f, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x77,
+  0x74, 0x5f, 0x73, 0x65, 0x67, 0x36, 0x5f, 0x61, 0x64, 0x6a, 0x75, 0x73,
+  0x74, 0x5f, 0x73, 0x72, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x6c, 0x77, 0x74, 0x5f, 0x73, 0x65, 0x67, 0x36, 0x5f,
+  0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x72, 0x63, 0x5f, 0x72, 0x65, 0x70, 0x65, 0x61,
+  0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72,
+  0x63, 0x5f, 0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70,
+  0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73,
+  0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x5f, 0x72, 0x65, 0x75, 0x73, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62,
+  0x5f, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x5f, 0x63, 0x67,
+  0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b,
+  0x75, 0x70, 0x5f, 0x74, 0x63, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75,
+  0x70, 0x5f, 0x75, 0x64, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d,
+  0x61, 0x70, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x65, 0x6c, 0x65, 0x6d,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61,
+  0x70, 0x5f, 0x70, 0x6f, 0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f,
+  0x70, 0x65, 0x65, 0x6b, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x70,
+  0x75, 0x73, 0x68, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x73, 0x67, 0x5f, 0x70, 0x6f,
+  0x70, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x72, 0x63, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x5f, 0x72, 0x65, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x70, 0x69, 0x6e, 0x5f, 0x6c, 0x6f, 0x63,
+  0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x70, 0x69, 0x6e, 0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x66,
+  0x75, 0x6c, 0x6c, 0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x73, 0x6f, 0x63,
+  0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6b, 0x62, 0x5f, 0x65, 0x63, 0x6e, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x63,
+  0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x5f,
+  0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70,
+  0x5f, 0x74, 0x63, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f,
+  0x73, 0x79, 0x6e, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x79, 0x73, 0x63, 0x74,
+  0x6c, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x79, 0x73, 0x63,
+  0x74, 0x6c, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x79, 0x73, 0x63, 0x74, 0x6c,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x65, 0x77, 0x5f, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x79, 0x73, 0x63, 0x74, 0x6c, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x6e,
+  0x65, 0x77, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x74, 0x72, 0x74, 0x6f, 0x6c,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x74,
+  0x72, 0x74, 0x6f, 0x75, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67,
+  0x65, 0x5f, 0x67, 0x65, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67,
+  0x65, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x73,
+  0x69, 0x67, 0x6e, 0x61, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x67, 0x65, 0x6e, 0x5f, 0x73,
+  0x79, 0x6e, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64,
+  0x5f, 0x75, 0x73, 0x65, 0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72, 0x65, 0x61,
+  0x64, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f,
+  0x72, 0x65, 0x61, 0x64, 0x5f, 0x75, 0x73, 0x65, 0x72, 0x5f, 0x73, 0x74,
+  0x72, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70,
+  0x72, 0x6f, 0x62, 0x65, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6b, 0x65,
+  0x72, 0x6e, 0x65, 0x6c, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x73, 0x65,
+  0x6e, 0x64, 0x5f, 0x61, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x73, 0x69, 0x67,
+  0x6e, 0x61, 0x6c, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6a, 0x69, 0x66, 0x66,
+  0x69, 0x65, 0x73, 0x36, 0x34, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x62, 0x72, 0x61, 0x6e,
+  0x63, 0x68, 0x5f, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x73, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+  0x6e, 0x73, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x70,
+  0x69, 0x64, 0x5f, 0x74, 0x67, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x65, 0x74, 0x6e, 0x73, 0x5f, 0x63,
+  0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x5f, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x5f,
+  0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x61, 0x73,
+  0x73, 0x69, 0x67, 0x6e, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x6b, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+  0x62, 0x6f, 0x6f, 0x74, 0x5f, 0x6e, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x71, 0x5f, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x66, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x65, 0x71, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x63,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x5f, 0x61, 0x6e, 0x63,
+  0x65, 0x73, 0x74, 0x6f, 0x72, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70,
+  0x5f, 0x69, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f, 0x72, 0x65, 0x73,
+  0x65, 0x72, 0x76, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f, 0x73, 0x75,
+  0x62, 0x6d, 0x69, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f, 0x64, 0x69,
+  0x73, 0x63, 0x61, 0x72, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x5f, 0x71,
+  0x75, 0x65, 0x72, 0x79, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x63, 0x73, 0x75, 0x6d, 0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b,
+  0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x63, 0x70, 0x36, 0x5f, 0x73, 0x6f,
+  0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x73, 0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x73,
+  0x6f, 0x63, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x63, 0x70, 0x5f,
+  0x74, 0x69, 0x6d, 0x65, 0x77, 0x61, 0x69, 0x74, 0x5f, 0x73, 0x6f, 0x63,
+  0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73,
+  0x6b, 0x63, 0x5f, 0x74, 0x6f, 0x5f, 0x74, 0x63, 0x70, 0x5f, 0x72, 0x65,
+  0x71, 0x75, 0x65, 0x73, 0x74, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x63, 0x5f,
+  0x74, 0x6f, 0x5f, 0x75, 0x64, 0x70, 0x36, 0x5f, 0x73, 0x6f, 0x63, 0x6b,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65,
+  0x74, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x6f,
+  0x61, 0x64, 0x5f, 0x68, 0x64, 0x72, 0x5f, 0x6f, 0x70, 0x74, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x74, 0x6f, 0x72,
+  0x65, 0x5f, 0x68, 0x64, 0x72, 0x5f, 0x6f, 0x70, 0x74, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72,
+  0x76, 0x65, 0x5f, 0x68, 0x64, 0x72, 0x5f, 0x6f, 0x70, 0x74, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x69, 0x6e, 0x6f, 0x64,
+  0x65, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x67, 0x65,
+  0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x69,
+  0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
+  0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x64, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x6f, 0x70,
+  0x79, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75, 0x73, 0x65, 0x72, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6e, 0x70,
+  0x72, 0x69, 0x6e, 0x74, 0x66, 0x5f, 0x62, 0x74, 0x66, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x71, 0x5f, 0x70,
+  0x72, 0x69, 0x6e, 0x74, 0x66, 0x5f, 0x62, 0x74, 0x66, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69,
+  0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72,
+  0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x6e, 0x65, 0x69, 0x67,
+  0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x70,
+  0x65, 0x72, 0x5f, 0x63, 0x70, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x68, 0x69, 0x73,
+  0x5f, 0x63, 0x70, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65,
+  0x63, 0x74, 0x5f, 0x70, 0x65, 0x65, 0x72, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f, 0x73, 0x74,
+  0x6f, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x67, 0x65, 0x74, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f,
+  0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x64, 0x65, 0x6c, 0x65,
+  0x74, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f,
+  0x74, 0x61, 0x73, 0x6b, 0x5f, 0x62, 0x74, 0x66, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x62, 0x70, 0x72, 0x6d, 0x5f, 0x6f,
+  0x70, 0x74, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6b, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x63, 0x6f, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x6e, 0x73,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x69, 0x6d,
+  0x61, 0x5f, 0x69, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x68, 0x61, 0x73, 0x68,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6f,
+  0x63, 0x6b, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x5f, 0x6d, 0x74, 0x75, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x66, 0x6f, 0x72, 0x5f, 0x65, 0x61, 0x63,
+  0x68, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6e, 0x70, 0x72,
+  0x69, 0x6e, 0x74, 0x66, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x79, 0x73, 0x5f, 0x62, 0x70, 0x66, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x62, 0x74, 0x66, 0x5f, 0x66,
+  0x69, 0x6e, 0x64, 0x5f, 0x62, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x5f,
+  0x6b, 0x69, 0x6e, 0x64, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x73, 0x79, 0x73, 0x5f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x69, 0x6d,
+  0x65, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x5f, 0x73,
+  0x65, 0x74, 0x5f, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x69, 0x6d,
+  0x65, 0x72, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x5f,
+  0x63, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63,
+  0x5f, 0x69, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x5f,
+  0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46,
+  0x55, 0x4e, 0x43, 0x5f, 0x74, 0x61, 0x73, 0x6b, 0x5f, 0x70, 0x74, 0x5f,
+  0x72, 0x65, 0x67, 0x73, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68,
+  0x5f, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65,
+  0x5f, 0x76, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6b, 0x00, 0x42, 0x50, 0x46,
+  0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x6b, 0x63, 0x5f, 0x74, 0x6f,
+  0x5f, 0x75, 0x6e, 0x69, 0x78, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6b, 0x61, 0x6c, 0x6c,
+  0x73, 0x79, 0x6d, 0x73, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f,
+  0x6e, 0x61, 0x6d, 0x65, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e,
+  0x43, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x5f, 0x76, 0x6d, 0x61, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6c, 0x6f, 0x6f, 0x70,
+  0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x74,
+  0x72, 0x6e, 0x63, 0x6d, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55,
+  0x4e, 0x43, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x5f,
+  0x61, 0x72, 0x67, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x72, 0x65,
+  0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x67,
+  0x65, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x61, 0x72, 0x67, 0x5f,
+  0x63, 0x6e, 0x74, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x67, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00,
+  0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x73, 0x65, 0x74,
+  0x5f, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x62, 0x75, 0x66, 0x66, 0x5f, 0x6c, 0x65, 0x6e, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x6c,
+  0x6f, 0x61, 0x64, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x73,
+  0x74, 0x6f, 0x72, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x42,
+  0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x63, 0x6f, 0x70, 0x79,
+  0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x75, 0x73, 0x65, 0x72, 0x5f, 0x74,
+  0x61, 0x73, 0x6b, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x73, 0x74,
+  0x61, 0x6d, 0x70, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43,
+  0x5f, 0x69, 0x6d, 0x61, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x68, 0x61,
+  0x73, 0x68, 0x00, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f,
+  0x6b, 0x70, 0x74, 0x72, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x00, 0x42, 0x50,
+  0x46, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x6c,
+  0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x70, 0x65, 0x72, 0x63, 0x70, 0x75,
+  0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x5f, 0x5f, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x55, 0x4e, 0x43, 0x5f, 0x4d, 0x41, 0x58, 0x5f, 0x49, 0x44, 0x00,
+  0x31, 0x33, 0x31, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70,
+  0x79, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62,
+  0x5f, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x6b,
+  0x72, 0x65, 0x74, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62,
+  0x5f, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x5f, 0x5f, 0x70, 0x73, 0x6b,
+  0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x63, 0x6c, 0x6f, 0x6e,
+  0x65, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x5f, 0x5f, 0x70,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x63, 0x6c,
+  0x6f, 0x6e, 0x65, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f,
+  0x5f, 0x5f, 0x70, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f,
+  0x66, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70,
+  0x72, 0x6f, 0x62, 0x65, 0x2f, 0x5f, 0x5f, 0x70, 0x73, 0x6b, 0x62, 0x5f,
+  0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65,
+  0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65, 0x78,
+  0x70, 0x61, 0x6e, 0x64, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65, 0x78, 0x70,
+  0x61, 0x6e, 0x64, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65, 0x78, 0x70,
+  0x61, 0x6e, 0x64, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73,
+  0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65, 0x67, 0x6d, 0x65, 0x6e,
+  0x74, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61,
+  0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b,
+  0x62, 0x5f, 0x73, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x6b, 0x72,
+  0x65, 0x74, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f,
+  0x73, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x6b,
+  0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x30, 0x3a, 0x38,
+  0x3a, 0x30, 0x3a, 0x30, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72,
+  0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x6b, 0x66,
+  0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x6b, 0x72, 0x65, 0x74,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65,
+  0x65, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f,
+  0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65,
+  0x61, 0x73, 0x6f, 0x6e, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x2f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62,
+  0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x6b, 0x62,
+  0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x5f, 0x64, 0x72, 0x6f, 0x70,
+  0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x5f, 0x73,
+  0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x5f, 0x64, 0x72,
+  0x6f, 0x70, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x5f, 0x73,
+  0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x5f, 0x64, 0x72,
+  0x6f, 0x70, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x2f, 0x73, 0x6b, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73,
+  0x6f, 0x6e, 0x5f, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d,
+  0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x2f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62,
+  0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d,
+  0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72,
+  0x6f, 0x62, 0x65, 0x2f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65,
+  0x65, 0x5f, 0x6e, 0x61, 0x70, 0x69, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75,
+  0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2f, 0x6e, 0x61, 0x70, 0x69, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75,
+  0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f,
+  0x6e, 0x61, 0x70, 0x69, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65,
+  0x5f, 0x73, 0x6b, 0x62, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x2f, 0x6e, 0x61, 0x70, 0x69, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+  0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65,
+  0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x2f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62,
+  0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65,
+  0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72,
+  0x6f, 0x62, 0x65, 0x2f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69,
+  0x6e, 0x30, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2e, 0x6d, 0x75,
+  0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69,
+  0x6e, 0x30, 0x00, 0x2f, 0x6d, 0x6e, 0x74, 0x2f, 0x73, 0x72, 0x63, 0x2f,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f,
+  0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2e, 0x62, 0x70, 0x66, 0x2e, 0x63, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x62, 0x6f, 0x64, 0x79, 0x00, 0x69, 0x70,
+  0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x31, 0x00, 0x6b, 0x70, 0x72,
+  0x6f, 0x62, 0x65, 0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70,
+  0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x31, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x32, 0x00, 0x6b, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x32, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x33, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x33, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x6d, 0x61, 0x69, 0x6e, 0x34, 0x00, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x6d, 0x61, 0x69, 0x6e, 0x34, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d,
+  0x61, 0x69, 0x6e, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x6b,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x5f, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x74, 0x72,
+  0x61, 0x63, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x00, 0x6d,
+  0x61, 0x73, 0x6b, 0x00, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72,
+  0x74, 0x00, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x6c, 0x65, 0x6e, 0x00, 0x66,
+  0x6c, 0x61, 0x67, 0x73, 0x00, 0x6e, 0x66, 0x75, 0x6e, 0x63, 0x73, 0x00,
+  0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x00, 0x63, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x5f, 0x69, 0x64, 0x00, 0x6e, 0x65, 0x74, 0x6e, 0x73, 0x00, 0x69,
+  0x66, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x73, 0x61, 0x64, 0x64, 0x72,
+  0x00, 0x64, 0x61, 0x64, 0x64, 0x72, 0x00, 0x73, 0x70, 0x6f, 0x72, 0x74,
+  0x00, 0x64, 0x70, 0x6f, 0x72, 0x74, 0x00, 0x6c, 0x34, 0x5f, 0x70, 0x72,
+  0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x00, 0x63, 0x6f, 0x6e, 0x66, 0x00,
+  0x5f, 0x42, 0x6f, 0x6f, 0x6c, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x00, 0x30, 0x3a, 0x33, 0x00, 0x30, 0x3a, 0x32, 0x00,
+  0x6e, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x00, 0x6e,
+  0x64, 0x5f, 0x6e, 0x65, 0x74, 0x00, 0x6e, 0x65, 0x74, 0x00, 0x30, 0x3a,
+  0x31, 0x3a, 0x30, 0x00, 0x30, 0x3a, 0x31, 0x00, 0x73, 0x6f, 0x63, 0x6b,
+  0x00, 0x5f, 0x5f, 0x73, 0x6b, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+  0x00, 0x73, 0x6b, 0x5f, 0x63, 0x67, 0x72, 0x70, 0x5f, 0x64, 0x61, 0x74,
+  0x61, 0x00, 0x73, 0x6f, 0x63, 0x6b, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+  0x6e, 0x00, 0x73, 0x6b, 0x63, 0x5f, 0x6e, 0x65, 0x74, 0x00, 0x73, 0x6f,
+  0x63, 0x6b, 0x5f, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x64, 0x61,
+  0x74, 0x61, 0x00, 0x63, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x00, 0x30, 0x3a,
+  0x30, 0x3a, 0x30, 0x3a, 0x30, 0x00, 0x6e, 0x73, 0x00, 0x6e, 0x73, 0x5f,
+  0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x00, 0x69, 0x6e, 0x75, 0x6d, 0x00,
+  0x30, 0x3a, 0x30, 0x3a, 0x30, 0x00, 0x6b, 0x6e, 0x00, 0x6b, 0x65, 0x72,
+  0x6e, 0x66, 0x73, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x00, 0x69, 0x64, 0x00,
+  0x30, 0x3a, 0x34, 0x00, 0x30, 0x3a, 0x37, 0x00, 0x30, 0x3a, 0x36, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x00,
+  0x63, 0x68, 0x61, 0x72, 0x00, 0x4c, 0x49, 0x43, 0x45, 0x4e, 0x53, 0x45,
+  0x00, 0x2e, 0x6d, 0x61, 0x70, 0x73, 0x00, 0x2e, 0x72, 0x6f, 0x64, 0x61,
+  0x74, 0x61, 0x2e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x00, 0x6c, 0x69,
+  0x63, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x00, 0x00, 0x9f, 0xeb, 0x01, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00,
+  0xec, 0x01, 0x00, 0x00, 0xbc, 0x2c, 0x00, 0x00, 0xa8, 0x2e, 0x00, 0x00,
+  0xdc, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0xfd, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0xb8, 0x10, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x86, 0x16, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0xb3, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0xe6, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x27, 0x17, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x61, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x9c, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xcf, 0x17, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x02, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x9b, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0xd5, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0d, 0x19, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x4b, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x7e, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xae, 0x19, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0xdf, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x19, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x4a, 0x1a, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x7a, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x9b, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xe9, 0x1a, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x0c, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x2f, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x52, 0x1b, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x7b, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x0e, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x2c, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 0x0e, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x3c, 0x0e, 0x00, 0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x3c, 0x0e, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x0e, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x3c, 0x0e, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x0e, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x4c, 0x0f, 0x00, 0xfd, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x4c, 0x0f, 0x00, 0x80, 0x03, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x74, 0x0e, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x88, 0x0e, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x84, 0x0e, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x98, 0x0e, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9c, 0x0e, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xac, 0x0e, 0x00, 0x78, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xb4, 0x0e, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xb4, 0x0e, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0xc0, 0x0e, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xdc, 0x0e, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xec, 0x0e, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xec, 0x0e, 0x00,
+  0x28, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xf0, 0x0e, 0x00, 0x68, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x0f, 0x00, 0x70, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x74, 0x0d, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x7c, 0x0d, 0x00, 0x90, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8c, 0x0d, 0x00,
+  0xc8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xac, 0x05, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb0, 0x05, 0x00,
+  0x08, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x98, 0x0d, 0x00, 0x10, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xa8, 0x0d, 0x00, 0x20, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb0, 0x0d, 0x00,
+  0x28, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xb0, 0x0d, 0x00, 0x30, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0xb4, 0x0d, 0x00, 0x38, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xb8, 0x0d, 0x00,
+  0x50, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xb4, 0x0d, 0x00, 0x58, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0xbc, 0x0d, 0x00, 0x60, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc0, 0x0d, 0x00,
+  0x70, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0xbc, 0x0d, 0x00, 0x78, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xc8, 0x0d, 0x00, 0x90, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd0, 0x0d, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0xcc, 0x0d, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xc8, 0x0d, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xd8, 0x0d, 0x00,
+  0xc8, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xdc, 0x0d, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xd8, 0x0d, 0x00, 0xf0, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x0d, 0x00,
+  0x20, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xe0, 0x0d, 0x00, 0x28, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0xe4, 0x0d, 0x00, 0x50, 0x03, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x0d, 0x00,
+  0x98, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x10, 0x00, 0xa0, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x0f, 0x00, 0xa8, 0x03, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x0f, 0x00,
+  0xb0, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x98, 0x0f, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x98, 0x0f, 0x00, 0xd8, 0x03, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0x10, 0x00,
+  0xe8, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x04, 0x11, 0x00,
+  0x10, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x04, 0x11, 0x00, 0x18, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x11, 0x00, 0x20, 0x04, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x14, 0x11, 0x00,
+  0x48, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x18, 0x11, 0x00, 0x50, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x1c, 0x11, 0x00, 0x60, 0x04, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2c, 0x11, 0x00,
+  0x70, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x30, 0x11, 0x00, 0x98, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0x11, 0x00, 0xa0, 0x04, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa8, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x34, 0x11, 0x00, 0xb8, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x11, 0x00, 0xc0, 0x04, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x44, 0x11, 0x00,
+  0xc8, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x4c, 0x11, 0x00, 0xd0, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x11, 0x00, 0xd8, 0x04, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x11, 0x00,
+  0xe8, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x50, 0x11, 0x00, 0xf0, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x11, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xd4, 0x0f, 0x00,
+  0x18, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0xd4, 0x0f, 0x00, 0x20, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xd4, 0x0f, 0x00, 0x30, 0x05, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xd8, 0x0f, 0x00, 0x50, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xe4, 0x0f, 0x00, 0x58, 0x05, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe4, 0x0f, 0x00,
+  0x60, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xe4, 0x0f, 0x00, 0x70, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf4, 0x0f, 0x00,
+  0x90, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xf8, 0x0f, 0x00, 0x98, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x00, 0xa0, 0x05, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x10, 0x00,
+  0xa8, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x08, 0x10, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x10, 0x00, 0xc8, 0x05, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x00,
+  0xd0, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x0c, 0x10, 0x00, 0xd8, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x70, 0x07, 0x00, 0xe0, 0x05, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0x07, 0x00,
+  0xe8, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x8c, 0x07, 0x00, 0xf0, 0x05, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x07, 0x00, 0x08, 0x06, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x94, 0x07, 0x00,
+  0x10, 0x06, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x98, 0x07, 0x00, 0x28, 0x06, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x94, 0x07, 0x00, 0x38, 0x06, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9c, 0x07, 0x00,
+  0x68, 0x06, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x9c, 0x07, 0x00, 0x70, 0x06, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xac, 0x05, 0x00, 0x80, 0x06, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x06, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xb0, 0x05, 0x00, 0xa0, 0x06, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xa4, 0x07, 0x00, 0xa8, 0x06, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xa8, 0x07, 0x00,
+  0xc8, 0x06, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xc0, 0x07, 0x00, 0x08, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1c, 0x10, 0x00,
+  0x30, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x94, 0x0c, 0x00, 0x48, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xa4, 0x0c, 0x00, 0x60, 0x07, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xa4, 0x0c, 0x00,
+  0x68, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xa4, 0x0c, 0x00, 0x78, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x50, 0x0c, 0x00, 0x80, 0x07, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x54, 0x0c, 0x00,
+  0x90, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x5c, 0x0c, 0x00, 0xb0, 0x07, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5c, 0x0c, 0x00,
+  0xb8, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x6c, 0x0c, 0x00, 0xc0, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x6c, 0x0c, 0x00, 0xd0, 0x07, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6c, 0x0c, 0x00,
+  0xe0, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x7c, 0x0c, 0x00, 0x20, 0x08, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb4, 0x0c, 0x00,
+  0x30, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xb4, 0x0c, 0x00, 0x38, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xc8, 0x0c, 0x00,
+  0x58, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x22, 0xc8, 0x0c, 0x00, 0x60, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xc8, 0x0c, 0x00, 0x68, 0x08, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xbc, 0x04, 0x00,
+  0x70, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0xc4, 0x04, 0x00, 0x78, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xc0, 0x04, 0x00, 0x80, 0x08, 0x00, 0x00,
+  0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x48, 0x00, 0x00,
+  0x90, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0xc0, 0x04, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd4, 0x04, 0x00,
+  0xe8, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xdc, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0xdc, 0x0c, 0x00, 0x08, 0x09, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xdc, 0x0c, 0x00,
+  0x18, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xec, 0x0c, 0x00, 0x30, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0xec, 0x0c, 0x00, 0x38, 0x09, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xec, 0x0c, 0x00,
+  0x48, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xf8, 0x07, 0x00, 0x50, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xfc, 0x07, 0x00, 0x58, 0x09, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x08, 0x00,
+  0x68, 0x09, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x48, 0x00, 0x00, 0x88, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x18, 0x08, 0x00,
+  0xb0, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x1c, 0x08, 0x00, 0xb8, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x08, 0x00, 0xc8, 0x09, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd0, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x40, 0x08, 0x00, 0xe8, 0x09, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x44, 0x08, 0x00, 0xf8, 0x09, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x54, 0x08, 0x00, 0x30, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x5c, 0x08, 0x00, 0x58, 0x0a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x08, 0x00,
+  0x60, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x70, 0x08, 0x00, 0x68, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x74, 0x08, 0x00, 0x78, 0x0a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x70, 0x08, 0x00,
+  0x80, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x80, 0x08, 0x00, 0x88, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x84, 0x08, 0x00, 0x90, 0x0a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x90, 0x08, 0x00,
+  0xb8, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x8c, 0x08, 0x00, 0xc0, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x90, 0x08, 0x00, 0xd0, 0x0a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x8c, 0x08, 0x00,
+  0xe8, 0x0a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x94, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x94, 0x08, 0x00, 0x08, 0x0b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x98, 0x08, 0x00,
+  0x10, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x9c, 0x08, 0x00, 0x18, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x98, 0x08, 0x00, 0x20, 0x0b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xa0, 0x08, 0x00,
+  0x28, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0xa0, 0x08, 0x00, 0x38, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0xdc, 0x0c, 0x00, 0x40, 0x0b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xdc, 0x0c, 0x00,
+  0x60, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4e, 0x0c, 0x0d, 0x00, 0x68, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x10, 0x0d, 0x00, 0x80, 0x0b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0c, 0x0d, 0x00,
+  0x90, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xac, 0x05, 0x00, 0xa0, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x0b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb0, 0x05, 0x00,
+  0xc0, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x90, 0x06, 0x00, 0xc8, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xa0, 0x06, 0x00, 0xe0, 0x0b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa0, 0x06, 0x00,
+  0xf0, 0x0b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xa4, 0x06, 0x00, 0x20, 0x0c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xa8, 0x06, 0x00, 0x28, 0x0c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x05, 0x00,
+  0x38, 0x0c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xb8, 0x06, 0x00, 0x50, 0x0c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x88, 0x05, 0x00, 0x58, 0x0c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x88, 0x05, 0x00,
+  0x60, 0x0c, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x48, 0x00, 0x00, 0x70, 0x0c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x8c, 0x05, 0x00, 0x80, 0x0c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x94, 0x05, 0x00,
+  0x90, 0x0c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x90, 0x05, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x48, 0x00, 0x00, 0xb8, 0x0c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf4, 0x08, 0x00,
+  0xc0, 0x0c, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x48, 0x00, 0x00, 0xd8, 0x0c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xf4, 0x08, 0x00, 0xe0, 0x0c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x09, 0x00,
+  0xe8, 0x0c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2c, 0x04, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x04, 0x09, 0x00, 0x08, 0x0d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x04, 0x09, 0x00,
+  0x10, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x09, 0x00, 0x20, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x09, 0x00, 0x28, 0x0d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0c, 0x09, 0x00,
+  0x40, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x10, 0x09, 0x00, 0x50, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x09, 0x00, 0x68, 0x0d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xac, 0x05, 0x00,
+  0x78, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xb0, 0x05, 0x00, 0x98, 0x0d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x05, 0x00,
+  0xb0, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x94, 0x05, 0x00, 0xc0, 0x0d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x05, 0x00, 0x08, 0x0e, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x05, 0x00,
+  0x18, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x88, 0x05, 0x00, 0x20, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x88, 0x05, 0x00, 0x28, 0x0e, 0x00, 0x00,
+  0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x48, 0x00, 0x00,
+  0x38, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x8c, 0x05, 0x00, 0x40, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x90, 0x05, 0x00, 0x48, 0x0e, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x94, 0x05, 0x00,
+  0x50, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x90, 0x05, 0x00, 0x58, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x06, 0x00, 0x70, 0x0e, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00,
+  0x80, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x14, 0x06, 0x00, 0x90, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x30, 0x06, 0x00, 0xa8, 0x0e, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x30, 0x06, 0x00,
+  0xb0, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x3c, 0x06, 0x00, 0xb8, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x3c, 0x06, 0x00, 0xc8, 0x0e, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x30, 0x06, 0x00,
+  0xd0, 0x0e, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x38, 0x06, 0x00, 0x08, 0x0f, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0xa8, 0x08, 0x00, 0x28, 0x0f, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe4, 0x06, 0x00,
+  0x58, 0x0f, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xe8, 0x06, 0x00, 0x60, 0x0f, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x05, 0x00, 0x70, 0x0f, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x06, 0x00,
+  0xc8, 0x0f, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x88, 0x05, 0x00, 0xd0, 0x0f, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x88, 0x05, 0x00, 0xd8, 0x0f, 0x00, 0x00,
+  0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x48, 0x00, 0x00,
+  0xe8, 0x0f, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x8c, 0x05, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x94, 0x05, 0x00, 0x08, 0x10, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x90, 0x05, 0x00,
+  0x18, 0x10, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x20, 0x07, 0x00, 0x20, 0x10, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x44, 0x07, 0x00,
+  0x98, 0x10, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x48, 0x07, 0x00, 0xb0, 0x10, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x0d, 0x00, 0xb8, 0x10, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00,
+  0xe0, 0x10, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0x10, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x0c, 0x00, 0xf8, 0x10, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x08, 0x0c, 0x00,
+  0x10, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0x08, 0x0c, 0x00, 0x18, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x08, 0x0c, 0x00, 0x20, 0x11, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x08, 0x0c, 0x00,
+  0x28, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x04, 0x0c, 0x00, 0x30, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x08, 0x0c, 0x00, 0x50, 0x11, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x08, 0x0c, 0x00,
+  0x60, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x08, 0x0c, 0x00, 0x68, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x88, 0x0b, 0x00, 0x70, 0x11, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x88, 0x0b, 0x00,
+  0x98, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x88, 0x0b, 0x00, 0xd0, 0x11, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd8, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x88, 0x0b, 0x00, 0xe8, 0x11, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x88, 0x0b, 0x00, 0xf0, 0x11, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x88, 0x0b, 0x00,
+  0x08, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x88, 0x0b, 0x00, 0x10, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x98, 0x0b, 0x00, 0x28, 0x12, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x98, 0x0b, 0x00,
+  0x50, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x58, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0x09, 0x00, 0x88, 0x12, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x68, 0x09, 0x00, 0xa0, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0x09, 0x00, 0xa8, 0x12, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6c, 0x09, 0x00,
+  0xd0, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd8, 0x12, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x09, 0x00, 0x08, 0x13, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x70, 0x09, 0x00, 0x20, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x09, 0x00, 0x40, 0x13, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x7c, 0x09, 0x00, 0x58, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x7c, 0x09, 0x00, 0x60, 0x13, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x98, 0x0b, 0x00,
+  0x78, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x98, 0x0b, 0x00, 0x80, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xa8, 0x0b, 0x00, 0x88, 0x13, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xa8, 0x0b, 0x00,
+  0xb0, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0xa4, 0x09, 0x00, 0xd0, 0x13, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa4, 0x09, 0x00,
+  0xe0, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xac, 0x09, 0x00, 0xf8, 0x13, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xac, 0x09, 0x00, 0x18, 0x14, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xbc, 0x09, 0x00, 0x88, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x14, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbc, 0x09, 0x00,
+  0xa0, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xbc, 0x09, 0x00, 0xa8, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x35, 0xa8, 0x0b, 0x00, 0xc0, 0x14, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa8, 0x0b, 0x00,
+  0xc8, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xb8, 0x0b, 0x00, 0xe0, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0xb8, 0x0b, 0x00, 0xe8, 0x14, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xb8, 0x0b, 0x00,
+  0xf0, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0xb8, 0x0b, 0x00, 0xf8, 0x14, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0xb8, 0x0b, 0x00, 0x10, 0x15, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xb8, 0x0b, 0x00,
+  0x18, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xc0, 0x0b, 0x00, 0x30, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xbc, 0x0b, 0x00, 0x48, 0x15, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xbc, 0x0b, 0x00,
+  0x58, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xc0, 0x0b, 0x00, 0x60, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0xc0, 0x0b, 0x00, 0x70, 0x15, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x0b, 0x00,
+  0x98, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xd0, 0x0b, 0x00, 0xb0, 0x15, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xd0, 0x0b, 0x00,
+  0xb8, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xd4, 0x0b, 0x00, 0xd0, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xd4, 0x0b, 0x00, 0xd8, 0x15, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xd4, 0x0b, 0x00,
+  0xe0, 0x15, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0xd4, 0x0b, 0x00, 0x00, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xd4, 0x0b, 0x00, 0x28, 0x16, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x0c, 0x00,
+  0x48, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0xe4, 0x0b, 0x00, 0x78, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x16, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x30, 0x0a, 0x00,
+  0xa0, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x30, 0x0a, 0x00, 0xb0, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x16, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x0a, 0x00,
+  0xd8, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x34, 0x0a, 0x00, 0xe0, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0a, 0x00, 0xe8, 0x16, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x50, 0x0a, 0x00,
+  0xf0, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x50, 0x0a, 0x00, 0xf8, 0x16, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x37, 0x54, 0x0a, 0x00, 0x18, 0x17, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x54, 0x0a, 0x00,
+  0x28, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x43, 0x54, 0x0a, 0x00, 0x30, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x58, 0x0a, 0x00, 0x38, 0x17, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x58, 0x0a, 0x00,
+  0x48, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x54, 0x0a, 0x00, 0x50, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x0a, 0x00, 0x58, 0x17, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x74, 0x0a, 0x00,
+  0x70, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0x74, 0x0a, 0x00, 0x88, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x70, 0x0a, 0x00, 0x90, 0x17, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x6c, 0x0a, 0x00,
+  0xa0, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x68, 0x0a, 0x00, 0xb0, 0x17, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x78, 0x0a, 0x00, 0x10, 0x18, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7c, 0x0a, 0x00,
+  0x20, 0x18, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x7c, 0x0a, 0x00, 0x28, 0x18, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x80, 0x0a, 0x00, 0x48, 0x18, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x0a, 0x00,
+  0x58, 0x18, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x45, 0x80, 0x0a, 0x00, 0x60, 0x18, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x84, 0x0a, 0x00, 0x68, 0x18, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x84, 0x0a, 0x00,
+  0x70, 0x18, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x80, 0x0a, 0x00, 0x88, 0x18, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x9c, 0x0a, 0x00, 0x98, 0x18, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x98, 0x0a, 0x00,
+  0xd8, 0x18, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x94, 0x0a, 0x00, 0x18, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x50, 0x0a, 0x00, 0x38, 0x19, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb4, 0x0a, 0x00,
+  0x50, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0xb4, 0x0a, 0x00, 0x58, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xb4, 0x0a, 0x00, 0x60, 0x19, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x50, 0x0a, 0x00,
+  0x88, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xb8, 0x0a, 0x00, 0xa0, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xb8, 0x0a, 0x00, 0xb0, 0x19, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb8, 0x0a, 0x00,
+  0xb8, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xc8, 0x0a, 0x00, 0xc0, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0xc8, 0x0a, 0x00, 0xc8, 0x19, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xc8, 0x0a, 0x00,
+  0xd0, 0x19, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xd4, 0x09, 0x00, 0x28, 0x1a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x09, 0x00,
+  0x40, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0xe4, 0x09, 0x00, 0x50, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x33, 0xe4, 0x09, 0x00, 0x58, 0x1a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xe4, 0x09, 0x00,
+  0x68, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3e, 0xe4, 0x09, 0x00, 0x78, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x49, 0xe4, 0x09, 0x00, 0x80, 0x1a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe8, 0x09, 0x00,
+  0xa0, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xe8, 0x09, 0x00, 0xb0, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xc8, 0x0a, 0x00, 0xc8, 0x1a, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x50, 0x0a, 0x00,
+  0xd0, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xc8, 0x0a, 0x00, 0xe8, 0x1a, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xdc, 0x0a, 0x00, 0x00, 0x1b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xdc, 0x0a, 0x00,
+  0x08, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0xdc, 0x0a, 0x00, 0x10, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd4, 0x09, 0x00,
+  0x58, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0xe4, 0x09, 0x00, 0x78, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0xe4, 0x09, 0x00, 0x88, 0x1b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xe4, 0x09, 0x00,
+  0x90, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x36, 0xe4, 0x09, 0x00, 0xa0, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0xe4, 0x09, 0x00, 0xb0, 0x1b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xe4, 0x09, 0x00,
+  0xb8, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xe8, 0x09, 0x00, 0xd8, 0x1b, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0xe8, 0x09, 0x00, 0xe8, 0x1b, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xdc, 0x0a, 0x00,
+  0x00, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x50, 0x0a, 0x00, 0x08, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xdc, 0x0a, 0x00, 0x20, 0x1c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x0a, 0x00,
+  0x38, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xf4, 0x0a, 0x00, 0x48, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0xf4, 0x0a, 0x00, 0x60, 0x1c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf4, 0x0a, 0x00,
+  0x68, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xf4, 0x0a, 0x00, 0x70, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x0b, 0x00, 0x88, 0x1c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x04, 0x0b, 0x00,
+  0x98, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x04, 0x0b, 0x00, 0xa0, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x0b, 0x00, 0xb0, 0x1c, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x14, 0x0b, 0x00,
+  0xd8, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x2c, 0x0b, 0x00, 0xf0, 0x1c, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x0b, 0x00, 0x08, 0x1d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0b, 0x00,
+  0x20, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x40, 0x0b, 0x00, 0x28, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x50, 0x0b, 0x00, 0x40, 0x1d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x50, 0x0b, 0x00,
+  0x48, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x50, 0x0b, 0x00, 0x50, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x50, 0x0b, 0x00, 0x58, 0x1d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x50, 0x0b, 0x00,
+  0x68, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x54, 0x0b, 0x00, 0x70, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x54, 0x0b, 0x00, 0x78, 0x1d, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x54, 0x0b, 0x00,
+  0x98, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x54, 0x0b, 0x00, 0xa0, 0x1d, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x54, 0x0b, 0x00, 0x86, 0x16, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x0e, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x2c, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 0x0e, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x3c, 0x0e, 0x00, 0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x3c, 0x0e, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x0e, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x3c, 0x0e, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x0e, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x50, 0x0f, 0x00, 0xb3, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x50, 0x0f, 0x00, 0xe6, 0x16, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x54, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x0e, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2c, 0x0e, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x22, 0x28, 0x0e, 0x00, 0x38, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3c, 0x0e, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x3c, 0x0e, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3c, 0x0e, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x0e, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x0f, 0x00,
+  0x27, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x0f, 0x00,
+  0x61, 0x17, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x0f, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x20, 0x0e, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x2c, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 0x0e, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x3c, 0x0e, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3c, 0x0e, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x40, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x3c, 0x0e, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x50, 0x0e, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x0f, 0x00, 0x9c, 0x17, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x0f, 0x00, 0xcf, 0x17, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x0e, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x2c, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 0x0e, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x3c, 0x0e, 0x00, 0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x3c, 0x0e, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x0e, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x3c, 0x0e, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x0e, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x5c, 0x0f, 0x00, 0x02, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x5c, 0x0f, 0x00, 0x2c, 0x18, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xa4, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x10, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x0f, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x88, 0x0f, 0x00, 0x68, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x98, 0x0f, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x98, 0x0f, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x40, 0x10, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x10, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x4c, 0x10, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x10, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x54, 0x10, 0x00, 0x40, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x58, 0x10, 0x00, 0x48, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0x10, 0x00,
+  0x50, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x78, 0x10, 0x00, 0x80, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x7c, 0x10, 0x00, 0x88, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x10, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x80, 0x10, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x10, 0x00, 0xb8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x84, 0x10, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x9c, 0x10, 0x00, 0xd8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xb4, 0x10, 0x00, 0x08, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xbc, 0x10, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xb8, 0x10, 0x00, 0x20, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xb4, 0x10, 0x00, 0x40, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xc4, 0x10, 0x00, 0x58, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00, 0x78, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xc4, 0x10, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0xc4, 0x10, 0x00, 0x90, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa4, 0x11, 0x00,
+  0x60, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa4, 0x11, 0x00,
+  0x9b, 0x18, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa8, 0x11, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x3c, 0x10, 0x00, 0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x0f, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x0f, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x98, 0x0f, 0x00, 0x88, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x98, 0x0f, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x40, 0x10, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x10, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x10, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x10, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x54, 0x10, 0x00,
+  0x40, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x58, 0x10, 0x00, 0x48, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0x10, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0x10, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x7c, 0x10, 0x00, 0x88, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x10, 0x00, 0xa8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x10, 0x00,
+  0xb0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x84, 0x10, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x84, 0x10, 0x00, 0xd0, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9c, 0x10, 0x00,
+  0xd8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xb4, 0x10, 0x00, 0x08, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xbc, 0x10, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb8, 0x10, 0x00,
+  0x20, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xb4, 0x10, 0x00, 0x40, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00,
+  0x58, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xc4, 0x10, 0x00, 0x78, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0xc4, 0x10, 0x00, 0x88, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x10, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xa8, 0x11, 0x00, 0xd5, 0x18, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xa8, 0x11, 0x00, 0x0d, 0x19, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xac, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x10, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x80, 0x0f, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x0f, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x98, 0x0f, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x98, 0x0f, 0x00, 0x90, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x40, 0x10, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x48, 0x10, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x10, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x50, 0x10, 0x00, 0x18, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x54, 0x10, 0x00, 0x40, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x58, 0x10, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x6c, 0x10, 0x00, 0x50, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0x10, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7c, 0x10, 0x00,
+  0x88, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x80, 0x10, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x10, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x10, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x84, 0x10, 0x00, 0xd0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x9c, 0x10, 0x00, 0xd8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb4, 0x10, 0x00,
+  0x08, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xbc, 0x10, 0x00, 0x18, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xb8, 0x10, 0x00, 0x20, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb4, 0x10, 0x00,
+  0x40, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00, 0x58, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00,
+  0x78, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x34, 0xc4, 0x10, 0x00, 0x88, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x10, 0x00, 0x90, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xac, 0x11, 0x00, 0x4b, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xac, 0x11, 0x00, 0x7e, 0x19, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xb0, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x10, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x0f, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x88, 0x0f, 0x00, 0x68, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x98, 0x0f, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x98, 0x0f, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x40, 0x10, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x10, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x4c, 0x10, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x10, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x54, 0x10, 0x00, 0x40, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x58, 0x10, 0x00, 0x48, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0x10, 0x00,
+  0x50, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x78, 0x10, 0x00, 0x80, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x7c, 0x10, 0x00, 0x88, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x10, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x80, 0x10, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x10, 0x00, 0xb8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x84, 0x10, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x9c, 0x10, 0x00, 0xd8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xb4, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xbc, 0x10, 0x00,
+  0x08, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xb8, 0x10, 0x00, 0x10, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xb4, 0x10, 0x00, 0x30, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xc4, 0x10, 0x00, 0x50, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00, 0x78, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xc4, 0x10, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0xc4, 0x10, 0x00, 0x90, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x11, 0x00,
+  0xae, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x11, 0x00,
+  0xdf, 0x19, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x11, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x3c, 0x10, 0x00, 0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x80, 0x0f, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x0f, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x98, 0x0f, 0x00, 0x88, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x98, 0x0f, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x40, 0x10, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x10, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x10, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x10, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x54, 0x10, 0x00,
+  0x40, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x58, 0x10, 0x00, 0x48, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0x10, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0x10, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x7c, 0x10, 0x00, 0x88, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x10, 0x00, 0xa8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x10, 0x00,
+  0xb0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x84, 0x10, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x84, 0x10, 0x00, 0xd0, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9c, 0x10, 0x00,
+  0xd8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xb4, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xbc, 0x10, 0x00, 0x08, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb8, 0x10, 0x00,
+  0x10, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xb4, 0x10, 0x00, 0x30, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00,
+  0x50, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xc4, 0x10, 0x00, 0x78, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0xc4, 0x10, 0x00, 0x88, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x10, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x11, 0x00, 0x19, 0x1a, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x11, 0x00, 0x4a, 0x1a, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x10, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x80, 0x0f, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x0f, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x98, 0x0f, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x98, 0x0f, 0x00, 0x90, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x40, 0x10, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x48, 0x10, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x10, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x50, 0x10, 0x00, 0x18, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x54, 0x10, 0x00, 0x40, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x58, 0x10, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x6c, 0x10, 0x00, 0x50, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0x10, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7c, 0x10, 0x00,
+  0x88, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x80, 0x10, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x10, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x10, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x84, 0x10, 0x00, 0xd0, 0x01, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x9c, 0x10, 0x00, 0xd8, 0x01, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb4, 0x10, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xbc, 0x10, 0x00, 0x08, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xb8, 0x10, 0x00, 0x10, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb4, 0x10, 0x00,
+  0x30, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00, 0x50, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc4, 0x10, 0x00,
+  0x78, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x34, 0xc4, 0x10, 0x00, 0x88, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x10, 0x00, 0x90, 0x02, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xb8, 0x11, 0x00, 0x7a, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xb8, 0x11, 0x00, 0x9b, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x74, 0x00, 0x00, 0xe9, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x74, 0x00, 0x00, 0x0c, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x74, 0x00, 0x00, 0x2f, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x31, 0x74, 0x00, 0x00, 0x52, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x41, 0x74, 0x00, 0x00, 0x7b, 0x1b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x08, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x04, 0x05, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x48, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x04, 0x05, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x18, 0x05, 0x00, 0x68, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x05, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2c, 0x05, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x34, 0x05, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa0, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xb0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xb3, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x80, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0x02, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x6c, 0x16, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x6c, 0x16, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x50, 0x0b, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x6c, 0x16, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0xc0, 0x10, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x34, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x11, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x11, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x12, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x68, 0x12, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x52, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x12, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x58, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x12, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xa6, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x13, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0xc0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x13, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x58, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x13, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x52, 0x1c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x52, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x14, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x68, 0x14, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x15, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xd8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x16, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0xdc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x16, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3d, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9b, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3d, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3d, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7e, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3d, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3d, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4a, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3d, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x08, 0x00, 0x08, 0x7c, 0x0b, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe1, 0x11, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1f, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x5e, 0x00,
+  0x00, 0x00, 0x03, 0x01, 0x1f, 0x02, 0x0f, 0x05, 0x1e, 0x09, 0x6f, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x8b, 0x82, 0x2c, 0x1f, 0xe5, 0x73, 0x05, 0x2a,
+  0x28, 0x49, 0x87, 0x53, 0xa7, 0x94, 0x04, 0x87, 0x00, 0x00, 0x00, 0x01,
+  0x34, 0xf6, 0x0a, 0xf3, 0x45, 0x02, 0xbf, 0xc8, 0xb7, 0x9b, 0x6e, 0xa0,
+  0x3b, 0x1b, 0x67, 0x7d, 0x90, 0x00, 0x00, 0x00, 0x02, 0x5c, 0x3a, 0xf5,
+  0xeb, 0xe6, 0x20, 0x3e, 0xd7, 0x39, 0x78, 0x20, 0x3a, 0xcc, 0x5a, 0xc4,
+  0x98, 0x9e, 0x00, 0x00, 0x00, 0x02, 0x5a, 0x5b, 0x14, 0x6c, 0x00, 0x20,
+  0x2d, 0xa2, 0x1d, 0xd7, 0x7d, 0x35, 0x31, 0x60, 0x35, 0xf5, 0xae, 0x00,
+  0x00, 0x00, 0x03, 0xb8, 0x10, 0xf2, 0x70, 0x73, 0x3e, 0x10, 0x63, 0x19,
+  0xb6, 0x7e, 0xf5, 0x12, 0xc6, 0x24, 0x6e, 0xb9, 0x00, 0x00, 0x00, 0x04,
+  0x99, 0xcf, 0xe6, 0x91, 0xe0, 0x14, 0xd0, 0x1c, 0xee, 0x97, 0x60, 0x39,
+  0xbd, 0x85, 0xc2, 0xc9, 0xcb, 0x00, 0x00, 0x00, 0x05, 0x61, 0xe2, 0xfa,
+  0xfb, 0xfe, 0xa8, 0xb4, 0xce, 0x7a, 0x63, 0xd5, 0x44, 0xae, 0xc1, 0x6c,
+  0xbc, 0xd1, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x51, 0x4f, 0x1d, 0xf9, 0xdc,
+  0x31, 0x15, 0x43, 0x69, 0x16, 0xc3, 0x2b, 0x4d, 0xbe, 0x6e, 0xe1, 0x00,
+  0x00, 0x00, 0x06, 0xd0, 0x91, 0xe8, 0x97, 0x97, 0x2e, 0x00, 0x58, 0xad,
+  0x5c, 0xa6, 0x2f, 0x6e, 0x36, 0x6c, 0x3e, 0x04, 0x03, 0x00, 0x09, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd2, 0x07, 0x01,
+  0x05, 0x01, 0x0a, 0x01, 0x05, 0x0c, 0x03, 0xb5, 0x7f, 0x20, 0x05, 0x13,
+  0x23, 0x06, 0x03, 0xf5, 0x78, 0x20, 0x05, 0x22, 0x06, 0x03, 0x8a, 0x07,
+  0x20, 0x06, 0x03, 0xf6, 0x78, 0x2e, 0x05, 0x07, 0x06, 0x03, 0x8f, 0x07,
+  0x2e, 0x05, 0x38, 0x06, 0x3c, 0x05, 0x08, 0x06, 0x21, 0x05, 0x07, 0x2d,
+  0x06, 0x03, 0xf1, 0x78, 0x20, 0x05, 0x03, 0x06, 0x03, 0x94, 0x07, 0x4a,
+  0x05, 0x01, 0x03, 0x3f, 0x4a, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04, 0x03,
+  0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xd2, 0x07, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x02, 0x05, 0x00, 0x01, 0x01,
+  0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x9d, 0x07, 0x01, 0x05, 0x13, 0x0a, 0x40, 0x06, 0x03, 0xde,
+  0x78, 0x20, 0x05, 0x22, 0x06, 0x03, 0xa1, 0x07, 0x20, 0x05, 0x00, 0x06,
+  0x03, 0xdf, 0x78, 0x4a, 0x05, 0x09, 0x06, 0x03, 0xa6, 0x07, 0x20, 0x05,
+  0x07, 0x3d, 0x05, 0x0c, 0x24, 0x05, 0x03, 0x22, 0x06, 0x03, 0xd3, 0x78,
+  0x20, 0x03, 0xad, 0x07, 0x2e, 0x05, 0x2a, 0x06, 0x3f, 0x06, 0x03, 0xd0,
+  0x78, 0x2e, 0x05, 0x09, 0x06, 0x03, 0xb7, 0x07, 0x58, 0x06, 0x03, 0xc9,
+  0x78, 0x20, 0x05, 0x0d, 0x06, 0x03, 0xbb, 0x07, 0x4a, 0x06, 0x3c, 0x05,
+  0x09, 0x06, 0x21, 0x06, 0x03, 0xc4, 0x78, 0x20, 0x03, 0xbc, 0x07, 0x66,
+  0x05, 0x01, 0x06, 0x26, 0x05, 0x0b, 0x03, 0x9b, 0x7f, 0x20, 0x05, 0x0c,
+  0x30, 0x06, 0x03, 0xa1, 0x79, 0x20, 0x05, 0x03, 0x06, 0x03, 0xe3, 0x06,
+  0x4a, 0x05, 0x0c, 0x03, 0x88, 0x7c, 0x4a, 0x06, 0x03, 0x95, 0x7d, 0x2e,
+  0x05, 0x0a, 0x06, 0x03, 0xec, 0x02, 0x2e, 0x05, 0x07, 0x03, 0xfa, 0x03,
+  0x4a, 0x05, 0x03, 0x24, 0x05, 0x14, 0x30, 0x05, 0x12, 0x06, 0x20, 0x05,
+  0x11, 0x06, 0x21, 0x05, 0x10, 0x21, 0x05, 0x0f, 0x3b, 0x05, 0x17, 0x22,
+  0x05, 0x0d, 0x21, 0x05, 0x15, 0x2d, 0x05, 0x0e, 0x23, 0x05, 0x0b, 0x3e,
+  0x05, 0x10, 0x1f, 0x05, 0x0c, 0x2d, 0x05, 0x4e, 0x24, 0x05, 0x0d, 0x3d,
+  0x05, 0x07, 0x3b, 0x06, 0x03, 0x8a, 0x79, 0x20, 0x05, 0x09, 0x06, 0x03,
+  0xf8, 0x06, 0x20, 0x06, 0x66, 0x05, 0x11, 0x06, 0x21, 0x06, 0x03, 0x87,
+  0x79, 0x4a, 0x05, 0x03, 0x06, 0x03, 0xfe, 0x06, 0x20, 0x06, 0x03, 0x82,
+  0x79, 0x82, 0x02, 0x01, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02,
+  0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb8, 0x08, 0x01,
+  0x05, 0x17, 0x0a, 0x03, 0xa7, 0x7f, 0x20, 0x05, 0x07, 0x22, 0x05, 0x17,
+  0x24, 0x05, 0x15, 0x06, 0x4a, 0x05, 0x0c, 0x06, 0x03, 0xd7, 0x00, 0x20,
+  0x06, 0x03, 0xc3, 0x77, 0x20, 0x05, 0x08, 0x06, 0x03, 0xc0, 0x08, 0x2e,
+  0x05, 0x12, 0x3d, 0x05, 0x19, 0x06, 0x20, 0x05, 0x07, 0x20, 0x05, 0x0f,
+  0x06, 0x24, 0x05, 0x07, 0x59, 0x05, 0x0d, 0x21, 0x05, 0x0c, 0x32, 0x05,
+  0x0a, 0x2f, 0x05, 0x07, 0x06, 0x58, 0x05, 0x00, 0x03, 0xb4, 0x77, 0x20,
+  0x05, 0x0d, 0x06, 0x03, 0xcd, 0x08, 0x20, 0x05, 0x01, 0x03, 0x0b, 0x2e,
+  0x05, 0x0b, 0x03, 0x79, 0x20, 0x05, 0x0a, 0x22, 0x05, 0x07, 0x06, 0x20,
+  0x05, 0x18, 0x06, 0x21, 0x05, 0x20, 0x06, 0x2e, 0x05, 0x18, 0x20, 0x03,
+  0xac, 0x77, 0x20, 0x05, 0x0d, 0x06, 0x03, 0xf5, 0x07, 0x20, 0x05, 0x13,
+  0x06, 0x3c, 0x05, 0x07, 0x20, 0x03, 0x8b, 0x78, 0x20, 0x05, 0x05, 0x06,
+  0x03, 0xf6, 0x07, 0x2e, 0x05, 0x0f, 0x3f, 0x05, 0x15, 0x06, 0x20, 0x05,
+  0x07, 0x20, 0x03, 0x87, 0x78, 0x20, 0x05, 0x09, 0x06, 0x03, 0xfd, 0x07,
+  0x2e, 0x05, 0x07, 0x3d, 0x24, 0x05, 0x0f, 0x06, 0x20, 0x05, 0x1a, 0x20,
+  0x05, 0x20, 0x3c, 0x05, 0x07, 0x20, 0x05, 0x12, 0x06, 0x21, 0x05, 0x15,
+  0x03, 0xd9, 0x7b, 0x20, 0x05, 0x07, 0x22, 0x05, 0x0c, 0x25, 0x05, 0x40,
+  0x1f, 0x06, 0x03, 0x9e, 0x7c, 0x20, 0x05, 0x4e, 0x06, 0x03, 0xe5, 0x03,
+  0x2e, 0x05, 0x0d, 0x21, 0x05, 0x07, 0x3b, 0x06, 0x03, 0x9b, 0x7c, 0x20,
+  0x05, 0x09, 0x06, 0x03, 0xe7, 0x03, 0x20, 0x06, 0x66, 0x05, 0x0c, 0x06,
+  0x03, 0x84, 0x7f, 0x20, 0x06, 0x03, 0x95, 0x7d, 0x20, 0x05, 0x0a, 0x06,
+  0x03, 0xec, 0x02, 0x2e, 0x05, 0x0b, 0x03, 0xfd, 0x00, 0x3c, 0x05, 0x13,
+  0x21, 0x05, 0x03, 0x50, 0x06, 0x03, 0x90, 0x7c, 0x74, 0x06, 0x03, 0x87,
+  0x08, 0x2e, 0x06, 0x03, 0xf9, 0x77, 0x3c, 0x02, 0x01, 0x00, 0x01, 0x01,
+  0x04, 0x03, 0x00, 0x09, 0x02, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xa5, 0x06, 0x01, 0x05, 0x0d, 0x0a, 0x3f, 0x05, 0x13, 0x06,
+  0x3c, 0x05, 0x07, 0x20, 0x03, 0xd7, 0x79, 0x20, 0x05, 0x0b, 0x06, 0x03,
+  0x94, 0x06, 0x20, 0x05, 0x0c, 0x21, 0x06, 0x03, 0xeb, 0x79, 0x20, 0x05,
+  0x07, 0x06, 0x03, 0x97, 0x06, 0x2e, 0x06, 0x3c, 0x05, 0x11, 0x06, 0x24,
+  0x05, 0x15, 0x06, 0x20, 0x05, 0x07, 0x2e, 0x03, 0xe5, 0x79, 0x20, 0x05,
+  0x03, 0x06, 0x03, 0x9f, 0x06, 0x4a, 0x06, 0x03, 0xe1, 0x79, 0x4a, 0x05,
+  0x0f, 0x06, 0x03, 0xad, 0x06, 0x20, 0x05, 0x0e, 0x06, 0x2e, 0x05, 0x00,
+  0x03, 0xd3, 0x79, 0x20, 0x05, 0x12, 0x06, 0x03, 0xb2, 0x06, 0x3c, 0x05,
+  0x22, 0x06, 0x20, 0x05, 0x07, 0x20, 0x05, 0x0c, 0x06, 0x03, 0xfd, 0x7b,
+  0x20, 0x05, 0x13, 0x22, 0x05, 0x1e, 0x1f, 0x04, 0x00, 0x05, 0x0a, 0x03,
+  0xe2, 0x7d, 0x20, 0x04, 0x03, 0x05, 0x1e, 0x03, 0x9e, 0x02, 0x2e, 0x06,
+  0x03, 0xd0, 0x7d, 0x3c, 0x05, 0x03, 0x06, 0x03, 0xb5, 0x02, 0x4a, 0x05,
+  0x0d, 0x03, 0x82, 0x04, 0x4a, 0x05, 0x13, 0x06, 0x3c, 0x05, 0x07, 0x20,
+  0x05, 0x0d, 0x06, 0x32, 0x05, 0x13, 0x06, 0x3c, 0x05, 0x07, 0x20, 0x03,
+  0xc5, 0x79, 0x20, 0x05, 0x18, 0x06, 0x03, 0xfe, 0x03, 0x20, 0x05, 0x0c,
+  0x21, 0x05, 0x09, 0x24, 0x04, 0x00, 0x05, 0x0a, 0x03, 0x8f, 0x7c, 0x2e,
+  0x06, 0x03, 0x6e, 0x3c, 0x04, 0x03, 0x05, 0x09, 0x06, 0x03, 0x86, 0x04,
+  0x2e, 0x05, 0x07, 0x4b, 0x05, 0x09, 0x25, 0x06, 0x03, 0xf4, 0x7b, 0x20,
+  0x05, 0x0c, 0x06, 0x03, 0x90, 0x04, 0x2e, 0x05, 0x09, 0x3d, 0x06, 0x03,
+  0xef, 0x7b, 0x20, 0x05, 0x05, 0x06, 0x03, 0x95, 0x04, 0x2e, 0x05, 0x0b,
+  0x68, 0x05, 0x09, 0x59, 0x05, 0x16, 0x24, 0x05, 0x11, 0x21, 0x05, 0x14,
+  0x2d, 0x05, 0x0c, 0x24, 0x05, 0x07, 0x21, 0x05, 0x0a, 0x23, 0x05, 0x18,
+  0x57, 0x05, 0x12, 0x21, 0x05, 0x11, 0x2d, 0x06, 0x03, 0xdd, 0x7b, 0x20,
+  0x05, 0x19, 0x06, 0x03, 0xa5, 0x04, 0x2e, 0x06, 0x03, 0xdb, 0x7b, 0x20,
+  0x05, 0x17, 0x03, 0xa5, 0x04, 0x2e, 0x05, 0x19, 0x06, 0x21, 0x05, 0x14,
+  0x21, 0x05, 0x17, 0x1f, 0x22, 0x05, 0x13, 0x06, 0x20, 0x03, 0xd8, 0x7b,
+  0x20, 0x06, 0x03, 0xb7, 0x06, 0x20, 0x05, 0x07, 0x06, 0x20, 0x03, 0xc9,
+  0x79, 0x20, 0x05, 0x4e, 0x06, 0x03, 0xc3, 0x06, 0x3c, 0x05, 0x0d, 0x21,
+  0x05, 0x07, 0x3b, 0x06, 0x03, 0xbd, 0x79, 0x20, 0x05, 0x0c, 0x06, 0x03,
+  0xeb, 0x02, 0x20, 0x06, 0x03, 0x95, 0x7d, 0x20, 0x05, 0x0a, 0x06, 0x03,
+  0xec, 0x02, 0x2e, 0x05, 0x07, 0x03, 0x38, 0x3c, 0x05, 0x0d, 0x24, 0x05,
+  0x07, 0x06, 0x3c, 0x05, 0x09, 0x06, 0x2f, 0x67, 0x05, 0x10, 0x03, 0xb7,
+  0x7f, 0x20, 0x05, 0x05, 0x03, 0xcd, 0x00, 0x2e, 0x05, 0x0f, 0x03, 0xb4,
+  0x7f, 0x3c, 0x05, 0x0d, 0x06, 0x20, 0x04, 0x00, 0x05, 0x0a, 0x06, 0x03,
+  0xb0, 0x7d, 0x20, 0x04, 0x03, 0x05, 0x0e, 0x03, 0xd1, 0x02, 0x2e, 0x05,
+  0x0d, 0x30, 0x06, 0x03, 0x9b, 0x7d, 0x20, 0x05, 0x15, 0x06, 0x03, 0xe4,
+  0x02, 0x20, 0x06, 0x03, 0x9c, 0x7d, 0x20, 0x04, 0x00, 0x05, 0x0a, 0x06,
+  0x03, 0x12, 0x20, 0x04, 0x03, 0x05, 0x13, 0x03, 0xab, 0x04, 0x3c, 0x04,
+  0x00, 0x05, 0x0a, 0x03, 0xd5, 0x7b, 0x20, 0x04, 0x03, 0x05, 0x07, 0x03,
+  0xab, 0x04, 0x3c, 0x05, 0x09, 0x24, 0x05, 0x2c, 0x06, 0x20, 0x05, 0x24,
+  0x3c, 0x05, 0x33, 0x20, 0x05, 0x07, 0x20, 0x03, 0xbf, 0x7b, 0x20, 0x05,
+  0x09, 0x03, 0xc1, 0x04, 0x20, 0x05, 0x0a, 0x06, 0x22, 0x05, 0x07, 0x3d,
+  0x06, 0x03, 0xbc, 0x7b, 0x20, 0x05, 0x03, 0x06, 0x03, 0xcc, 0x04, 0x20,
+  0x06, 0x03, 0xb4, 0x7b, 0x2e, 0x05, 0x0c, 0x06, 0x03, 0xeb, 0x02, 0x20,
+  0x06, 0x03, 0x95, 0x7d, 0x20, 0x05, 0x0a, 0x06, 0x03, 0xec, 0x02, 0x2e,
+  0x05, 0x07, 0x03, 0x0c, 0x3c, 0x06, 0x03, 0x88, 0x7d, 0x20, 0x05, 0x0d,
+  0x06, 0x03, 0xe5, 0x02, 0x2e, 0x06, 0x03, 0x9b, 0x7d, 0x20, 0x05, 0x03,
+  0x06, 0x03, 0xfc, 0x02, 0x20, 0x05, 0x10, 0x03, 0x65, 0x90, 0x05, 0x0f,
+  0x2f, 0x05, 0x0d, 0x06, 0x20, 0x04, 0x00, 0x05, 0x0a, 0x06, 0x03, 0xb0,
+  0x7d, 0x20, 0x04, 0x03, 0x05, 0x0e, 0x03, 0xd1, 0x02, 0x2e, 0x05, 0x15,
+  0x21, 0x05, 0x0b, 0x21, 0x05, 0x13, 0x1f, 0x05, 0x0d, 0x03, 0x1c, 0x20,
+  0x05, 0x07, 0x06, 0x3c, 0x03, 0x80, 0x7d, 0x20, 0x05, 0x14, 0x06, 0x03,
+  0x85, 0x03, 0x20, 0x06, 0x03, 0xfb, 0x7c, 0x20, 0x05, 0x0f, 0x06, 0x03,
+  0x8c, 0x03, 0x20, 0x05, 0x0d, 0x06, 0x3c, 0x05, 0x2f, 0x06, 0x23, 0x05,
+  0x27, 0x06, 0x20, 0x05, 0x0f, 0x06, 0x2b, 0x05, 0x03, 0x22, 0x06, 0x03,
+  0xf2, 0x7c, 0x66, 0x05, 0x14, 0x06, 0x03, 0xaa, 0x04, 0x20, 0x05, 0x09,
+  0x03, 0x8f, 0x7f, 0x4a, 0x05, 0x07, 0x67, 0x05, 0x10, 0x03, 0xa7, 0x7f,
+  0x20, 0x05, 0x03, 0x03, 0xdd, 0x00, 0x2e, 0x05, 0x0f, 0x03, 0xa4, 0x7f,
+  0xac, 0x05, 0x0d, 0x06, 0x20, 0x04, 0x00, 0x05, 0x0a, 0x06, 0x03, 0xb0,
+  0x7d, 0x20, 0x04, 0x03, 0x05, 0x0e, 0x03, 0xd1, 0x02, 0x2e, 0x05, 0x0d,
+  0x30, 0x06, 0x03, 0x9b, 0x7d, 0x20, 0x05, 0x15, 0x06, 0x03, 0xe4, 0x02,
+  0x20, 0x06, 0x03, 0x9c, 0x7d, 0x20, 0x05, 0x13, 0x06, 0x03, 0xc8, 0x03,
+  0x20, 0x05, 0x00, 0x06, 0x03, 0xb8, 0x7c, 0x20, 0x05, 0x0c, 0x06, 0x03,
+  0xd1, 0x03, 0xba, 0x05, 0x0d, 0x3d, 0x05, 0x01, 0x03, 0xf7, 0x02, 0x3c,
+  0x02, 0x01, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0xb8, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfd, 0x05, 0x01, 0x06, 0x03,
+  0x82, 0x7a, 0x58, 0x05, 0x0a, 0x06, 0x0a, 0x03, 0x81, 0x06, 0x20, 0x05,
+  0x15, 0x2f, 0x05, 0x25, 0x06, 0x3c, 0x05, 0x32, 0x20, 0x05, 0x2a, 0x20,
+  0x05, 0x0a, 0x06, 0x1f, 0x05, 0x0d, 0x21, 0x05, 0x2a, 0x06, 0x4a, 0x05,
+  0x07, 0x2e, 0x05, 0x0a, 0x06, 0x03, 0x60, 0x20, 0x05, 0x17, 0x06, 0x20,
+  0x03, 0x9e, 0x7a, 0x20, 0x05, 0x1a, 0x03, 0xe2, 0x05, 0x58, 0x03, 0x9e,
+  0x7a, 0x2e, 0x03, 0xe2, 0x05, 0x20, 0x03, 0x9e, 0x7a, 0x20, 0x03, 0xe2,
+  0x05, 0x3c, 0x2e, 0x05, 0x41, 0x20, 0x05, 0x07, 0x3c, 0x05, 0x0a, 0x06,
+  0x24, 0x05, 0x15, 0x06, 0x3c, 0x03, 0x9a, 0x7a, 0x20, 0x05, 0x09, 0x06,
+  0x03, 0xda, 0x04, 0x58, 0x06, 0x03, 0xa6, 0x7b, 0x2e, 0x03, 0xda, 0x04,
+  0x20, 0x03, 0xa6, 0x7b, 0x20, 0x03, 0xda, 0x04, 0x3c, 0x2e, 0x05, 0x07,
+  0x06, 0x21, 0x06, 0x03, 0xa5, 0x7b, 0x20, 0x05, 0x0b, 0x06, 0x03, 0xdc,
+  0x04, 0x58, 0x06, 0x03, 0xa4, 0x7b, 0x2e, 0x03, 0xdc, 0x04, 0x20, 0x03,
+  0xa4, 0x7b, 0x20, 0x03, 0xdc, 0x04, 0x3c, 0x2e, 0x03, 0xa4, 0x7b, 0x20,
+  0x05, 0x0a, 0x06, 0x03, 0xdf, 0x04, 0x4a, 0x06, 0x2e, 0x05, 0x2d, 0x06,
+  0x03, 0x87, 0x01, 0x20, 0x05, 0x07, 0x06, 0x3c, 0x05, 0x0a, 0x06, 0x24,
+  0x05, 0x19, 0x06, 0x20, 0x03, 0x96, 0x7a, 0x20, 0x05, 0x15, 0x06, 0x03,
+  0xe9, 0x04, 0x58, 0x06, 0x03, 0x97, 0x7b, 0x2e, 0x03, 0xe9, 0x04, 0x20,
+  0x03, 0x97, 0x7b, 0x20, 0x05, 0x12, 0x06, 0x03, 0xeb, 0x04, 0x20, 0x06,
+  0x03, 0x95, 0x7b, 0x20, 0x05, 0x07, 0x03, 0xeb, 0x04, 0x2e, 0x03, 0x95,
+  0x7b, 0x20, 0x05, 0x0a, 0x06, 0x03, 0xef, 0x04, 0x4a, 0x06, 0x03, 0x91,
+  0x7b, 0x3c, 0x03, 0xef, 0x04, 0x20, 0x03, 0x91, 0x7b, 0x20, 0x03, 0xef,
+  0x04, 0x20, 0x03, 0x91, 0x7b, 0x3c, 0x03, 0xef, 0x04, 0x20, 0x03, 0x91,
+  0x7b, 0x20, 0x03, 0xef, 0x04, 0x3c, 0x2e, 0x05, 0x35, 0x06, 0x03, 0xfb,
+  0x00, 0x20, 0x05, 0x07, 0x06, 0x3c, 0x05, 0x0e, 0x06, 0x24, 0x05, 0x19,
+  0x06, 0x3c, 0x05, 0x1f, 0x20, 0x05, 0x30, 0x20, 0x05, 0x36, 0x20, 0x05,
+  0x41, 0x3c, 0x05, 0x0a, 0x06, 0x22, 0x05, 0x0e, 0x3b, 0x05, 0x14, 0x06,
+  0x3c, 0x03, 0x91, 0x7a, 0x20, 0x05, 0x0a, 0x06, 0x03, 0xf0, 0x05, 0x20,
+  0x05, 0x13, 0x06, 0x20, 0x05, 0x18, 0x2e, 0x03, 0x90, 0x7a, 0x20, 0x05,
+  0x0e, 0x06, 0x03, 0xf4, 0x05, 0x58, 0x06, 0x2e, 0x05, 0x0a, 0x06, 0x21,
+  0x05, 0x18, 0x06, 0x3c, 0x05, 0x2a, 0x20, 0x05, 0x24, 0x20, 0x03, 0x8b,
+  0x7a, 0x3c, 0x05, 0x07, 0x03, 0xf5, 0x05, 0x20, 0x03, 0x8b, 0x7a, 0x20,
+  0x03, 0xf5, 0x05, 0x2e, 0x05, 0x01, 0x06, 0x03, 0x12, 0x2e, 0x06, 0x03,
+  0xf9, 0x79, 0x3c, 0x05, 0x11, 0x06, 0x03, 0xf9, 0x05, 0x20, 0x06, 0x03,
+  0x87, 0x7a, 0x2e, 0x05, 0x19, 0x06, 0x03, 0x8c, 0x05, 0x58, 0x06, 0x03,
+  0xf4, 0x7a, 0x2e, 0x03, 0x8c, 0x05, 0x2e, 0x03, 0xf4, 0x7a, 0x20, 0x05,
+  0x12, 0x06, 0x03, 0x8d, 0x05, 0x2e, 0x06, 0x03, 0xf3, 0x7a, 0x3c, 0x03,
+  0x8d, 0x05, 0x20, 0x05, 0x07, 0x06, 0x23, 0x05, 0x10, 0x24, 0x05, 0x07,
+  0x06, 0x20, 0x05, 0x37, 0x06, 0x21, 0x05, 0x09, 0x06, 0x4a, 0x05, 0x43,
+  0x2e, 0x05, 0x0e, 0x06, 0x21, 0x05, 0x1c, 0x06, 0x20, 0x05, 0x09, 0x06,
+  0x2d, 0x05, 0x0d, 0x28, 0x05, 0x25, 0x06, 0x20, 0x05, 0x32, 0x3c, 0x03,
+  0xe3, 0x7a, 0x20, 0x05, 0x17, 0x06, 0x03, 0x9c, 0x05, 0x2e, 0x05, 0x14,
+  0x1f, 0x2d, 0x05, 0x20, 0x32, 0x06, 0x03, 0xe2, 0x7a, 0x3c, 0x05, 0x03,
+  0x06, 0x03, 0x9f, 0x05, 0x90, 0x05, 0x0e, 0x06, 0x2e, 0x05, 0x39, 0x06,
+  0x21, 0x05, 0x09, 0x06, 0x4a, 0x05, 0x45, 0x2e, 0x05, 0x0a, 0x06, 0x21,
+  0x05, 0x2d, 0x06, 0x20, 0x05, 0x09, 0x06, 0x1f, 0x06, 0x03, 0xe0, 0x7a,
+  0x20, 0x05, 0x18, 0x06, 0x03, 0xa7, 0x05, 0x2e, 0x05, 0x05, 0x2d, 0x81,
+  0x06, 0x03, 0xdb, 0x7a, 0x74, 0x05, 0x10, 0x06, 0x03, 0x94, 0x05, 0x20,
+  0x06, 0x03, 0xec, 0x7a, 0x3c, 0x05, 0x0a, 0x06, 0x03, 0xad, 0x05, 0x20,
+  0x05, 0x10, 0x06, 0x3c, 0x05, 0x07, 0x20, 0x05, 0x10, 0x06, 0x03, 0x67,
+  0x20, 0x06, 0x03, 0xec, 0x7a, 0x4a, 0x05, 0x18, 0x06, 0x03, 0xae, 0x05,
+  0x20, 0x05, 0x0f, 0x06, 0x3c, 0x05, 0x09, 0x2e, 0x05, 0x0d, 0x06, 0x24,
+  0x05, 0x13, 0x06, 0x20, 0x05, 0x2a, 0x20, 0x05, 0x00, 0x03, 0xce, 0x7a,
+  0x20, 0x05, 0x07, 0x06, 0x03, 0xf5, 0x04, 0x74, 0x06, 0x03, 0x8b, 0x7b,
+  0x3c, 0x05, 0x20, 0x06, 0x03, 0xf9, 0x04, 0x20, 0x05, 0x28, 0x06, 0x3c,
+  0x05, 0x33, 0x2e, 0x05, 0x36, 0x20, 0x05, 0x3e, 0x2e, 0x05, 0x49, 0x2e,
+  0x05, 0x0a, 0x06, 0x21, 0x05, 0x12, 0x06, 0x4a, 0x05, 0x09, 0x06, 0x03,
+  0x38, 0x2e, 0x06, 0x03, 0xce, 0x7a, 0x2e, 0x05, 0x10, 0x06, 0x03, 0x94,
+  0x05, 0x20, 0x05, 0x09, 0x03, 0x1e, 0x20, 0x06, 0x03, 0xce, 0x7a, 0x20,
+  0x03, 0xb2, 0x05, 0x20, 0x05, 0x0d, 0x06, 0x25, 0x05, 0x13, 0x06, 0x3c,
+  0x05, 0x2a, 0x20, 0x05, 0x00, 0x03, 0xc9, 0x7a, 0x20, 0x05, 0x07, 0x06,
+  0x03, 0xf5, 0x04, 0x66, 0x06, 0x03, 0x8b, 0x7b, 0x2e, 0x05, 0x20, 0x06,
+  0x03, 0xf9, 0x04, 0x20, 0x05, 0x28, 0x06, 0x4a, 0x05, 0x33, 0x2e, 0x05,
+  0x36, 0x20, 0x05, 0x3e, 0x2e, 0x05, 0x49, 0x2e, 0x05, 0x0a, 0x06, 0x21,
+  0x05, 0x12, 0x06, 0x4a, 0x05, 0x09, 0x06, 0x03, 0x3d, 0x2e, 0x06, 0x03,
+  0xc9, 0x7a, 0x2e, 0x05, 0x10, 0x06, 0x03, 0x94, 0x05, 0x20, 0x05, 0x09,
+  0x03, 0x23, 0x20, 0x06, 0x03, 0xc9, 0x7a, 0x20, 0x03, 0xb7, 0x05, 0x20,
+  0x05, 0x0a, 0x06, 0x26, 0x05, 0x1b, 0x06, 0x3c, 0x03, 0xc3, 0x7a, 0x20,
+  0x05, 0x30, 0x03, 0xbd, 0x05, 0x20, 0x05, 0x2a, 0x3c, 0x05, 0x07, 0x20,
+  0x05, 0x0a, 0x06, 0x24, 0x05, 0x15, 0x06, 0x3c, 0x03, 0xbf, 0x7a, 0x20,
+  0x05, 0x1b, 0x03, 0xc1, 0x05, 0x20, 0x05, 0x07, 0x20, 0x03, 0xbf, 0x7a,
+  0x20, 0x05, 0x22, 0x06, 0x03, 0xc5, 0x05, 0x20, 0x06, 0x03, 0xbb, 0x7a,
+  0x4a, 0x05, 0x07, 0x06, 0x03, 0xcb, 0x05, 0x20, 0x06, 0x03, 0xb5, 0x7a,
+  0x2e, 0x05, 0x38, 0x06, 0x03, 0xd0, 0x05, 0x20, 0x06, 0x03, 0xb0, 0x7a,
+  0x20, 0x03, 0xd0, 0x05, 0x20, 0x05, 0x07, 0x20, 0x3c, 0x05, 0x0e, 0x06,
+  0x24, 0x05, 0x19, 0x06, 0x3c, 0x05, 0x2b, 0x20, 0x05, 0x1c, 0x20, 0x05,
+  0x32, 0x20, 0x03, 0xac, 0x7a, 0x20, 0x05, 0x0e, 0x06, 0x03, 0xd5, 0x05,
+  0x20, 0x05, 0x19, 0x06, 0x20, 0x05, 0x2b, 0x20, 0x05, 0x1c, 0x4a, 0x05,
+  0x25, 0x20, 0x03, 0xab, 0x7a, 0x20, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04,
+  0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xd3, 0x07, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x05, 0x0c, 0x03, 0xb4,
+  0x7f, 0x20, 0x05, 0x13, 0x23, 0x06, 0x03, 0xf5, 0x78, 0x20, 0x05, 0x22,
+  0x06, 0x03, 0x8a, 0x07, 0x20, 0x06, 0x03, 0xf6, 0x78, 0x2e, 0x05, 0x07,
+  0x06, 0x03, 0x8f, 0x07, 0x2e, 0x05, 0x38, 0x06, 0x3c, 0x05, 0x08, 0x06,
+  0x21, 0x05, 0x07, 0x2d, 0x06, 0x03, 0xf1, 0x78, 0x20, 0x05, 0x03, 0x06,
+  0x03, 0x94, 0x07, 0x4a, 0x05, 0x01, 0x03, 0xc0, 0x00, 0x4a, 0x02, 0x02,
+  0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xd3, 0x07, 0x01, 0x05, 0x01, 0x0a, 0x01,
+  0x02, 0x05, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd4, 0x07, 0x01, 0x05, 0x01,
+  0x0a, 0x01, 0x05, 0x0c, 0x03, 0xb3, 0x7f, 0x20, 0x05, 0x13, 0x23, 0x06,
+  0x03, 0xf5, 0x78, 0x20, 0x05, 0x22, 0x06, 0x03, 0x8a, 0x07, 0x20, 0x06,
+  0x03, 0xf6, 0x78, 0x2e, 0x05, 0x07, 0x06, 0x03, 0x8f, 0x07, 0x2e, 0x05,
+  0x38, 0x06, 0x3c, 0x05, 0x08, 0x06, 0x21, 0x05, 0x07, 0x2d, 0x06, 0x03,
+  0xf1, 0x78, 0x20, 0x05, 0x03, 0x06, 0x03, 0x94, 0x07, 0x4a, 0x05, 0x01,
+  0x03, 0xc1, 0x00, 0x4a, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00,
+  0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd4,
+  0x07, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x02, 0x05, 0x00, 0x01, 0x01, 0x04,
+  0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xd5, 0x07, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x05, 0x0c, 0x03, 0xb2,
+  0x7f, 0x20, 0x05, 0x13, 0x23, 0x06, 0x03, 0xf5, 0x78, 0x20, 0x05, 0x22,
+  0x06, 0x03, 0x8a, 0x07, 0x20, 0x06, 0x03, 0xf6, 0x78, 0x2e, 0x05, 0x07,
+  0x06, 0x03, 0x8f, 0x07, 0x2e, 0x05, 0x38, 0x06, 0x3c, 0x05, 0x08, 0x06,
+  0x21, 0x05, 0x07, 0x2d, 0x06, 0x03, 0xf1, 0x78, 0x20, 0x05, 0x03, 0x06,
+  0x03, 0x94, 0x07, 0x4a, 0x05, 0x01, 0x03, 0xc2, 0x00, 0x4a, 0x02, 0x02,
+  0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xd5, 0x07, 0x01, 0x05, 0x01, 0x0a, 0x01,
+  0x02, 0x05, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd6, 0x07, 0x01, 0x05, 0x01,
+  0x0a, 0x01, 0x05, 0x0c, 0x03, 0xb1, 0x7f, 0x20, 0x05, 0x13, 0x23, 0x06,
+  0x03, 0xf5, 0x78, 0x20, 0x05, 0x22, 0x06, 0x03, 0x8a, 0x07, 0x20, 0x06,
+  0x03, 0xf6, 0x78, 0x2e, 0x05, 0x07, 0x06, 0x03, 0x8f, 0x07, 0x2e, 0x05,
+  0x38, 0x06, 0x3c, 0x05, 0x08, 0x06, 0x21, 0x05, 0x07, 0x2d, 0x06, 0x03,
+  0xf1, 0x78, 0x20, 0x05, 0x03, 0x06, 0x03, 0x94, 0x07, 0x4a, 0x05, 0x01,
+  0x03, 0xc3, 0x00, 0x4a, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00,
+  0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd6,
+  0x07, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x02, 0x05, 0x00, 0x01, 0x01, 0x04,
+  0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xe8, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x05, 0x1e, 0x03, 0xa6,
+  0x7f, 0x2e, 0x05, 0x17, 0x03, 0x51, 0x90, 0x05, 0x07, 0x22, 0x05, 0x17,
+  0x24, 0x05, 0x15, 0x06, 0x4a, 0x05, 0x0c, 0x06, 0x03, 0x2a, 0x20, 0x06,
+  0x03, 0xf0, 0x77, 0x20, 0x05, 0x08, 0x06, 0x03, 0x92, 0x08, 0x2e, 0x05,
+  0x07, 0x4b, 0x06, 0x03, 0xed, 0x77, 0x20, 0x05, 0x05, 0x06, 0x03, 0x94,
+  0x08, 0x4a, 0x05, 0x0a, 0x59, 0x05, 0x09, 0x59, 0x05, 0x0b, 0x25, 0x05,
+  0x0d, 0x23, 0x05, 0x1d, 0x67, 0x05, 0x0c, 0x21, 0x05, 0x09, 0x06, 0x4a,
+  0x05, 0x0f, 0x06, 0x21, 0x05, 0x0a, 0x06, 0x20, 0x03, 0xdf, 0x77, 0x2e,
+  0x05, 0x07, 0x06, 0x03, 0xa7, 0x08, 0x20, 0x05, 0x06, 0x26, 0x05, 0x0e,
+  0x68, 0x05, 0x0c, 0x2d, 0x05, 0x0a, 0x1f, 0x06, 0x03, 0xd3, 0x77, 0x3c,
+  0x05, 0x0d, 0x06, 0x03, 0xb1, 0x08, 0x2e, 0x06, 0x2e, 0x03, 0xcf, 0x77,
+  0x3c, 0x05, 0x34, 0x03, 0xb1, 0x08, 0x20, 0x03, 0xcf, 0x77, 0x20, 0x05,
+  0x0b, 0x03, 0xb1, 0x08, 0x20, 0x05, 0x00, 0x03, 0xcf, 0x77, 0x20, 0x05,
+  0x01, 0x06, 0x03, 0xe9, 0x08, 0x2e, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04,
+  0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xe8, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x02, 0x03, 0x00, 0x01,
+  0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xe9, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x05, 0x1e,
+  0x03, 0xa5, 0x7f, 0x2e, 0x05, 0x17, 0x03, 0x51, 0x90, 0x05, 0x07, 0x22,
+  0x05, 0x17, 0x24, 0x05, 0x15, 0x06, 0x4a, 0x05, 0x0c, 0x06, 0x03, 0x2a,
+  0x20, 0x06, 0x03, 0xf0, 0x77, 0x20, 0x05, 0x08, 0x06, 0x03, 0x92, 0x08,
+  0x2e, 0x05, 0x07, 0x4b, 0x06, 0x03, 0xed, 0x77, 0x20, 0x05, 0x05, 0x06,
+  0x03, 0x94, 0x08, 0x4a, 0x05, 0x0a, 0x59, 0x05, 0x09, 0x59, 0x05, 0x0b,
+  0x25, 0x05, 0x0d, 0x23, 0x05, 0x1d, 0x67, 0x05, 0x0c, 0x21, 0x05, 0x09,
+  0x06, 0x4a, 0x05, 0x0f, 0x06, 0x21, 0x05, 0x0a, 0x06, 0x20, 0x03, 0xdf,
+  0x77, 0x2e, 0x05, 0x07, 0x06, 0x03, 0xa7, 0x08, 0x20, 0x05, 0x06, 0x26,
+  0x05, 0x0e, 0x68, 0x05, 0x0c, 0x2d, 0x05, 0x0a, 0x1f, 0x06, 0x03, 0xd3,
+  0x77, 0x3c, 0x05, 0x0d, 0x06, 0x03, 0xb1, 0x08, 0x2e, 0x06, 0x2e, 0x03,
+  0xcf, 0x77, 0x3c, 0x05, 0x34, 0x03, 0xb1, 0x08, 0x20, 0x03, 0xcf, 0x77,
+  0x20, 0x05, 0x0b, 0x03, 0xb1, 0x08, 0x20, 0x05, 0x00, 0x03, 0xcf, 0x77,
+  0x20, 0x05, 0x01, 0x06, 0x03, 0xea, 0x08, 0x2e, 0x02, 0x02, 0x00, 0x01,
+  0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xe9, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x02, 0x03,
+  0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xea, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01,
+  0x05, 0x1e, 0x03, 0xa4, 0x7f, 0x2e, 0x05, 0x17, 0x03, 0x51, 0x90, 0x05,
+  0x07, 0x22, 0x05, 0x17, 0x24, 0x05, 0x15, 0x06, 0x4a, 0x05, 0x0c, 0x06,
+  0x03, 0x2a, 0x20, 0x06, 0x03, 0xf0, 0x77, 0x20, 0x05, 0x08, 0x06, 0x03,
+  0x92, 0x08, 0x2e, 0x05, 0x07, 0x4b, 0x06, 0x03, 0xed, 0x77, 0x20, 0x05,
+  0x05, 0x06, 0x03, 0x94, 0x08, 0x4a, 0x05, 0x0a, 0x59, 0x05, 0x09, 0x59,
+  0x05, 0x0b, 0x25, 0x05, 0x0d, 0x23, 0x05, 0x1d, 0x67, 0x05, 0x0c, 0x21,
+  0x05, 0x09, 0x06, 0x4a, 0x05, 0x0f, 0x06, 0x21, 0x05, 0x0a, 0x06, 0x20,
+  0x03, 0xdf, 0x77, 0x2e, 0x05, 0x07, 0x06, 0x03, 0xa7, 0x08, 0x20, 0x05,
+  0x06, 0x26, 0x05, 0x0e, 0x68, 0x05, 0x0c, 0x2d, 0x05, 0x0a, 0x1f, 0x06,
+  0x03, 0xd3, 0x77, 0x3c, 0x05, 0x0d, 0x06, 0x03, 0xb1, 0x08, 0x2e, 0x06,
+  0x2e, 0x03, 0xcf, 0x77, 0x3c, 0x05, 0x34, 0x03, 0xb1, 0x08, 0x20, 0x03,
+  0xcf, 0x77, 0x20, 0x05, 0x0b, 0x03, 0xb1, 0x08, 0x20, 0x05, 0x00, 0x03,
+  0xcf, 0x77, 0x20, 0x05, 0x01, 0x06, 0x03, 0xeb, 0x08, 0x2e, 0x02, 0x02,
+  0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xea, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01,
+  0x02, 0x03, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xeb, 0x08, 0x01, 0x05, 0x01,
+  0x0a, 0x01, 0x05, 0x1e, 0x03, 0xa3, 0x7f, 0x2e, 0x05, 0x17, 0x03, 0x51,
+  0x90, 0x05, 0x07, 0x22, 0x05, 0x17, 0x24, 0x05, 0x15, 0x06, 0x4a, 0x05,
+  0x0c, 0x06, 0x03, 0x2a, 0x20, 0x06, 0x03, 0xf0, 0x77, 0x20, 0x05, 0x08,
+  0x06, 0x03, 0x92, 0x08, 0x2e, 0x05, 0x07, 0x4b, 0x06, 0x03, 0xed, 0x77,
+  0x20, 0x05, 0x05, 0x06, 0x03, 0x94, 0x08, 0x4a, 0x05, 0x0a, 0x59, 0x05,
+  0x09, 0x59, 0x05, 0x0b, 0x25, 0x05, 0x0d, 0x23, 0x05, 0x1d, 0x67, 0x05,
+  0x0c, 0x21, 0x05, 0x09, 0x06, 0x4a, 0x05, 0x0f, 0x06, 0x21, 0x05, 0x0a,
+  0x06, 0x20, 0x03, 0xdf, 0x77, 0x2e, 0x05, 0x07, 0x06, 0x03, 0xa7, 0x08,
+  0x20, 0x05, 0x06, 0x26, 0x05, 0x0e, 0x5a, 0x05, 0x0c, 0x1f, 0x05, 0x0a,
+  0x1f, 0x06, 0x03, 0xd3, 0x77, 0x3c, 0x05, 0x0d, 0x06, 0x03, 0xb1, 0x08,
+  0x2e, 0x06, 0x3c, 0x03, 0xcf, 0x77, 0x3c, 0x05, 0x34, 0x03, 0xb1, 0x08,
+  0x2e, 0x03, 0xcf, 0x77, 0x20, 0x05, 0x0b, 0x03, 0xb1, 0x08, 0x20, 0x05,
+  0x00, 0x03, 0xcf, 0x77, 0x20, 0x05, 0x01, 0x06, 0x03, 0xec, 0x08, 0x2e,
+  0x02, 0x02, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xeb, 0x08, 0x01, 0x05, 0x01,
+  0x0a, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0x08, 0x01,
+  0x05, 0x01, 0x0a, 0x01, 0x05, 0x1e, 0x03, 0xa2, 0x7f, 0x2e, 0x05, 0x17,
+  0x03, 0x51, 0x90, 0x05, 0x07, 0x22, 0x05, 0x17, 0x24, 0x05, 0x15, 0x06,
+  0x4a, 0x05, 0x0c, 0x06, 0x03, 0x2a, 0x20, 0x06, 0x03, 0xf0, 0x77, 0x20,
+  0x05, 0x08, 0x06, 0x03, 0x92, 0x08, 0x2e, 0x05, 0x07, 0x4b, 0x06, 0x03,
+  0xed, 0x77, 0x20, 0x05, 0x05, 0x06, 0x03, 0x94, 0x08, 0x4a, 0x05, 0x0a,
+  0x59, 0x05, 0x09, 0x59, 0x05, 0x0b, 0x25, 0x05, 0x0d, 0x23, 0x05, 0x1d,
+  0x67, 0x05, 0x0c, 0x21, 0x05, 0x09, 0x06, 0x4a, 0x05, 0x0f, 0x06, 0x21,
+  0x05, 0x0a, 0x06, 0x20, 0x03, 0xdf, 0x77, 0x2e, 0x05, 0x07, 0x06, 0x03,
+  0xa7, 0x08, 0x20, 0x05, 0x06, 0x26, 0x05, 0x0e, 0x5a, 0x05, 0x0c, 0x1f,
+  0x05, 0x0a, 0x1f, 0x06, 0x03, 0xd3, 0x77, 0x3c, 0x05, 0x0d, 0x06, 0x03,
+  0xb1, 0x08, 0x2e, 0x06, 0x3c, 0x03, 0xcf, 0x77, 0x3c, 0x05, 0x34, 0x03,
+  0xb1, 0x08, 0x2e, 0x03, 0xcf, 0x77, 0x20, 0x05, 0x0b, 0x03, 0xb1, 0x08,
+  0x20, 0x05, 0x00, 0x03, 0xcf, 0x77, 0x20, 0x05, 0x01, 0x06, 0x03, 0xed,
+  0x08, 0x2e, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00, 0x09, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0x08, 0x01,
+  0x05, 0x01, 0x0a, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00,
+  0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xed,
+  0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x05, 0x1e, 0x03, 0xa1, 0x7f, 0x2e,
+  0x05, 0x17, 0x03, 0x51, 0x90, 0x05, 0x07, 0x22, 0x05, 0x17, 0x24, 0x05,
+  0x15, 0x06, 0x4a, 0x05, 0x0c, 0x06, 0x03, 0x2a, 0x20, 0x06, 0x03, 0xf0,
+  0x77, 0x20, 0x05, 0x08, 0x06, 0x03, 0x92, 0x08, 0x2e, 0x05, 0x07, 0x4b,
+  0x06, 0x03, 0xed, 0x77, 0x20, 0x05, 0x05, 0x06, 0x03, 0x94, 0x08, 0x4a,
+  0x05, 0x0a, 0x59, 0x05, 0x09, 0x59, 0x05, 0x0b, 0x25, 0x05, 0x0d, 0x23,
+  0x05, 0x1d, 0x67, 0x05, 0x0c, 0x21, 0x05, 0x09, 0x06, 0x4a, 0x05, 0x0f,
+  0x06, 0x21, 0x05, 0x0a, 0x06, 0x20, 0x03, 0xdf, 0x77, 0x2e, 0x05, 0x07,
+  0x06, 0x03, 0xa7, 0x08, 0x20, 0x05, 0x06, 0x26, 0x05, 0x0e, 0x5a, 0x05,
+  0x0c, 0x1f, 0x05, 0x0a, 0x1f, 0x06, 0x03, 0xd3, 0x77, 0x3c, 0x05, 0x0d,
+  0x06, 0x03, 0xb1, 0x08, 0x2e, 0x06, 0x3c, 0x03, 0xcf, 0x77, 0x3c, 0x05,
+  0x34, 0x03, 0xb1, 0x08, 0x2e, 0x03, 0xcf, 0x77, 0x20, 0x05, 0x0b, 0x03,
+  0xb1, 0x08, 0x20, 0x05, 0x00, 0x03, 0xcf, 0x77, 0x20, 0x05, 0x01, 0x06,
+  0x03, 0xee, 0x08, 0x2e, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04, 0x03, 0x00,
+  0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xed,
+  0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x04,
+  0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x1c, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x02, 0x05, 0x00, 0x01, 0x01,
+  0x04, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x1c, 0x01, 0x05, 0x11, 0x0a, 0x01, 0x02, 0x05, 0x00, 0x01,
+  0x01, 0x04, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x1c, 0x01, 0x05, 0x21, 0x0a, 0x01, 0x02, 0x05, 0x00,
+  0x01, 0x01, 0x04, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x1c, 0x01, 0x05, 0x31, 0x0a, 0x01, 0x02, 0x05,
+  0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x1c, 0x01, 0x05, 0x41, 0x0a, 0x01, 0x02,
+  0x05, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0x01, 0x04, 0x03, 0x05, 0x13,
+  0x0a, 0x03, 0x9d, 0x02, 0x20, 0x05, 0x1e, 0x1f, 0x04, 0x00, 0x05, 0x0a,
+  0x03, 0xd1, 0x7d, 0x20, 0x06, 0x03, 0x6e, 0x2e, 0x04, 0x03, 0x05, 0x1e,
+  0x06, 0x03, 0xc1, 0x02, 0x20, 0x04, 0x00, 0x05, 0x00, 0x06, 0x03, 0xbf,
+  0x7d, 0x3c, 0x04, 0x03, 0x05, 0x09, 0x06, 0x03, 0xc6, 0x02, 0x20, 0x05,
+  0x07, 0x3d, 0x06, 0x03, 0xb9, 0x7d, 0x20, 0x05, 0x09, 0x06, 0x03, 0xcb,
+  0x02, 0x20, 0x06, 0x03, 0xb5, 0x7d, 0x20, 0x05, 0x03, 0x06, 0x03, 0xcd,
+  0x02, 0x2e, 0x04, 0x00, 0x05, 0x07, 0x03, 0xdb, 0x7d, 0x3c, 0x05, 0x0a,
+  0x24, 0x05, 0x01, 0x4b, 0x02, 0x02, 0x00, 0x01, 0x01, 0x2f, 0x6d, 0x6e,
+  0x74, 0x2f, 0x73, 0x72, 0x63, 0x00, 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c,
+  0x69, 0x62, 0x2f, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x2f, 0x69, 0x6e, 0x63,
+  0x6c, 0x75, 0x64, 0x65, 0x00, 0x2e, 0x00, 0x2f, 0x75, 0x73, 0x72, 0x2f,
+  0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x61, 0x73, 0x6d, 0x2d,
+  0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x00, 0x2f, 0x75, 0x73, 0x72,
+  0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x62, 0x70, 0x66,
+  0x00, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x2f, 0x75, 0x61, 0x70, 0x69,
+  0x2f, 0x6c, 0x69, 0x6e, 0x75, 0x78, 0x00, 0x2f, 0x75, 0x73, 0x72, 0x2f,
+  0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x61, 0x73, 0x6d, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f,
+  0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2e, 0x62, 0x70, 0x66, 0x2e, 0x63, 0x00,
+  0x73, 0x74, 0x64, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x2e, 0x68, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x62, 0x70, 0x66,
+  0x2e, 0x68, 0x00, 0x69, 0x6e, 0x74, 0x2d, 0x6c, 0x6c, 0x36, 0x34, 0x2e,
+  0x68, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72,
+  0x5f, 0x64, 0x65, 0x66, 0x73, 0x2e, 0x68, 0x00, 0x62, 0x70, 0x66, 0x2e,
+  0x68, 0x00, 0x62, 0x70, 0x66, 0x5f, 0x63, 0x6f, 0x72, 0x65, 0x5f, 0x72,
+  0x65, 0x61, 0x64, 0x2e, 0x68, 0x00, 0x70, 0x74, 0x72, 0x61, 0x63, 0x65,
+  0x2e, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xeb, 0x04, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x46, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+  0xb8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x02, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x97, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x08, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x08, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x51, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+  0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcd, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xb8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xea, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xd0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xc8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xac, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x81, 0x09, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x07, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x91, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x46, 0x07, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0x09, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbd, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+  0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x93, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xb0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa3, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x38, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x93, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xa0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x81, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x50, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x80, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x60, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xad, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x28, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x78, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x90, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x59, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xc0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x88, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x28, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xac, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x80, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x28, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xae, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xc8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xa8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe1, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x78, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x58, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x40, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x58, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x66, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x80, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x18, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x38, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x88, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xee, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xe8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x08, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xc0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x40, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf2, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xf8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xa8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0xd0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x60, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x51, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x12, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xee, 0x03, 0x00, 0x00, 0x12, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00, 0x11, 0x00, 0x3c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0x03, 0x00, 0x00, 0x12, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x00, 0x00, 0x12, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0x04, 0x00, 0x00, 0x12, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x04, 0x00, 0x00, 0x12, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x12, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x05, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x05, 0x00, 0x00, 0x12, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x12, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0x12, 0x00, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x06, 0x00, 0x00, 0x12, 0x00, 0x2c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x12, 0x00, 0x2e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x74, 0x0a, 0x00, 0x00, 0x12, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xda, 0x09, 0x00, 0x00, 0x12, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xef, 0x08, 0x00, 0x00, 0x12, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x08, 0x00, 0x00, 0x12, 0x00, 0x36, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf4, 0x07, 0x00, 0x00, 0x12, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0x00, 0x12, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x00, 0x11, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0xa8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x88, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x98, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xe8, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xd0, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x30, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x68, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0xa8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0xc8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0xe8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x80, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x58, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xd8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x28, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x60, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xa8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xc8, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0xf8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xb8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x38, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x88, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xd0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x28, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x80, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xe8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x58, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0xb8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x48, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x28, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x78, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x3c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x54, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x6c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x9c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xb4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xcc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xd8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xe4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xfc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x2c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x5c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xbc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xc8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xd4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xec, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x1c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x28, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x34, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x4c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x58, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x64, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x68, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x6c, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x74, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x94, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xac, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xb8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xc4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xd0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xdc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xe8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xec, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x3c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x54, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x64, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x6c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x74, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x78, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x94, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x98, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x9c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xac, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xb4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xb8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xc4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xcc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xd8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xe4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xe8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xf4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xfc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x2c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x38, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x44, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x4c, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x58, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x5c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x68, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x74, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x84, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x88, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x8c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x98, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa0, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xac, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xb0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xb4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xbc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xc8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xd4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xd8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xe0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xe4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xec, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xf4, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x1c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x34, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x3c, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x44, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x48, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x4c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x50, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x54, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x58, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x5c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x64, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x68, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x6c, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x70, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x74, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x7c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x88, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x94, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x98, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x9c, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xa4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xac, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xb0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xb4, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xb8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xbc, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xc4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xc8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xd0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xdc, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xe8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xf0, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x0c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x14, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x34, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x3c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x44, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x4c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x54, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x58, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x64, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x68, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x6c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x74, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x78, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x7c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x8c, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x90, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x98, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0xa0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xe8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x78, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x38, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x50, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x54, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x60, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x6c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x78, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x84, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x90, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x9c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xa8, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xb4, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xc0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xcc, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0xe4, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0xfc, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x44, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xa4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0xd4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x98, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xc8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x58, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc8, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xd8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x88, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x98, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x28, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x88, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x98, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xf0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x10, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x20, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x30, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x40, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x50, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x60, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x70, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x80, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x98, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xb0, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xd0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xe0, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xf0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x20, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x30, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x40, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x50, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x60, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x90, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xa0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xb0, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0xc0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xd0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xe0, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0xf0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x20, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x30, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x58, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x70, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x90, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xa0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0xb0, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xd0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x50, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x90, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0xa0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xb0, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0xc0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0xd0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xe0, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0xf0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x30, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x40, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x50, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x70, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x80, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x90, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xa0, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0xb0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0xe0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0xf0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x30, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x40, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x50, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x68, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x80, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x90, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xa0, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xb0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0xc0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xd0, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xe0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x10, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x20, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x30, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x40, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x50, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x60, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x70, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x80, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x90, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xa0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0xb0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc0, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xd0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0xe0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf0, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x10, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x20, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x30, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x50, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x60, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x70, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x80, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x98, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0xb0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xc0, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xd0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xe0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xf0, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x10, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x20, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x30, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x40, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x50, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x60, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x70, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x80, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x90, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xa0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xb0, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xc0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xd0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xe0, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xf0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x10, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x20, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x30, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x40, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x50, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x70, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x80, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x90, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xa0, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xb0, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xc8, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xe0, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xf0, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x20, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x30, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x40, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x50, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x60, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x70, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x80, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x90, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xa0, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xb0, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xc0, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xd0, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xe0, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xf0, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x30, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x60, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x70, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x90, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xa0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xb0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xc0, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xd0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xe0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xf8, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x10, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x20, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x30, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x50, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x60, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x70, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x90, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0xa0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0xb0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xc0, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0xd0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0xe0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xf0, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x10, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x20, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x30, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x40, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x50, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x60, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x70, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x90, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xb0, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0xc0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0xd0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xe0, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0xf0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x28, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x40, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x50, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x60, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x70, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x90, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0xa0, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xb0, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xc0, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0xd0, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xe0, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xf0, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x20, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x30, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x40, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x50, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x60, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x70, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x80, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x90, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xa0, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xb0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0xc0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xd0, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xe0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0xf0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x10, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x20, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x30, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x40, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x58, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x70, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x88, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0xa0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xb8, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0xd0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0xe8, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xf8, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x08, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x18, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x28, 0x2e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x38, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x48, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x58, 0x2e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x68, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x78, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x88, 0x2e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x98, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0xa8, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xb8, 0x2e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0xd4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf4, 0x2e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x34, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x44, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x54, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x64, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x74, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x94, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb4, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe4, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x34, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x4c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x64, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x7c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x94, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x64, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xac, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0xc8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0xf4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x3c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x58, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0xcc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0xe8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5f, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x95, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa6, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x60, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xb8, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xd2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x44, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x9c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0xb6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0xdc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf6, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xaa, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0xc4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x78, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x92, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x46, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x60, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xe2, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0xfc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x2e, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x47, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x60, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x79, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x97, 0x01, 0x9a, 0x01, 0x9f, 0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01,
+  0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa9, 0x01,
+  0xab, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01,
+  0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb9, 0x01,
+  0xba, 0x01, 0xbb, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0x9c, 0x01, 0xbe, 0x01,
+  0x9e, 0x01, 0x9b, 0x01, 0x9d, 0x01, 0xaa, 0x01, 0xb7, 0x01, 0xa8, 0x01,
+  0x98, 0x01, 0x99, 0x01, 0xbf, 0x01, 0xb8, 0x01, 0xb6, 0x01, 0x00, 0x69,
+  0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63,
+  0x6f, 0x70, 0x79, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70,
+  0x79, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72,
+  0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79,
+  0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x62, 0x6f, 0x64, 0x79, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75,
+  0x67, 0x5f, 0x61, 0x62, 0x62, 0x72, 0x65, 0x76, 0x00, 0x2e, 0x72, 0x65,
+  0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e,
+  0x42, 0x54, 0x46, 0x2e, 0x65, 0x78, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65, 0x67, 0x6d,
+  0x65, 0x6e, 0x74, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65, 0x67,
+  0x6d, 0x65, 0x6e, 0x74, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65,
+  0x74, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x73,
+  0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x65,
+  0x67, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+  0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00,
+  0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x72, 0x6e, 0x67, 0x6c, 0x69,
+  0x73, 0x74, 0x73, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x6c,
+  0x6f, 0x63, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x00, 0x65, 0x76, 0x65, 0x6e,
+  0x74, 0x73, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x68, 0x69, 0x74, 0x73,
+  0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f,
+  0x73, 0x74, 0x72, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x00,
+  0x63, 0x70, 0x75, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00, 0x2e, 0x6d,
+  0x61, 0x70, 0x73, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x00, 0x70, 0x61, 0x63, 0x6b,
+  0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x65, 0x73, 0x00, 0x66, 0x75,
+  0x6e, 0x63, 0x5f, 0x69, 0x64, 0x73, 0x00, 0x74, 0x72, 0x61, 0x63, 0x6b,
+  0x65, 0x64, 0x5f, 0x73, 0x6b, 0x62, 0x73, 0x00, 0x2e, 0x64, 0x65, 0x62,
+  0x75, 0x67, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75,
+  0x67, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x2e,
+  0x72, 0x65, 0x6c, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x61, 0x64,
+  0x64, 0x72, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x5f, 0x73,
+  0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x5f, 0x64, 0x72,
+  0x6f, 0x70, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x73, 0x6b, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73,
+  0x6f, 0x6e, 0x5f, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x2e, 0x72, 0x65, 0x6c,
+  0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b,
+  0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x5f,
+  0x64, 0x72, 0x6f, 0x70, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72,
+  0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72,
+  0x65, 0x61, 0x73, 0x6f, 0x6e, 0x5f, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x2e,
+  0x72, 0x65, 0x6c, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x69, 0x6e,
+  0x66, 0x6f, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x00, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x00, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65,
+  0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x6b, 0x66, 0x72,
+  0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f,
+  0x6e, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65,
+  0x61, 0x73, 0x6f, 0x6e, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65,
+  0x74, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x6b, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x00,
+  0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x6b,
+  0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x72, 0x65, 0x61,
+  0x73, 0x6f, 0x6e, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f,
+  0x73, 0x74, 0x61, 0x73, 0x68, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x73, 0x74,
+  0x61, 0x73, 0x68, 0x00, 0x73, 0x6b, 0x62, 0x5f, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x00, 0x2e, 0x6c, 0x6c, 0x76, 0x6d, 0x5f, 0x61, 0x64, 0x64, 0x72,
+  0x73, 0x69, 0x67, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x63, 0x6f, 0x6e,
+  0x66, 0x69, 0x67, 0x00, 0x2e, 0x72, 0x6f, 0x64, 0x61, 0x74, 0x61, 0x2e,
+  0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x00, 0x65, 0x76, 0x65, 0x6e, 0x74,
+  0x73, 0x5f, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x00, 0x6c, 0x69,
+  0x63, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x5f, 0x5f, 0x5f, 0x70, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70,
+  0x79, 0x5f, 0x66, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x5f, 0x5f,
+  0x70, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x63,
+  0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65,
+  0x74, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x5f, 0x5f, 0x70, 0x73, 0x6b,
+  0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x63, 0x6c, 0x6f, 0x6e,
+  0x65, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x2f, 0x5f, 0x5f, 0x70, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79,
+  0x5f, 0x66, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x69, 0x70, 0x66, 0x74,
+  0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e,
+  0x65, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x61,
+  0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65,
+  0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65,
+  0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f,
+  0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x00, 0x2e, 0x72,
+  0x65, 0x6c, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67,
+  0x5f, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x5f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x6c, 0x69, 0x6e, 0x65, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x5f,
+  0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x00,
+  0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x65,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70,
+  0x72, 0x6f, 0x62, 0x65, 0x2f, 0x73, 0x6b, 0x62, 0x5f, 0x63, 0x6f, 0x70,
+  0x79, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x6d, 0x75, 0x6c,
+  0x74, 0x69, 0x2e, 0x62, 0x70, 0x66, 0x2e, 0x63, 0x00, 0x69, 0x70, 0x66,
+  0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b,
+  0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x6e, 0x61, 0x70, 0x69, 0x5f,
+  0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x6e, 0x61,
+  0x70, 0x69, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73,
+  0x6b, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65, 0x74, 0x70,
+  0x72, 0x6f, 0x62, 0x65, 0x2f, 0x6e, 0x61, 0x70, 0x69, 0x5f, 0x63, 0x6f,
+  0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00, 0x2e, 0x72,
+  0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x6e, 0x61, 0x70,
+  0x69, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b,
+  0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00,
+  0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65, 0x74, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x2f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b,
+  0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x2f, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x73, 0x6b, 0x62,
+  0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65,
+  0x65, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62, 0x00,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x5f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x73, 0x6b, 0x62, 0x00, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x66, 0x72,
+  0x65, 0x65, 0x5f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73,
+  0x6b, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65, 0x74, 0x70,
+  0x72, 0x6f, 0x62, 0x65, 0x2f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65,
+  0x5f, 0x73, 0x6b, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72,
+  0x6f, 0x62, 0x65, 0x2f, 0x5f, 0x5f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x72, 0x65, 0x74,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x2f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f,
+  0x73, 0x6b, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f,
+  0x62, 0x65, 0x2f, 0x6b, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x6b, 0x62,
+  0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73, 0x79,
+  0x6d, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x42, 0x54,
+  0x46, 0x00, 0x4c, 0x49, 0x43, 0x45, 0x4e, 0x53, 0x45, 0x00, 0x4c, 0x42,
+  0x42, 0x32, 0x35, 0x5f, 0x39, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x5f, 0x39,
+  0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x34, 0x39, 0x00, 0x4c, 0x42,
+  0x42, 0x32, 0x35, 0x5f, 0x33, 0x39, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31,
+  0x5f, 0x31, 0x39, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x33, 0x5f, 0x38, 0x00,
+  0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x35, 0x38, 0x00, 0x4c, 0x42, 0x42,
+  0x32, 0x35, 0x5f, 0x33, 0x38, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f,
+  0x33, 0x38, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x31, 0x38, 0x00,
+  0x4c, 0x42, 0x42, 0x31, 0x38, 0x5f, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x31,
+  0x36, 0x5f, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x34, 0x5f, 0x37, 0x00,
+  0x4c, 0x42, 0x42, 0x32, 0x32, 0x5f, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x33,
+  0x31, 0x5f, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x31, 0x5f, 0x37, 0x00,
+  0x4c, 0x42, 0x42, 0x32, 0x30, 0x5f, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x33,
+  0x31, 0x5f, 0x36, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f, 0x36,
+  0x00, 0x4c, 0x42, 0x42, 0x31, 0x33, 0x5f, 0x36, 0x00, 0x4c, 0x42, 0x42,
+  0x33, 0x31, 0x5f, 0x36, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f, 0x34,
+  0x36, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x33, 0x36, 0x00, 0x4c,
+  0x42, 0x42, 0x32, 0x35, 0x5f, 0x32, 0x36, 0x00, 0x4c, 0x42, 0x42, 0x33,
+  0x31, 0x5f, 0x31, 0x36, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f, 0x35,
+  0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f, 0x34, 0x35, 0x00, 0x4c, 0x42,
+  0x42, 0x33, 0x31, 0x5f, 0x34, 0x35, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x35,
+  0x5f, 0x33, 0x35, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f, 0x32, 0x35,
+  0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x32, 0x35, 0x00, 0x4c, 0x42,
+  0x42, 0x32, 0x35, 0x5f, 0x31, 0x35, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x33,
+  0x5f, 0x31, 0x35, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x31, 0x35,
+  0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2e,
+  0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d,
+  0x61, 0x69, 0x6e, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x38, 0x5f, 0x34,
+  0x00, 0x4c, 0x42, 0x42, 0x31, 0x36, 0x5f, 0x34, 0x00, 0x4c, 0x42, 0x42,
+  0x31, 0x34, 0x5f, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x5f, 0x34, 0x00,
+  0x4c, 0x42, 0x42, 0x32, 0x32, 0x5f, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x31,
+  0x31, 0x5f, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x30, 0x5f, 0x34, 0x00,
+  0x4c, 0x42, 0x42, 0x32, 0x30, 0x5f, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x33,
+  0x31, 0x5f, 0x37, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x36,
+  0x34, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x35, 0x34, 0x00, 0x4c,
+  0x42, 0x42, 0x32, 0x35, 0x5f, 0x33, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x32,
+  0x35, 0x5f, 0x32, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x32,
+  0x34, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66, 0x74, 0x5f,
+  0x6d, 0x61, 0x69, 0x6e, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x39, 0x5f, 0x33,
+  0x00, 0x4c, 0x42, 0x42, 0x37, 0x5f, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x35,
+  0x5f, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x5f, 0x33, 0x00, 0x4c, 0x42,
+  0x42, 0x33, 0x31, 0x5f, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33,
+  0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f, 0x34, 0x33, 0x00, 0x4c, 0x42,
+  0x42, 0x32, 0x35, 0x5f, 0x33, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x33,
+  0x5f, 0x32, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x5f, 0x31, 0x33, 0x00,
+  0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x2e, 0x6d,
+  0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61,
+  0x69, 0x6e, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x39, 0x5f, 0x32, 0x00, 0x4c,
+  0x42, 0x42, 0x31, 0x38, 0x5f, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x37, 0x5f,
+  0x32, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x36, 0x5f, 0x32, 0x00, 0x4c, 0x42,
+  0x42, 0x35, 0x5f, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x34, 0x5f, 0x32,
+  0x00, 0x4c, 0x42, 0x42, 0x33, 0x5f, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x31,
+  0x33, 0x5f, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x32, 0x5f, 0x32, 0x00,
+  0x4c, 0x42, 0x42, 0x31, 0x31, 0x5f, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x30, 0x5f, 0x32, 0x00, 0x4c,
+  0x42, 0x42, 0x32, 0x30, 0x5f, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31,
+  0x5f, 0x36, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x33, 0x32,
+  0x00, 0x4c, 0x42, 0x42, 0x31, 0x33, 0x5f, 0x32, 0x32, 0x00, 0x4c, 0x42,
+  0x42, 0x33, 0x31, 0x5f, 0x32, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x38,
+  0x5f, 0x31, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x36, 0x5f, 0x31, 0x32,
+  0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f, 0x31, 0x32, 0x00, 0x4c, 0x42,
+  0x42, 0x31, 0x34, 0x5f, 0x31, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x32,
+  0x5f, 0x31, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x31, 0x32,
+  0x00, 0x4c, 0x42, 0x42, 0x31, 0x31, 0x5f, 0x31, 0x32, 0x00, 0x4c, 0x42,
+  0x42, 0x32, 0x30, 0x5f, 0x31, 0x32, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f,
+  0x69, 0x70, 0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x31, 0x00, 0x4c,
+  0x42, 0x42, 0x33, 0x31, 0x5f, 0x37, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x33,
+  0x31, 0x5f, 0x35, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x34,
+  0x31, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x33, 0x31, 0x00, 0x4c,
+  0x42, 0x42, 0x32, 0x35, 0x5f, 0x32, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x31,
+  0x33, 0x5f, 0x32, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x38, 0x5f, 0x31,
+  0x31, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x36, 0x5f, 0x31, 0x31, 0x00, 0x4c,
+  0x42, 0x42, 0x31, 0x34, 0x5f, 0x31, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x31,
+  0x33, 0x5f, 0x31, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x32, 0x5f, 0x31,
+  0x31, 0x00, 0x4c, 0x42, 0x42, 0x33, 0x31, 0x5f, 0x31, 0x31, 0x00, 0x4c,
+  0x42, 0x42, 0x31, 0x31, 0x5f, 0x31, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x32,
+  0x30, 0x5f, 0x31, 0x31, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x6b, 0x70, 0x72,
+  0x6f, 0x62, 0x65, 0x2e, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x2f, 0x69, 0x70,
+  0x66, 0x74, 0x5f, 0x6d, 0x61, 0x69, 0x6e, 0x30, 0x00, 0x4c, 0x42, 0x42,
+  0x33, 0x31, 0x5f, 0x36, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x35, 0x5f,
+  0x34, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x38, 0x5f, 0x31, 0x30, 0x00,
+  0x4c, 0x42, 0x42, 0x31, 0x36, 0x5f, 0x31, 0x30, 0x00, 0x4c, 0x42, 0x42,
+  0x32, 0x35, 0x5f, 0x31, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x31, 0x34, 0x5f,
+  0x31, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x5f, 0x31, 0x30, 0x00, 0x4c,
+  0x42, 0x42, 0x32, 0x32, 0x5f, 0x31, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x31,
+  0x31, 0x5f, 0x31, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x32, 0x30, 0x5f, 0x31,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x89, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb8, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x24, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3b, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x58, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x28, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd0, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd8, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb3, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x03, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x29, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd4, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x04, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb2, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb8, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x29, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x06, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8a, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x98, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x58, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x06, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x29, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xee, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x70, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd8, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcb, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2a, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x58, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb2, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x05, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x2a, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x05, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5d, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x06, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x2a, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x45, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x41, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x0a, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x33, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcd, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x09, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x2b, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe2, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xde, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x33, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x74, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe7, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x07, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x2b, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x68, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x58, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x36, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa3, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa1, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x2b, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdd, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x81, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x2b, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x96, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x4a, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb3, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xcc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x64, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x81, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x54, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb8, 0x85, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x11, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x03, 0x00, 0x00, 0x03, 0x4c, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb8, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa7, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+unsigned int ipft_kprobe_multi_null_bpf_o_len = 108776;
@@ -71,6 +71,44 @@ output_on_trace(struct ipft_output *out, struct ipft_event *e)
   return out->on_event(out, e);
 }
 
+/*
+ * Outputs which don't know about the consolidated packet trace see
+ * it as a series of events.
+ */
+int
+output_on_packet(struct ipft_output *out, struct ipft_event *events,
+                 uint32_t count, uint32_t ntruncated, bool dropped)
+{
+  int error;
+
+  if (out->on_packet != NULL) {
+    return out->on_packet(out, events, count, ntruncated, dropped);
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    error = out->on_event(out, events + i);
+    if (error == -1) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * The lineage is only shown by the outputs knowing about it
+ */
+int
+output_on_lineage(struct ipft_output *out, struct ipft_event *e,
+                  uint64_t parent_id)
+{
+  if (out->on_lineage == NULL) {
+    return 0;
+  }
+
+  return out->on_lineage(out, e, parent_id);
+}
+
 int
 output_post_trace(struct ipft_output *out)
 {
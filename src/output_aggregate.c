@@ -2,9 +2,12 @@
 #include <stdlib.h>
 #include <stdlib.h>
 #include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
 
 #include "khash.h"
 #include "klist.h"
+#include "kvec.h"
 
 #include "ipft.h"
 
@@ -20,13 +23,231 @@ dtor(void *p)
 
 KLIST_INIT(trace_list, struct ipft_event *, dtor)
 KHASH_MAP_INIT_INT64(trace, klist_t(trace_list) *)
+KHASH_MAP_INIT_INT64(lineage, size_t)
+KHASH_SET_INIT_INT64(roots)
+
+/*
+ * Max depth of the lineage tree. The skb address is reused after the
+ * free, so the links may form a cycle.
+ */
+#define MAX_LINEAGE_DEPTH 16
+
+/*
+ * Range of the sequence numbers we didn't receive
+ */
+struct seq_gap {
+  uint64_t first;
+  uint64_t last;
+};
+
+struct cpu_seq {
+  uint64_t last_seq;
+  kvec_t(struct seq_gap) gaps;
+};
+
+/*
+ * Packet trace consolidated in the kernel. Events are already ordered.
+ */
+struct packet_trace {
+  struct ipft_event *events;
+  uint32_t count;
+  uint32_t ntruncated;
+  bool dropped;
+};
+
+/*
+ * skb created from another skb
+ */
+struct lineage_link {
+  uint64_t child;
+  uint64_t parent;
+  uint64_t tstamp;
+  uint32_t func_id;
+};
 
 struct aggregate_output {
   struct ipft_output base;
   khash_t(trace) * trace;
+  kvec_t(struct packet_trace) packets;
+  kvec_t(struct lineage_link) links;
+  /* Index of the link by the child */
+  khash_t(lineage) * lineage;
   size_t ntraces;
+  struct cpu_seq *cpus;
+  uint32_t ncpus;
+  /* Protects the members above from the concurrent consumers */
+  pthread_mutex_t mutex;
 };
 
+/*
+ * The gaps are sorted and disjoint, since they are appended in the
+ * order of the sequence numbers and only shrink or split after that.
+ * Returns the index of the first gap which ends at or after seq.
+ */
+static size_t
+find_gap(struct cpu_seq *c, uint64_t seq)
+{
+  size_t mid, left = 0, right = kv_size(c->gaps);
+
+  while (left < right) {
+    mid = left + (right - left) / 2;
+    if (kv_A(c->gaps, mid).last < seq) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+
+  return left;
+}
+
+static int
+remove_seq_from_gaps(struct cpu_seq *c, uint64_t seq)
+{
+  struct seq_gap *g;
+  size_t i = find_gap(c, seq);
+
+  if (i == kv_size(c->gaps) || seq < kv_A(c->gaps, i).first) {
+    return 0;
+  }
+
+  g = &kv_A(c->gaps, i);
+
+  if (g->first == g->last) {
+    memmove(g, g + 1, (kv_size(c->gaps) - i - 1) * sizeof(*g));
+    c->gaps.n--;
+  } else if (seq == g->first) {
+    g->first++;
+  } else if (seq == g->last) {
+    g->last--;
+  } else {
+    struct seq_gap upper = {.first = seq + 1, .last = g->last};
+    g->last = seq - 1;
+    kv_push(struct seq_gap, c->gaps, upper);
+    g = &kv_A(c->gaps, i);
+    memmove(g + 2, g + 1, (kv_size(c->gaps) - i - 2) * sizeof(*g));
+    g[1] = upper;
+  }
+
+  return 0;
+}
+
+/*
+ * Records the discontinuity of the per-CPU sequence numbers
+ */
+static int
+track_seq(struct aggregate_output *out, struct ipft_event *e)
+{
+  struct cpu_seq *c;
+
+  if (e->processor_id >= out->ncpus) {
+    uint32_t ncpus = e->processor_id + 1;
+
+    c = realloc(out->cpus, ncpus * sizeof(*c));
+    if (c == NULL) {
+      ERROR("realloc failed\n");
+      return -1;
+    }
+
+    memset(c + out->ncpus, 0, (ncpus - out->ncpus) * sizeof(*c));
+
+    out->cpus = c;
+    out->ncpus = ncpus;
+  }
+
+  c = out->cpus + e->processor_id;
+
+  if (e->seq <= c->last_seq) {
+    return remove_seq_from_gaps(c, e->seq);
+  }
+
+  if (e->seq > c->last_seq + 1) {
+    struct seq_gap gap = {.first = c->last_seq + 1, .last = e->seq - 1};
+    kv_push(struct seq_gap, c->gaps, gap);
+  }
+
+  c->last_seq = e->seq;
+
+  return 0;
+}
+
+/*
+ * Whether any sequence number between two events on the same CPU is
+ * missing. In that case, we might lose the events for this packet.
+ */
+static bool
+has_gap_between(struct aggregate_output *out, uint32_t cpu, uint64_t lo,
+                uint64_t hi)
+{
+  size_t i;
+  struct cpu_seq *c = out->cpus + cpu;
+
+  if (hi - lo < 2) {
+    return false;
+  }
+
+  /* The first gap which ends after lo */
+  i = find_gap(c, lo + 1);
+
+  return i < kv_size(c->gaps) && kv_A(c->gaps, i).first < hi;
+}
+
+static int
+compare_cpu_seq(const void *_e1, const void *_e2)
+{
+  const struct ipft_event *e1 = *(struct ipft_event **)_e1;
+  const struct ipft_event *e2 = *(struct ipft_event **)_e2;
+
+  if (e1->processor_id != e2->processor_id) {
+    return e1->processor_id < e2->processor_id ? -1 : 1;
+  }
+
+  if (e1->seq != e2->seq) {
+    return e1->seq < e2->seq ? -1 : 1;
+  }
+
+  return 0;
+}
+
+/*
+ * Only the consecutive events of the trace on the same CPU need to be
+ * checked. Sort them by the CPU and the sequence number, so each pair
+ * is a single binary search over the gaps. Returns -1 on error.
+ */
+static int
+trace_has_gap(struct aggregate_output *out, struct ipft_event **earray,
+              uint32_t count)
+{
+  int ret = 0;
+  struct ipft_event **sorted;
+
+  if (count < 2) {
+    return 0;
+  }
+
+  sorted = malloc(count * sizeof(*sorted));
+  if (sorted == NULL) {
+    ERROR("malloc failed\n");
+    return -1;
+  }
+
+  memcpy(sorted, earray, count * sizeof(*sorted));
+  qsort(sorted, count, sizeof(*sorted), compare_cpu_seq);
+
+  for (uint32_t i = 1; i < count; i++) {
+    if (sorted[i - 1]->processor_id == sorted[i]->processor_id &&
+        has_gap_between(out, sorted[i]->processor_id, sorted[i - 1]->seq,
+                        sorted[i]->seq)) {
+      ret = 1;
+      break;
+    }
+  }
+
+  free(sorted);
+
+  return ret;
+}
+
 static int
 aggregate_output_on_event(struct ipft_output *_out, struct ipft_event *_e)
 {
@@ -36,19 +257,21 @@ aggregate_output_on_event(struct ipft_output *_out, struct ipft_event *_e)
   klist_t(trace_list) * l;
   struct aggregate_output *out = (struct aggregate_output *)_out;
 
-  e = malloc(sizeof(*e));
+  e = malloc(sizeof(*e) + _e->data_len);
   if (e == NULL) {
     ERROR("malloc failed\n");
     return -1;
   }
 
-  memcpy(e, _e, sizeof(*e));
+  memcpy(e, _e, sizeof(*e) + _e->data_len);
+
+  pthread_mutex_lock(&out->mutex);
 
   /* Put trace to trace store */
   iter = kh_put(trace, out->trace, e->packet_id, &ret);
   if (ret == -1) {
     ERROR("Failed to put trace to store\n");
-    return -1;
+    goto err0;
   } else if (ret == 0) {
     l = kh_value(out->trace, iter);
     *kl_pushp(trace_list, l) = e;
@@ -56,19 +279,103 @@ aggregate_output_on_event(struct ipft_output *_out, struct ipft_event *_e)
     l = kl_init(trace_list);
     if (l == NULL) {
       ERROR("kl_init failed\n");
-      return -1;
+      goto err0;
     }
     *kl_pushp(trace_list, l) = e;
     kh_value(out->trace, iter) = l;
   }
 
+  if (track_seq(out, e) == -1) {
+    ERROR("track_seq failed\n");
+    goto err1;
+  }
+
   /* Update the status on screen */
   INFO("\rGot %zu traces", out->ntraces++);
   fflush(stderr);
 
+  pthread_mutex_unlock(&out->mutex);
+
+  return 0;
+
+err1:
+  pthread_mutex_unlock(&out->mutex);
+  return -1;
+err0:
+  pthread_mutex_unlock(&out->mutex);
+  free(e);
+  return -1;
+}
+
+static int
+aggregate_output_on_packet(struct ipft_output *_out, struct ipft_event *events,
+                           uint32_t count, uint32_t ntruncated, bool dropped)
+{
+  struct packet_trace p;
+  struct aggregate_output *out = (struct aggregate_output *)_out;
+
+  p.events = malloc(count * sizeof(*events));
+  if (p.events == NULL) {
+    ERROR("malloc failed\n");
+    return -1;
+  }
+
+  memcpy(p.events, events, count * sizeof(*events));
+  p.count = count;
+  p.ntruncated = ntruncated;
+  p.dropped = dropped;
+
+  pthread_mutex_lock(&out->mutex);
+
+  kv_push(struct packet_trace, out->packets, p);
+
+  out->ntraces += count;
+
+  /* Update the status on screen */
+  INFO("\rGot %zu traces", out->ntraces);
+  fflush(stderr);
+
+  pthread_mutex_unlock(&out->mutex);
+
   return 0;
 }
 
+static int
+aggregate_output_on_lineage(struct ipft_output *_out, struct ipft_event *e,
+                            uint64_t parent_id)
+{
+  int ret;
+  khint_t iter;
+  struct aggregate_output *out = (struct aggregate_output *)_out;
+  struct lineage_link link = {
+      .child = e->packet_id,
+      .parent = parent_id,
+      .tstamp = e->tstamp,
+      .func_id = e->func_id,
+  };
+
+  pthread_mutex_lock(&out->mutex);
+
+  kv_push(struct lineage_link, out->links, link);
+
+  /* The latest one wins when the address is reused */
+  iter = kh_put(lineage, out->lineage, link.child, &ret);
+  if (ret == -1) {
+    ERROR("kh_put failed\n");
+    pthread_mutex_unlock(&out->mutex);
+    return -1;
+  }
+
+  kh_value(out->lineage, iter) = kv_size(out->links) - 1;
+
+  /* The lineage event consumes the sequence number as well */
+  ret = track_seq(out, e);
+
+  pthread_mutex_unlock(&out->mutex);
+
+  return ret;
+}
+
 static int
 compare_tstamp(const void *_e1, const void *_e2)
 {
@@ -101,14 +408,14 @@ dump_function(struct aggregate_output *out, struct ipft_event **earray,
 
     /* Actually, this won't fail. When name resolution fails, symbol name
      * (unknown) will be returned. */
-    symsdb_get_symname_by_addr(out->base.sdb, e->faddr, &symname);
+    symsdb_get_symname_by_id(out->base.sdb, e->func_id, &symname);
 
     if (out->base.script != NULL) {
       /* Print basic data */
       printf("%-20zu %03u %32.32s ( ", e->tstamp, e->processor_id, symname);
 
       /* Execute script and print results */
-      error = script_exec_decode(out->base.script, e->data, sizeof(e->data),
+      error = script_exec_decode(out->base.script, e->data, e->data_len,
                                  print_script_output);
       if (error == -1) {
         return -1;
@@ -135,14 +442,14 @@ dump_function_graph(struct aggregate_output *out, struct ipft_event **earray,
   for (uint32_t i = 0; i < count; i++) {
     e = earray[i];
 
-    error = symsdb_get_symname_by_addr(out->base.sdb, e->faddr, &symname);
+    error = symsdb_get_symname_by_id(out->base.sdb, e->func_id, &symname);
     if (error == -1) {
       ERROR("Failed to resolve the symbol from address\n");
       return -1;
     }
 
     char s[64] = {0};
-    if (!e->is_return) {
+    if (e->type == IPFT_EVENT_ENTRY) {
       sprintf(s, "%-*s%s() {", indent * 2, "", symname);
 
       if (out->base.script != NULL) {
@@ -150,7 +457,7 @@ dump_function_graph(struct aggregate_output *out, struct ipft_event **earray,
         printf("%-20zu %03u %-64.64s ( ", e->tstamp, e->processor_id, s);
 
         /* Execute script and print results */
-        error = script_exec_decode(out->base.script, e->data, sizeof(e->data),
+        error = script_exec_decode(out->base.script, e->data, e->data_len,
                                    print_script_output);
         if (error == -1) {
           return -1;
@@ -184,7 +491,7 @@ dump_function_graph(struct aggregate_output *out, struct ipft_event **earray,
         printf("%-20zu %03u %-64.64s ( ", e->tstamp, e->processor_id, s);
 
         /* Execute script and print results */
-        error = script_exec_decode(out->base.script, e->data, sizeof(e->data),
+        error = script_exec_decode(out->base.script, e->data, e->data_len,
                                    print_script_output);
         if (error == -1) {
           return -1;
@@ -201,62 +508,299 @@ dump_function_graph(struct aggregate_output *out, struct ipft_event **earray,
 }
 
 static int
-aggregate_output_post_trace(struct ipft_output *_out)
+dump_trace(struct aggregate_output *out, struct ipft_event **earray,
+           uint32_t count)
+{
+  int error;
+
+  if (out->base.tracer == IPFT_TRACER_FUNCTION) {
+    error = dump_function(out, earray, count);
+    if (error != 0) {
+      ERROR("dump_function failed\n");
+      return -1;
+    }
+  } else if (out->base.tracer == IPFT_TRACER_FUNCTION_GRAPH) {
+    error = dump_function_graph(out, earray, count);
+    if (error != 0) {
+      ERROR("dump_function_graph failed\n");
+      return -1;
+    }
+  } else {
+    ERROR("Unexpected tracer ID %d\n", out->base.tracer);
+    return -1;
+  }
+
+  return 0;
+}
+
+static int
+dump_packets(struct aggregate_output *out)
+{
+  int error;
+  struct packet_trace *p;
+  struct ipft_event **earray;
+
+  for (size_t i = 0; i < kv_size(out->packets); i++) {
+    p = &kv_A(out->packets, i);
+
+    earray = calloc(p->count, sizeof(*earray));
+    if (earray == NULL) {
+      perror("calloc");
+      return -1;
+    }
+
+    for (uint32_t j = 0; j < p->count; j++) {
+      earray[j] = p->events + j;
+    }
+
+    printf("===%s", p->dropped ? " (dropped)" : "");
+    if (p->ntruncated != 0) {
+      printf(" (truncated: %u calls not recorded)", p->ntruncated);
+    }
+    printf("\n");
+
+    error = dump_trace(out, earray, p->count);
+    free(earray);
+    if (error == -1) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+static int
+compare_link(const void *_l1, const void *_l2)
+{
+  const struct lineage_link *l1 = (const struct lineage_link *)_l1;
+  const struct lineage_link *l2 = (const struct lineage_link *)_l2;
+
+  if (l1->parent != l2->parent) {
+    return l1->parent < l2->parent ? -1 : 1;
+  }
+
+  if (l1->tstamp != l2->tstamp) {
+    return l1->tstamp < l2->tstamp ? -1 : 1;
+  }
+
+  return 0;
+}
+
+/*
+ * Print the trace of the packet under the header line. The header
+ * of the packet created from another one has the prefix telling it.
+ */
+static int
+dump_packet_trace(struct aggregate_output *out, uint64_t packet_id,
+                  const char *prefix)
 {
   int error;
+  khint_t k;
+  uint32_t count = 0;
   klist_t(trace_list) * l;
   kliter_t(trace_list) * iter;
   struct ipft_event **earray;
-  struct aggregate_output *out = (struct aggregate_output *)_out;
 
-  printf("\n");
+  k = kh_get(trace, out->trace, packet_id);
+  if (k == kh_end(out->trace)) {
+    printf("===%s\n", prefix);
+    return 0;
+  }
 
-  printf("%-20s %3.3s %32.32s\n", "Timestamp", "CPU", "Function");
-  kh_foreach_value(
-      out->trace, l, printf("===\n");
+  l = kh_value(out->trace, k);
 
-      /*
-       * We need to put trace data to array just to use qsort(3)
-       * this is not so efficient way, but works well.
-       */
-      earray = calloc(l->size, sizeof(*earray));
-      if (earray == NULL) {
-        perror("calloc");
-        return -1;
-      }
+  /*
+   * We need to put trace data to array just to use qsort(3)
+   * this is not so efficient way, but works well.
+   */
+  earray = calloc(l->size, sizeof(*earray));
+  if (earray == NULL) {
+    perror("calloc");
+    return -1;
+  }
 
-      uint32_t count = 0;
-      for (iter = kl_begin(l); iter != kl_end(l); iter = kl_next(iter)) {
-        earray[count] = kl_val(iter);
-        count++;
-      }
+  for (iter = kl_begin(l); iter != kl_end(l); iter = kl_next(iter)) {
+    earray[count] = kl_val(iter);
+    count++;
+  }
 
-      /*
-       * Order trace by timestamp. They are not always orderd since they
-       * can be collected with different perf ring.
-       */
-      qsort(earray, count, sizeof(*earray), compare_tstamp);
+  /*
+   * Order trace by timestamp. They are not always orderd since they
+   * can be collected with different perf ring.
+   */
+  qsort(earray, count, sizeof(*earray), compare_tstamp);
 
-      if (out->base.tracer == IPFT_TRACER_FUNCTION) {
-        error = dump_function(out, earray, count);
-        if (error != 0) {
-          ERROR("dump_function failed\n");
-          return -1;
-        }
-      } else if (out->base.tracer == IPFT_TRACER_FUNCTION_GRAPH) {
-        error = dump_function_graph(out, earray, count);
-        if (error != 0) {
-          ERROR("dump_function_graph failed\n");
-          return -1;
-        }
-      } else {
-        ERROR("Unexpected tracer ID %d\n", out->base.tracer);
-        return -1;
-      }
+  error = trace_has_gap(out, earray, count);
+  if (error == -1) {
+    free(earray);
+    return -1;
+  }
+
+  if (error == 1) {
+    printf("===%s (incomplete: lost events detected)\n", prefix);
+  } else {
+    printf("===%s\n", prefix);
+  }
+
+  error = dump_trace(out, earray, count);
+
+  free(earray);
+
+  return error;
+}
+
+/*
+ * Follow the links up to the original packet
+ */
+static uint64_t
+find_lineage_root(struct aggregate_output *out, uint64_t packet_id)
+{
+  khint_t k;
+
+  for (int i = 0; i < MAX_LINEAGE_DEPTH; i++) {
+    k = kh_get(lineage, out->lineage, packet_id);
+    if (k == kh_end(out->lineage)) {
+      break;
+    }
+    packet_id = kv_A(out->links, kh_value(out->lineage, k)).parent;
+  }
+
+  return packet_id;
+}
+
+/*
+ * Print the packets created from the parent in the order of creation.
+ * The links are sorted by the parent.
+ */
+static int
+dump_lineage(struct aggregate_output *out, uint64_t parent, int depth)
+{
+  int error;
+  char *symname;
+  char prefix[128];
+  struct lineage_link *link;
+  size_t mid, left = 0, right = kv_size(out->links);
+
+  if (depth == MAX_LINEAGE_DEPTH) {
+    return 0;
+  }
+
+  /* Find the first link of the parent */
+  while (left < right) {
+    mid = left + (right - left) / 2;
+    if (kv_A(out->links, mid).parent < parent) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+
+  for (size_t i = left; i < kv_size(out->links); i++) {
+    link = &kv_A(out->links, i);
+    if (link->parent != parent) {
+      break;
+    }
+
+    symsdb_get_symname_by_id(out->base.sdb, link->func_id, &symname);
+
+    snprintf(prefix, sizeof(prefix), " %*s%s(%#" PRIx64 ") -> %#" PRIx64,
+             depth * 2, "", symname, link->parent, link->child);
+
+    error = dump_packet_trace(out, link->child, prefix);
+    if (error == -1) {
+      return -1;
+    }
+
+    error = dump_lineage(out, link->child, depth + 1);
+    if (error == -1) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * Each trace is printed in the tree of the original packet. Without
+ * the lineage, every packet is the root of its own tree.
+ */
+static int
+dump_traces(struct aggregate_output *out)
+{
+  int error, ret;
+  khint_t iter;
+  uint64_t root;
+  khash_t(roots) * roots;
+
+  qsort(out->links.a, kv_size(out->links), sizeof(struct lineage_link),
+        compare_link);
+
+  /* Sorting invalidates the index */
+  kh_clear(lineage, out->lineage);
+  for (size_t i = 0; i < kv_size(out->links); i++) {
+    iter = kh_put(lineage, out->lineage, kv_A(out->links, i).child, &ret);
+    if (ret == -1) {
+      ERROR("kh_put failed\n");
+      return -1;
+    }
+    kh_value(out->lineage, iter) = i;
+  }
+
+  roots = kh_init(roots);
+  if (roots == NULL) {
+    ERROR("kh_init failed\n");
+    return -1;
+  }
+
+  error = 0;
+  for (iter = kh_begin(out->trace); iter != kh_end(out->trace); iter++) {
+    if (!kh_exist(out->trace, iter)) {
+      continue;
+    }
+
+    root = find_lineage_root(out, kh_key(out->trace, iter));
+
+    kh_put(roots, roots, root, &ret);
+    if (ret == -1) {
+      ERROR("kh_put failed\n");
+      error = -1;
+      break;
+    } else if (ret == 0) {
+      continue;
+    }
+
+    error = dump_packet_trace(out, root, "");
+    if (error == -1) {
+      break;
+    }
+
+    error = dump_lineage(out, root, 0);
+    if (error == -1) {
+      break;
+    }
+  }
 
-      free(earray);)
+  kh_destroy(roots, roots);
 
-      return 0;
+  return error;
+}
+
+static int
+aggregate_output_post_trace(struct ipft_output *_out)
+{
+  int error;
+  struct aggregate_output *out = (struct aggregate_output *)_out;
+
+  printf("\n");
+
+  printf("%-20s %3.3s %32.32s\n", "Timestamp", "CPU", "Function");
+
+  error = dump_traces(out);
+  if (error == -1) {
+    return -1;
+  }
+
+  return dump_packets(out);
 }
 
 int
@@ -276,8 +820,21 @@ aggregate_output_create(struct ipft_output **outp)
     return -1;
   }
 
+  out->lineage = kh_init(lineage);
+  if (out->lineage == NULL) {
+    ERROR("kh_init failed\n");
+    return -1;
+  }
+
+  kv_init(out->packets);
+  kv_init(out->links);
   out->ntraces = 0;
+  out->cpus = NULL;
+  out->ncpus = 0;
+  pthread_mutex_init(&out->mutex, NULL);
   out->base.on_event = aggregate_output_on_event;
+  out->base.on_packet = aggregate_output_on_packet;
+  out->base.on_lineage = aggregate_output_on_lineage;
   out->base.post_trace = aggregate_output_post_trace;
 
   *outp = (struct ipft_output *)out;
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 #include "ipft.h"
 
@@ -9,6 +10,8 @@
 
 struct json_output {
   struct ipft_output base;
+  /* Serializes the Lua script execution among the concurrent consumers */
+  pthread_mutex_t mutex;
 };
 
 static int
@@ -23,29 +26,106 @@ json_output_on_event(struct ipft_output *_out, struct ipft_event *e)
 {
   int error;
   char *symname;
+  char line[512];
   struct json_output *out = (struct json_output *)_out;
 
   /* Actually, this won't fail. When name resolution fails, symbol name
    * (unknown) will be returned. */
-  symsdb_get_symname_by_addr(out->base.sdb, e->faddr, &symname);
+  symsdb_get_symname_by_id(out->base.sdb, e->func_id, &symname);
+
+  snprintf(line, sizeof(line),
+           "{\"packet_id\":\"%p\",\"timestamp\":%zu,\"processor_id\":%u,"
+           "\"seq\":%zu,\"function\":\"%s\",\"is_return\":%s",
+           (void *)e->packet_id, e->tstamp, e->processor_id, e->seq, symname,
+           e->type == IPFT_EVENT_RETURN ? "true" : "false");
+
+  /*
+   * Without script, the line is written with a single stdio call which
+   * is atomic among the threads, so we don't need to take a lock.
+   */
+  if (out->base.script == NULL) {
+    printf("%s}\n", line);
+    fflush(stdout);
+    return 0;
+  }
 
-  printf("{\"packet_id\":\"%p\",\"timestamp\":%zu,\"processor_id\":%u,"
-         "\"function\":\"%s\",\"is_return\":%s",
-         (void *)e->packet_id, e->tstamp, e->processor_id, symname,
-         e->is_return ? "true" : "false");
-
-  if (out->base.script) {
-    error = script_exec_decode(out->base.script, e->data, sizeof(e->data),
-                               print_script_output);
-    if (error == -1) {
-      return -1;
-    }
+  pthread_mutex_lock(&out->mutex);
+
+  printf("%s", line);
+
+  error = script_exec_decode(out->base.script, e->data, e->data_len,
+                             print_script_output);
+  if (error == -1) {
+    pthread_mutex_unlock(&out->mutex);
+    return -1;
   }
 
   printf("}\n");
 
   fflush(stdout);
 
+  pthread_mutex_unlock(&out->mutex);
+
+  return 0;
+}
+
+/*
+ * The line of the new skb tells where it came from
+ */
+static int
+json_output_on_lineage(struct ipft_output *_out, struct ipft_event *e,
+                       uint64_t parent_id)
+{
+  char *symname;
+  struct json_output *out = (struct json_output *)_out;
+
+  symsdb_get_symname_by_id(out->base.sdb, e->func_id, &symname);
+
+  printf("{\"packet_id\":\"%p\",\"timestamp\":%zu,\"processor_id\":%u,"
+         "\"seq\":%zu,\"function\":\"%s\",\"parent_id\":\"%p\"}\n",
+         (void *)e->packet_id, e->tstamp, e->processor_id, e->seq, symname,
+         (void *)parent_id);
+  fflush(stdout);
+
+  return 0;
+}
+
+/*
+ * The consolidated trace is a line on its own, so the consumer knows
+ * where the packet ends
+ */
+static int
+json_output_on_packet(struct ipft_output *_out, struct ipft_event *events,
+                      uint32_t count, uint32_t ntruncated, bool dropped)
+{
+  char *symname;
+  struct ipft_event *e;
+  struct json_output *out = (struct json_output *)_out;
+
+  pthread_mutex_lock(&out->mutex);
+
+  printf("{\"packet_id\":\"%p\",\"dropped\":%s,\"ntruncated\":%u,"
+         "\"events\":[",
+         count > 0 ? (void *)events[0].packet_id : NULL,
+         dropped ? "true" : "false", ntruncated);
+
+  for (uint32_t i = 0; i < count; i++) {
+    e = events + i;
+
+    symsdb_get_symname_by_id(out->base.sdb, e->func_id, &symname);
+
+    printf("%s{\"timestamp\":%zu,\"processor_id\":%u,\"function\":\"%s\","
+           "\"is_return\":%s}",
+           i == 0 ? "" : ",", e->tstamp, e->processor_id, symname,
+           e->type == IPFT_EVENT_RETURN ? "true" : "false");
+  }
+
+  printf("]}\n");
+
+  fflush(stdout);
+
+  pthread_mutex_unlock(&out->mutex);
+
   return 0;
 }
 
@@ -66,7 +146,10 @@ json_output_create(struct ipft_output **outp)
     return -1;
   }
 
+  pthread_mutex_init(&out->mutex, NULL);
   out->base.on_event = json_output_on_event;
+  out->base.on_packet = json_output_on_packet;
+  out->base.on_lineage = json_output_on_lineage;
   out->base.post_trace = json_output_post_trace;
 
   *outp = (struct ipft_output *)out;
@@ -1,3 +1,4 @@
+#define _GNU_SOURCE
 #include <ctype.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -8,10 +9,12 @@
 #include <fcntl.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <sys/utsname.h>
 #include <unistd.h>
 #include <errno.h>
 #include <fts.h>
+#include <pthread.h>
 
 #include <bpf/bpf.h>
 #include <bpf/btf.h>
@@ -21,42 +24,75 @@
 #include "khash.h"
 #include "kvec.h"
 
-KHASH_MAP_INIT_INT64(addr2symname, char *)
-KHASH_MAP_INIT_STR(symname2addr, uint64_t)
 KHASH_MAP_INIT_STR(availfuncs, int)
 KHASH_SET_INIT_STR(funcsseen)
 
+/*
+ * Entry of available_filter_functions_addrs. The name points to the
+ * availbuf.
+ */
+struct avail_func {
+  uint64_t addr;
+  const char *name;
+};
+
+/*
+ * Function taking skb. Refers to the function table by index.
+ */
+struct symsdb_sym {
+  /* Only valid while building. Resolved to the func later. */
+  const char *symname;
+  uint32_t func;
+  uint32_t btf_id;
+  /* ID of the BTF object. 0 for vmlinux. */
+  uint32_t btf_obj_id;
+  int btf_fd;
+};
+
+/*
+ * The function table is a structure of arrays. The names are stored
+ * in a single string arena and referred by the offset, so there is no
+ * per-symbol allocation. The tables are built once at startup or
+ * used in place from the mapped cache.
+ */
 struct ipft_symsdb {
   struct ipft_symsdb_opt *opt;
+  /* Only used while building */
   khash_t(funcsseen) * funcsseen;
   khash_t(availfuncs) * availfuncs;
-  kvec_t(struct ipft_sym *) * pos2syms;
-  khash_t(addr2symname) * addr2symname;
-  khash_t(symname2addr) * symname2addr;
+  kvec_t(struct symsdb_sym) * pos2recs;
+  /* Content of available_filter_functions. Keys of the availfuncs. */
+  char *availbuf;
+  size_t availbuf_len;
+  /* Parsed available_filter_functions_addrs if the kernel has it */
+  bool has_addrs;
+  kvec_t(struct avail_func) availaddrs;
+  /* Parsed BTFs. The names found in the scan point to them. */
+  kvec_t(struct btf *) btfs;
+  /* String arena */
+  const char *strtab;
+  uint32_t strtab_size;
+  /* Functions taking skb sorted by address */
+  uint32_t nfuncs;
+  const uint64_t *addrs;
+  const uint32_t *name_offs;
+  /* Indices of the above sorted by name */
+  const uint32_t *by_name;
+  /* Functions taking skb per position */
+  struct ipft_sym **pos2syms;
+  uint32_t *pos2nsyms;
 };
 
-static int
-pos2syms_append(struct ipft_symsdb *sdb, int pos, struct ipft_sym *sym)
+static const char *
+func_name(struct ipft_symsdb *sdb, uint32_t func)
 {
-  struct ipft_sym *v;
-
-  v = malloc(sizeof(*v));
-  if (v == NULL) {
-    ERROR("malloc failed\n");
-    return -1;
-  }
-
-  memcpy(v, sym, sizeof(*sym));
-
-  kv_push(struct ipft_sym *, sdb->pos2syms[pos], v);
-
-  return 0;
+  return sdb->strtab + sdb->name_offs[func];
 }
 
-struct ipft_sym **
+struct ipft_sym *
 symsdb_get_syms_by_pos(struct ipft_symsdb *sdb, int pos)
 {
-  return sdb->pos2syms[pos].a;
+  return sdb->pos2syms[pos];
 }
 
 int
@@ -64,7 +100,7 @@ symsdb_get_syms_total(struct ipft_symsdb *sdb)
 {
   int ret = 0;
   for (int i = 0; i < sdb->opt->max_skb_pos; i++) {
-    ret += kv_size(sdb->pos2syms[i]);
+    ret += sdb->pos2nsyms[i];
   }
   return ret;
 }
@@ -72,120 +108,81 @@ symsdb_get_syms_total(struct ipft_symsdb *sdb)
 int
 symsdb_get_syms_total_by_pos(struct ipft_symsdb *sdb, int pos)
 {
-  return kv_size(sdb->pos2syms[pos]);
+  return sdb->pos2nsyms[pos];
 }
 
-static int
-put_addr2symname(struct ipft_symsdb *sdb, uint64_t addr, char *symname)
+uint32_t
+symsdb_get_funcs_total(struct ipft_symsdb *sdb)
 {
-  char *v;
-  int missing;
-  khint_t iter;
-  khash_t(addr2symname) * db;
-
-  v = strdup(symname);
-  if (v == NULL) {
-    return -1;
-  }
-
-  db = ((struct ipft_symsdb *)sdb)->addr2symname;
-
-  iter = kh_put(addr2symname, db, addr, &missing);
-  if (!missing) {
-    return -1;
-  }
-
-  kh_value(db, iter) = v;
-
-  return 0;
+  return sdb->nfuncs;
 }
 
+/*
+ * The function id is the index of the function table, so this is just
+ * an array access
+ */
 int
-symsdb_get_symname_by_addr(struct ipft_symsdb *sdb, uint64_t addr,
-                           char **symnamep)
+symsdb_get_symname_by_id(struct ipft_symsdb *sdb, uint32_t id,
+                         char **symnamep)
 {
-  khint_t iter;
-  khash_t(addr2symname) * db;
-
-  db = ((struct ipft_symsdb *)sdb)->addr2symname;
-
-  iter = kh_get(addr2symname, db, addr);
-  if (iter == kh_end(db)) {
+  if (id >= sdb->nfuncs) {
     *symnamep = "(unknown)";
     return -1;
   }
 
-  *symnamep = kh_value(db, iter);
+  *symnamep = (char *)func_name(sdb, id);
 
   return 0;
 }
 
+/*
+ * When multiple functions have the same name (e.g. static functions),
+ * the one with the highest address wins as the last one in the
+ * kallsyms did before.
+ */
 static int
-put_symname2addr(struct ipft_symsdb *sdb, const char *symname, uint64_t addr)
+find_func_by_name(struct ipft_symsdb *sdb, const char *symname,
+                  uint32_t *funcp)
 {
-  char *k;
-  int missing;
-  khint_t iter;
-  khash_t(symname2addr) * db;
-
-  k = strdup(symname);
-  if (k == NULL) {
-    ERROR("strdup failed\n");
-    return -1;
+  uint32_t mid, left = 0, right = sdb->nfuncs;
+
+  /* Find the first function named above the symname */
+  while (left < right) {
+    mid = left + (right - left) / 2;
+    if (strcmp(func_name(sdb, sdb->by_name[mid]), symname) <= 0) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
   }
 
-  db = ((struct ipft_symsdb *)sdb)->symname2addr;
-
-  iter = kh_put(symname2addr, db, k, &missing);
-  if (missing == -1) {
-    ERROR("kh_put failed\n");
+  if (left == 0 ||
+      strcmp(func_name(sdb, sdb->by_name[left - 1]), symname) != 0) {
     return -1;
-  } else if (!missing) {
-    free(k);
   }
 
-  kh_value(db, iter) = addr;
+  *funcp = sdb->by_name[left - 1];
 
   return 0;
 }
 
-static int
-get_addr_by_symname(struct ipft_symsdb *sdb, char *symname, uint64_t *addrp)
+int
+symsdb_get_id_by_symname(struct ipft_symsdb *sdb, const char *symname,
+                         uint32_t *idp)
 {
-  khint_t iter;
-  khash_t(symname2addr) * db;
-
-  db = ((struct ipft_symsdb *)sdb)->symname2addr;
-
-  iter = kh_get(symname2addr, db, symname);
-  if (iter == kh_end(db)) {
-    ERROR("Failed to resolve func symbol name: %s\n", symname);
-    return -1;
-  }
-
-  *addrp = kh_value(db, iter);
-
-  return 0;
+  return find_func_by_name(sdb, symname, idp);
 }
 
 static int
-put_availfuncs(struct ipft_symsdb *sdb, char *sym)
+put_availfuncs(struct ipft_symsdb *sdb, const char *sym)
 {
-  char *k;
   int missing;
   __unused khint_t iter;
 
-  k = strdup(sym);
-  if (k == NULL) {
-    return -1;
-  }
-
-  iter = kh_put(availfuncs, sdb->availfuncs, k, &missing);
+  iter = kh_put(availfuncs, sdb->availfuncs, sym, &missing);
   if (missing == -1) {
     ERROR("kh_put failed\n");
     return -1;
-  } else if (!missing) {
-    free(k);
   }
 
   return 0;
@@ -205,7 +202,7 @@ func_is_available(struct ipft_symsdb *sdb, const char *symname)
 }
 
 static int
-put_funcsseen(struct ipft_symsdb *sdb, char *sym)
+put_funcsseen(struct ipft_symsdb *sdb, const char *sym)
 {
   int missing;
   __unused khint_t iter;
@@ -232,79 +229,270 @@ func_seen(struct ipft_symsdb *sdb, const char *symname)
   return true;
 }
 
+/*
+ * Took from bcc (https://github.com/iovisor/bcc)
+ */
+#ifdef __x86_64__
+// https://www.kernel.org/doc/Documentation/x86/x86_64/mm.txt
+const unsigned long long kernel_addr_space = 0x00ffffffffffffff;
+#else
+const unsigned long long kernel_addr_space = 0x0;
+#endif
+
+/*
+ * Recent systems mount tracefs on /sys/kernel/tracing and the one
+ * under the debugfs only exists for the compatibility.
+ */
+static const char *tracefs_paths[] = {
+    "/sys/kernel/tracing",
+    "/sys/kernel/debug/tracing",
+};
+
+/*
+ * Read the whole file into the NUL-terminated buffer. The files in
+ * procfs and tracefs are generated on read and report zero size, thus
+ * they can neither be mmaped nor be sized in advance.
+ */
 static int
-populate_availfuncs(struct ipft_symsdb *sdb)
+read_file(const char *path, char **bufp, size_t *lenp)
 {
-  FILE *f;
-  int error;
-  ssize_t nread;
-  size_t len = 0;
-  char *line = NULL;
+  int fd;
+  ssize_t n;
+  char *buf, *tmp;
+  size_t len = 0, cap = 1 << 20;
 
-  f = fopen("/sys/kernel/debug/tracing/available_filter_functions", "r");
-  if (f == NULL) {
-    perror("fopen");
+  fd = open(path, O_RDONLY);
+  if (fd == -1) {
     return -1;
   }
 
-  while ((nread = getline(&line, &len, f)) != -1) {
-    char sym[129] = {0};
-    char *cur = line;
-    while (cur - line != 128) {
-      sym[cur - line] = *cur;
-      cur++;
-      if (*cur == '\n' || *cur == ' ') {
-        error = put_availfuncs(sdb, sym);
-        if (error == -1) {
-          ERROR("put_availfuncs failed\n");
-          return -1;
-        }
-        break;
+  buf = malloc(cap);
+  if (buf == NULL) {
+    ERROR("malloc failed\n");
+    close(fd);
+    return -1;
+  }
+
+  while ((n = read(fd, buf + len, cap - len - 1)) != 0) {
+    if (n == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ERROR("read %s failed: %s\n", path, strerror(errno));
+      free(buf);
+      close(fd);
+      return -1;
+    }
+
+    len += n;
+
+    if (cap - len == 1) {
+      tmp = realloc(buf, cap * 2);
+      if (tmp == NULL) {
+        ERROR("realloc failed\n");
+        free(buf);
+        close(fd);
+        return -1;
       }
+      buf = tmp;
+      cap *= 2;
     }
   }
 
-  free(line);
-  fclose(f);
+  close(fd);
+
+  buf[len] = '\0';
+
+  *bufp = buf;
+  *lenp = len;
 
   return 0;
 }
 
+static int
+read_tracefs_file(const char *name, char **bufp, size_t *lenp)
+{
+  char path[PATH_MAX];
+
+  for (size_t i = 0; i < sizeof(tracefs_paths) / sizeof(tracefs_paths[0]);
+       i++) {
+    snprintf(path, sizeof(path), "%s/%s", tracefs_paths[i], name);
+    if (read_file(path, bufp, lenp) == 0) {
+      return 0;
+    }
+  }
+
+  return -1;
+}
+
 /*
- * Took from bcc (https://github.com/iovisor/bcc)
+ * Cut the next line from the buffer in place. Returns NULL at the end.
  */
-#ifdef __x86_64__
-// https://www.kernel.org/doc/Documentation/x86/x86_64/mm.txt
-const unsigned long long kernel_addr_space = 0x00ffffffffffffff;
-#else
-const unsigned long long kernel_addr_space = 0x0;
-#endif
+static char *
+next_line(char **curp, char *end)
+{
+  char *line = *curp, *nl;
+
+  if (line >= end) {
+    return NULL;
+  }
+
+  nl = memchr(line, '\n', end - line);
+  if (nl == NULL) {
+    nl = end;
+  }
+
+  *nl = '\0';
+  *curp = nl + 1;
+
+  return line;
+}
+
+struct func_entry {
+  uint64_t addr;
+  uint32_t name_off;
+};
+
+/*
+ * Function table under construction
+ */
+struct funcs_builder {
+  kvec_t(char) strtab;
+  kvec_t(struct func_entry) funcs;
+};
+
+static void
+funcs_add(struct funcs_builder *b, uint64_t addr, const char *name)
+{
+  size_t len = strlen(name) + 1;
+
+  struct func_entry fe = {
+      .addr = addr,
+      .name_off = kv_size(b->strtab),
+  };
+
+  kv_push(struct func_entry, b->funcs, fe);
+
+  /* Grow geometrically like kv_push, the names are added one by one */
+  if (kv_size(b->strtab) + len > kv_max(b->strtab)) {
+    size_t m = kv_size(b->strtab) + len;
+    kv_roundup32(m);
+    kv_resize(char, b->strtab, m);
+  }
+
+  memcpy(b->strtab.a + kv_size(b->strtab), name, len);
+  kv_size(b->strtab) += len;
+}
+
+static int
+compare_func_addr(const void *_f1, const void *_f2)
+{
+  const struct func_entry *f1 = (const struct func_entry *)_f1;
+  const struct func_entry *f2 = (const struct func_entry *)_f2;
+
+  if (f1->addr != f2->addr) {
+    return f1->addr < f2->addr ? -1 : 1;
+  }
+
+  /* Keep the original order for the aliases */
+  if (f1->name_off != f2->name_off) {
+    return f1->name_off < f2->name_off ? -1 : 1;
+  }
+
+  return 0;
+}
+
+static int
+compare_func_name(const void *_i1, const void *_i2, void *arg)
+{
+  int cmp;
+  uint32_t i1 = *(const uint32_t *)_i1;
+  uint32_t i2 = *(const uint32_t *)_i2;
+  struct ipft_symsdb *sdb = (struct ipft_symsdb *)arg;
+
+  cmp = strcmp(func_name(sdb, i1), func_name(sdb, i2));
+  if (cmp != 0) {
+    return cmp;
+  }
+
+  /* Indices are in the address order */
+  if (i1 != i2) {
+    return i1 < i2 ? -1 : 1;
+  }
+
+  return 0;
+}
 
 /*
- * Record the mapping of kernel functions and their addresses
+ * Record the functions available for tracing. Each line is either
+ * "name [module]" or, for available_filter_functions_addrs,
+ * "addr name [module]". In the latter case, the addresses are kept
+ * for populate_funcs. The names are NUL-terminated in place, so the
+ * buffer must outlive the availfuncs.
  */
 static int
-populate_addr2symname_and_symname2addr(struct ipft_symsdb *sdb)
+parse_availfuncs(struct ipft_symsdb *sdb)
 {
-  FILE *f;
   int error;
-  uint64_t addr;
-  char line[2048];
-  char *symname, *endsym;
+  uint64_t addr = 0;
+  char *cur, *end, *line, *name;
 
-  f = fopen("/proc/kallsyms", "r");
-  if (f == NULL) {
-    perror("fopen");
-    return -1;
+  cur = sdb->availbuf;
+  end = sdb->availbuf + sdb->availbuf_len;
+
+  while ((line = next_line(&cur, end)) != NULL) {
+    name = line;
+
+    if (sdb->has_addrs) {
+      addr = strtoull(line, &name, 16);
+      if (addr == 0) {
+        continue;
+      }
+      name += strspn(name, " \t");
+    }
+
+    name[strcspn(name, " \t")] = '\0';
+    if (*name == '\0') {
+      continue;
+    }
+
+    error = put_availfuncs(sdb, name);
+    if (error == -1) {
+      ERROR("put_availfuncs failed\n");
+      return -1;
+    }
+
+    if (sdb->has_addrs) {
+      struct avail_func af = {.addr = addr, .name = name};
+      kv_push(struct avail_func, sdb->availaddrs, af);
+    }
   }
 
-  if (geteuid() != 0) {
-    ERROR(
-        "Non-root users cannot read address info. Please execute with root.\n");
+  return 0;
+}
+
+/*
+ * Resolve the addresses from the kallsyms for the kernels without
+ * available_filter_functions_addrs
+ */
+static int
+parse_kallsyms(struct ipft_symsdb *sdb, struct funcs_builder *b)
+{
+  int error;
+  size_t len;
+  uint64_t addr;
+  char *buf, *cur, *end, *line, *symname;
+
+  error = read_file("/proc/kallsyms", &buf, &len);
+  if (error == -1) {
+    perror("open");
     return -1;
   }
 
-  while (fgets(line, sizeof(line), f)) {
+  cur = buf;
+  end = buf + len;
+
+  while ((line = next_line(&cur, end)) != NULL) {
     addr = strtoull(line, &symname, 16);
     if (addr == 0 || addr == ULLONG_MAX) {
       continue;
@@ -323,47 +511,155 @@ populate_addr2symname_and_symname2addr(struct ipft_symsdb *sdb)
     }
 
     symname += 2;
-    endsym = symname;
-    while (*endsym && !isspace(*endsym)) {
-      endsym++;
-    }
-
-    *endsym = '\0';
+    symname[strcspn(symname, " \t")] = '\0';
 
     /*
-     * Only add the symbols which are available
+     * Only add the symbols taking skb
      */
-    if (!func_is_available(sdb, symname)) {
+    if (!func_seen(sdb, symname)) {
       continue;
     }
 
-    /*
-     * This shouldn't fail
-     */
-    error = put_addr2symname(sdb, addr, symname);
+    funcs_add(b, addr, symname);
+  }
+
+  free(buf);
+
+  return 0;
+}
+
+/*
+ * Read the functions available for tracing. When the kernel exposes
+ * their addresses as well, the kallsyms is not needed at all.
+ */
+static int
+populate_availfuncs(struct ipft_symsdb *sdb)
+{
+  int error;
+
+  if (geteuid() != 0) {
+    ERROR(
+        "Non-root users cannot read address info. Please execute with root.\n");
+    return -1;
+  }
+
+  sdb->has_addrs = read_tracefs_file("available_filter_functions_addrs",
+                                     &sdb->availbuf, &sdb->availbuf_len) == 0;
+  if (!sdb->has_addrs) {
+    error = read_tracefs_file("available_filter_functions", &sdb->availbuf,
+                              &sdb->availbuf_len);
     if (error == -1) {
-      ERROR("put_addr2sym failed\n");
+      ERROR("Cannot read available_filter_functions from tracefs\n");
       return -1;
     }
+  }
+
+  error = parse_availfuncs(sdb);
+  if (error == -1) {
+    ERROR("parse_availfuncs failed\n");
+    return -1;
+  }
+
+  return 0;
+}
 
-    error = put_symname2addr(sdb, symname, addr);
+/*
+ * Build the function table. This runs after the BTF scan and only
+ * indexes the functions taking skb, which are a small fraction of the
+ * available functions. Each name is appended to the arena once, then
+ * the table is sorted by address and the name index is sorted by
+ * name.
+ */
+static int
+populate_funcs(struct ipft_symsdb *sdb)
+{
+  int error;
+  uint64_t *addrs;
+  struct avail_func *af;
+  struct funcs_builder b;
+  uint32_t nfuncs, *name_offs, *by_name;
+
+  kv_init(b.strtab);
+  kv_init(b.funcs);
+
+  if (sdb->has_addrs) {
+    for (size_t i = 0; i < kv_size(sdb->availaddrs); i++) {
+      af = &kv_A(sdb->availaddrs, i);
+      if (func_seen(sdb, af->name)) {
+        funcs_add(&b, af->addr, af->name);
+      }
+    }
+  } else {
+    error = parse_kallsyms(sdb, &b);
     if (error == -1) {
-      ERROR("put_symname2addr failed\n");
+      ERROR("parse_kallsyms failed\n");
       return -1;
     }
   }
 
-  fclose(f);
+  nfuncs = kv_size(b.funcs);
+
+  qsort(b.funcs.a, nfuncs, sizeof(*b.funcs.a), compare_func_addr);
+
+  addrs = calloc(nfuncs, sizeof(*addrs));
+  name_offs = calloc(nfuncs, sizeof(*name_offs));
+  by_name = calloc(nfuncs, sizeof(*by_name));
+  if (addrs == NULL || name_offs == NULL || by_name == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < nfuncs; i++) {
+    addrs[i] = kv_A(b.funcs, i).addr;
+    name_offs[i] = kv_A(b.funcs, i).name_off;
+    by_name[i] = i;
+  }
+
+  kv_destroy(b.funcs);
+
+  sdb->strtab = b.strtab.a;
+  sdb->strtab_size = kv_size(b.strtab);
+  sdb->nfuncs = nfuncs;
+  sdb->addrs = addrs;
+  sdb->name_offs = name_offs;
+
+  qsort_r(by_name, nfuncs, sizeof(*by_name), compare_func_name, sdb);
+
+  sdb->by_name = by_name;
 
   return 0;
 }
 
+/*
+ * Function found in a BTF. It becomes a symbol unless the function
+ * with the same name is already seen.
+ */
+struct sym_candidate {
+  int pos;
+  const char *symname;
+  uint32_t btf_id;
+};
+
+/*
+ * Unit of the BTF scan. Scanned in parallel and merged in order.
+ */
+struct btf_scan_job {
+  /* Kernel BTF object ID. 0 for vmlinux. */
+  uint32_t obj_id;
+  struct btf *btf;
+  int btf_fd;
+  int error;
+  kvec_t(struct sym_candidate) candidates;
+};
+
+/*
+ * Find the candidates from the BTF. Called concurrently, so it only
+ * reads the database.
+ */
 static int
-do_populate_syms(struct ipft_symsdb *sdb, struct btf *btf, bool is_vmlinux_btf)
+scan_btf(struct ipft_symsdb *sdb, struct btf_scan_job *job)
 {
-  uint64_t addr;
-  struct ipft_sym sym;
-  int error, btf_fd = 0;
+  struct btf *btf = job->btf;
   const struct btf_param *params;
   const char *func_name, *st_name;
   const struct btf_type *t, *func_proto;
@@ -446,59 +742,115 @@ do_populate_syms(struct ipft_symsdb *sdb, struct btf *btf, bool is_vmlinux_btf)
         continue;
       }
 
-      if (!is_vmlinux_btf) {
-        btf_fd = btf__fd(btf);
-      }
+      struct sym_candidate c = {
+          .pos = i,
+          .symname = func_name,
+          .btf_id = id,
+      };
 
-      if (func_seen(sdb, func_name)) {
-        continue;
-      }
+      kv_push(struct sym_candidate, job->candidates, c);
 
-      sym.symname = strdup(func_name);
-      if (sym.symname == NULL) {
-        ERROR("strdup failed\n");
-        return -1;
-      }
+      break;
+    }
+  }
 
-      error = get_addr_by_symname(sdb, sym.symname, &addr);
-      if (error == -1) {
-        ERROR("get_addr_by_symname failed\n");
-        return -1;
-      }
+  return 0;
+}
 
-      sym.addr = addr;
-      sym.btf_fd = btf_fd;
-      sym.btf_id = id;
+/*
+ * Add the candidates to the database. Merging the jobs in the same
+ * order as the serial scan gives the same result.
+ */
+static int
+merge_candidates(struct ipft_symsdb *sdb, struct btf_scan_job *job)
+{
+  int error;
+  struct sym_candidate *c;
 
-      error = pos2syms_append(sdb, i, &sym);
-      if (error == -1) {
-        ERROR("pos2syms_append failed\n");
-        return -1;
-      }
+  for (size_t i = 0; i < kv_size(job->candidates); i++) {
+    c = &kv_A(job->candidates, i);
 
-      error = put_funcsseen(sdb, sym.symname);
-      if (error == -1) {
-        ERROR("put_funcsseen failed\n");
-        return -1;
-      }
+    if (func_seen(sdb, c->symname)) {
+      continue;
+    }
 
-      break;
+    struct symsdb_sym rec = {
+        .symname = c->symname,
+        .btf_id = c->btf_id,
+        .btf_obj_id = job->obj_id,
+        .btf_fd = job->btf_fd,
+    };
+
+    kv_push(struct symsdb_sym, sdb->pos2recs[c->pos], rec);
+
+    /* Points to the BTF string which outlives the build */
+    error = put_funcsseen(sdb, c->symname);
+    if (error == -1) {
+      ERROR("put_funcsseen failed\n");
+      return -1;
     }
   }
 
   return 0;
 }
 
+struct btf_scan_pool {
+  struct ipft_symsdb *sdb;
+  struct btf *vmlinux_btf;
+  struct btf_scan_job *jobs;
+  size_t njobs;
+  /* Index of the next job to take */
+  size_t next;
+};
+
+static void *
+btf_scan_worker_main(void *arg)
+{
+  size_t i;
+  struct btf_scan_job *job;
+  struct btf_scan_pool *p = (struct btf_scan_pool *)arg;
+
+  while ((i = __atomic_fetch_add(&p->next, 1, __ATOMIC_RELAXED)) < p->njobs) {
+    job = p->jobs + i;
+
+    if (job->btf == NULL) {
+      job->btf = btf__load_from_kernel_by_id_split(job->obj_id, p->vmlinux_btf);
+      if (libbpf_get_error(job->btf) != 0) {
+        ERROR("btf__load_from_kernel_by_id failed\n");
+        job->btf = NULL;
+        job->error = -1;
+        continue;
+      }
+
+      btf__set_fd(job->btf, job->btf_fd);
+    }
+
+    job->error = scan_btf(p->sdb, job);
+  }
+
+  return NULL;
+}
+
 /*
  * Finds the kernel functions which take struct sk_buff
  * as an argument and record the position of the argument.
+ *
+ * Distro kernels have hundreds of modules, so the BTFs are loaded
+ * and scanned with the worker threads. The results are merged in
+ * the order of the BTF IDs as the serial scan does.
  */
 static int
 populate_syms(struct ipft_symsdb *sdb)
 {
   int error;
+  long nthreads;
   uint32_t id = 0;
-  struct btf *btf, *vmlinux_btf;
+  bool has_sysfs_btf;
+  pthread_t *threads;
+  struct btf *vmlinux_btf;
+  struct btf_scan_pool pool;
+  struct btf_scan_job job = {0};
+  kvec_t(struct btf_scan_job) jobs;
 
   vmlinux_btf = btf__load_vmlinux_btf();
   if (libbpf_get_error(vmlinux_btf) != 0) {
@@ -506,11 +858,10 @@ populate_syms(struct ipft_symsdb *sdb)
     return -1;
   }
 
-  error = do_populate_syms(sdb, vmlinux_btf, true);
-  if (error == -1) {
-    ERROR("btf_fill_sym2info failed\n");
-    return -1;
-  }
+  kv_init(jobs);
+
+  job.btf = vmlinux_btf;
+  kv_push(struct btf_scan_job, jobs, job);
 
   /*
    * If kernel doesn't support sysfs BTF, skip loading
@@ -519,16 +870,14 @@ populate_syms(struct ipft_symsdb *sdb)
    * ELF files on the disk. Currently, we don't support
    * it because it's difficult to implement it correctly.
    */
-  if (access("/sys/kernel/btf/vmlinux", R_OK) != 0) {
-    return 0;
-  }
+  has_sysfs_btf = access("/sys/kernel/btf/vmlinux", R_OK) == 0;
 
-  while (true) {
+  while (has_sysfs_btf) {
     int fd;
 
     error = bpf_btf_get_next_id(id, &id);
     if (error && errno == ENOENT) {
-      return 0;
+      break;
     }
 
     if (error) {
@@ -542,21 +891,524 @@ populate_syms(struct ipft_symsdb *sdb)
       return -1;
     }
 
-    btf = btf__load_from_kernel_by_id_split(id, vmlinux_btf);
-    if (btf == NULL) {
-      ERROR("btf__load_from_kernel_by_id failed\n");
-      return -1;
+    /* Loaded by the workers */
+    job.obj_id = id;
+    job.btf = NULL;
+    job.btf_fd = fd;
+    kv_push(struct btf_scan_job, jobs, job);
+  }
+
+  pool.sdb = sdb;
+  pool.vmlinux_btf = vmlinux_btf;
+  pool.jobs = jobs.a;
+  pool.njobs = kv_size(jobs);
+  pool.next = 0;
+
+  nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (nthreads < 1) {
+    nthreads = 1;
+  }
+
+  if ((size_t)nthreads > pool.njobs) {
+    nthreads = pool.njobs;
+  }
+
+  threads = calloc(nthreads, sizeof(*threads));
+  if (threads == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  for (long i = 0; i < nthreads; i++) {
+    error = pthread_create(threads + i, NULL, btf_scan_worker_main, &pool);
+    if (error != 0) {
+      ERROR("pthread_create failed: %s\n", strerror(error));
+      /* Workers already started take the rest */
+      nthreads = i;
+      break;
     }
+  }
+
+  /* Scan in this thread as well. No job is left unscanned. */
+  btf_scan_worker_main(&pool);
+
+  for (long i = 0; i < nthreads; i++) {
+    pthread_join(threads[i], NULL);
+  }
 
-    btf__set_fd(btf, fd);
+  free(threads);
 
-    error = do_populate_syms(sdb, btf, false);
+  for (size_t i = 0; i < kv_size(jobs); i++) {
+    if (kv_A(jobs, i).error == -1) {
+      ERROR("scan_btf failed\n");
+      return -1;
+    }
+
+    error = merge_candidates(sdb, &kv_A(jobs, i));
     if (error == -1) {
-      ERROR("btf_fill_sym2info failed\n");
+      ERROR("merge_candidates failed\n");
+      return -1;
+    }
+
+    kv_destroy(kv_A(jobs, i).candidates);
+
+    kv_push(struct btf *, sdb->btfs, kv_A(jobs, i).btf);
+  }
+
+  kv_destroy(jobs);
+
+  return 0;
+}
+
+/*
+ * Resolve the functions found in the BTFs to the function table
+ */
+static int
+resolve_syms(struct ipft_symsdb *sdb)
+{
+  int error;
+  struct symsdb_sym *rec;
+
+  for (int pos = 0; pos < sdb->opt->max_skb_pos; pos++) {
+    for (size_t i = 0; i < kv_size(sdb->pos2recs[pos]); i++) {
+      rec = &kv_A(sdb->pos2recs[pos], i);
+
+      error = find_func_by_name(sdb, rec->symname, &rec->func);
+      if (error == -1) {
+        ERROR("Failed to resolve func symbol name: %s\n", rec->symname);
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * Materialize the symbols of the position handed to the users. The
+ * names point to the arena.
+ */
+static int
+build_pos2syms(struct ipft_symsdb *sdb, int pos, struct symsdb_sym *recs,
+               uint32_t nrecs)
+{
+  struct ipft_sym *syms = NULL;
+
+  /* Empty position is NULL as it was with kvec */
+  if (nrecs != 0) {
+    syms = calloc(nrecs, sizeof(*syms));
+    if (syms == NULL) {
+      ERROR("calloc failed\n");
+      return -1;
+    }
+  }
+
+  for (uint32_t i = 0; i < nrecs; i++) {
+    syms[i].id = recs[i].func;
+    syms[i].addr = sdb->addrs[recs[i].func];
+    syms[i].symname = (char *)func_name(sdb, recs[i].func);
+    syms[i].btf_fd = recs[i].btf_fd;
+    syms[i].btf_id = recs[i].btf_id;
+  }
+
+  sdb->pos2syms[pos] = syms;
+  sdb->pos2nsyms[pos] = nrecs;
+
+  return 0;
+}
+
+/*
+ * On-disk cache of the symbol database. Building the database needs
+ * to parse kallsyms and all BTFs on every run. The cache is keyed by
+ * everything the result depends on, so it is invalidated when the
+ * kernel is rebooted or a module is loaded or unloaded. The function
+ * table and the arena are stored as is and used in place.
+ *
+ * Layout: header | addrs | name_offs | by_name | syms | strtab
+ */
+#define SYMSDB_CACHE_MAGIC 0x3142445354465049ULL /* "IPFTSDB1" */
+#define SYMSDB_CACHE_VERSION 2
+
+struct symsdb_cache_hdr {
+  uint64_t magic;
+  uint64_t key;
+  uint32_t version;
+  uint32_t nfuncs;
+  uint32_t nsyms;
+  uint32_t strtab_size;
+};
+
+/* Entry of pos2syms. Sorted by pos. */
+struct symsdb_cache_sym {
+  uint32_t func;
+  uint32_t pos;
+  uint32_t btf_obj_id;
+  uint32_t btf_id;
+};
+
+static int
+hash_file(uint64_t *h, const char *path)
+{
+  int fd;
+  ssize_t n;
+  char buf[65536];
+
+  fd = open(path, O_RDONLY);
+  if (fd == -1) {
+    return -1;
+  }
+
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+    hash_update(h, buf, n);
+  }
+
+  close(fd);
+
+  return n == 0 ? 0 : -1;
+}
+
+static int
+get_btf_info(int fd, struct bpf_btf_info *info, char *name, size_t name_len)
+{
+  uint32_t info_len = sizeof(*info);
+
+  memset(info, 0, sizeof(*info));
+  memset(name, 0, name_len);
+
+  info->name = (uint64_t)(uintptr_t)name;
+  info->name_len = name_len;
+
+  return bpf_obj_get_info_by_fd(fd, info, &info_len);
+}
+
+/*
+ * Compute the cache key. The addresses change on every boot (KASLR)
+ * and the module BTFs are identified by IDs allocated at load time.
+ */
+static int
+symsdb_cache_key(struct ipft_symsdb *sdb, uint64_t *keyp)
+{
+  int fd, error;
+  uint32_t id = 0;
+  char name[64];
+  struct utsname uts;
+  struct bpf_btf_info info;
+  uint64_t key = HASH_INIT;
+
+  hash_update(&key, &sdb->opt->max_args, sizeof(sdb->opt->max_args));
+  hash_update(&key, &sdb->opt->max_skb_pos, sizeof(sdb->opt->max_skb_pos));
+
+  if (hash_file(&key, "/proc/sys/kernel/random/boot_id") == -1) {
+    VERBOSE("Cannot read boot_id\n");
+    return -1;
+  }
+
+  /* Build ID is in the notes. Fall back to the version string. */
+  if (hash_file(&key, "/sys/kernel/notes") == -1) {
+    if (uname(&uts) == -1) {
+      return -1;
+    }
+    hash_update(&key, uts.release, strlen(uts.release));
+    hash_update(&key, uts.version, strlen(uts.version));
+  }
+
+  if (hash_file(&key, "/sys/kernel/btf/vmlinux") == -1) {
+    VERBOSE("Cannot read vmlinux BTF\n");
+    return -1;
+  }
+
+  /* Loaded module set */
+  while (true) {
+    error = bpf_btf_get_next_id(id, &id);
+    if (error && errno == ENOENT) {
+      break;
+    }
+
+    if (error) {
+      return -1;
+    }
+
+    fd = bpf_btf_get_fd_by_id(id);
+    if (fd < 0) {
+      /* Unloaded in the meantime */
+      continue;
+    }
+
+    error = get_btf_info(fd, &info, name, sizeof(name));
+    close(fd);
+    if (error) {
       return -1;
     }
+
+    /* BTFs of the BPF programs come and go. Ignore them. */
+    if (!info.kernel_btf) {
+      continue;
+    }
+
+    hash_update(&key, &id, sizeof(id));
+    hash_update(&key, name, strlen(name));
+  }
+
+  *keyp = key;
+
+  return 0;
+}
+
+static void
+symsdb_cache_path(struct ipft_symsdb *sdb, char *path, size_t len)
+{
+  snprintf(path, len, "%s/symsdb-%s", IPFT_CACHE_DIR, sdb->opt->cache_name);
+}
+
+static int
+symsdb_cache_store(struct ipft_symsdb *sdb, uint64_t key)
+{
+  int fd, error = -1;
+  struct symsdb_sym *rec;
+  char path[PATH_MAX], tmp[PATH_MAX];
+  struct symsdb_cache_hdr hdr = {0};
+  kvec_t(struct symsdb_cache_sym) syms;
+
+  kv_init(syms);
+
+  for (int pos = 0; pos < sdb->opt->max_skb_pos; pos++) {
+    for (size_t i = 0; i < kv_size(sdb->pos2recs[pos]); i++) {
+      rec = &kv_A(sdb->pos2recs[pos], i);
+
+      struct symsdb_cache_sym cs = {
+          .func = rec->func,
+          .pos = pos,
+          .btf_obj_id = rec->btf_obj_id,
+          .btf_id = rec->btf_id,
+      };
+
+      kv_push(struct symsdb_cache_sym, syms, cs);
+    }
+  }
+
+  hdr.magic = SYMSDB_CACHE_MAGIC;
+  hdr.key = key;
+  hdr.version = SYMSDB_CACHE_VERSION;
+  hdr.nfuncs = sdb->nfuncs;
+  hdr.nsyms = kv_size(syms);
+  hdr.strtab_size = sdb->strtab_size;
+
+  if (cache_dir_create() == -1) {
+    goto out;
+  }
+
+  symsdb_cache_path(sdb, path, sizeof(path));
+  snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+
+  fd = mkstemp(tmp);
+  if (fd == -1) {
+    VERBOSE("Cannot create %s: %s\n", tmp, strerror(errno));
+    goto out;
+  }
+
+  if (write_all(fd, &hdr, sizeof(hdr)) == -1 ||
+      write_all(fd, sdb->addrs, hdr.nfuncs * sizeof(*sdb->addrs)) == -1 ||
+      write_all(fd, sdb->name_offs, hdr.nfuncs * sizeof(*sdb->name_offs)) ==
+          -1 ||
+      write_all(fd, sdb->by_name, hdr.nfuncs * sizeof(*sdb->by_name)) == -1 ||
+      write_all(fd, syms.a, hdr.nsyms * sizeof(*syms.a)) == -1 ||
+      write_all(fd, sdb->strtab, hdr.strtab_size) == -1) {
+    VERBOSE("Cannot write %s: %s\n", tmp, strerror(errno));
+    close(fd);
+    unlink(tmp);
+    goto out;
+  }
+
+  close(fd);
+
+  /* Readers never see the partially written cache */
+  if (rename(tmp, path) == -1) {
+    VERBOSE("Cannot rename %s: %s\n", tmp, strerror(errno));
+    unlink(tmp);
+    goto out;
+  }
+
+  error = 0;
+
+out:
+  kv_destroy(syms);
+  return error;
+}
+
+static void
+close_btf_fds(struct symsdb_sym *recs, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++) {
+    if (recs[i].btf_fd > 0 &&
+        (i == 0 || recs[i].btf_fd != recs[i - 1].btf_fd)) {
+      close(recs[i].btf_fd);
+    }
+  }
+}
+
+/*
+ * Sets *hitp to false when the cache is unusable. The database is
+ * untouched in that case and on error.
+ */
+static int
+symsdb_cache_load(struct ipft_symsdb *sdb, uint64_t key, bool *hitp)
+{
+  int fd;
+  void *image;
+  struct stat st;
+  const char *strtab;
+  char path[PATH_MAX];
+  uint32_t start, end;
+  size_t size, expected;
+  struct symsdb_sym *recs;
+  struct symsdb_cache_hdr *hdr;
+  struct symsdb_cache_sym *syms;
+  uint64_t *addrs;
+  uint32_t *name_offs, *by_name;
+
+  *hitp = false;
+
+  symsdb_cache_path(sdb, path, sizeof(path));
+
+  fd = cache_open(path);
+  if (fd == -1) {
+    return 0;
+  }
+
+  if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(*hdr)) {
+    close(fd);
+    return 0;
+  }
+
+  size = st.st_size;
+
+  image = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (image == MAP_FAILED) {
+    return 0;
+  }
+
+  hdr = image;
+
+  if (hdr->magic != SYMSDB_CACHE_MAGIC ||
+      hdr->version != SYMSDB_CACHE_VERSION || hdr->key != key) {
+    VERBOSE("Symbol database cache is stale\n");
+    goto err0;
+  }
+
+  expected = sizeof(*hdr) +
+             (size_t)hdr->nfuncs *
+                 (sizeof(*addrs) + sizeof(*name_offs) + sizeof(*by_name)) +
+             (size_t)hdr->nsyms * sizeof(*syms) + hdr->strtab_size;
+  if (size != expected || hdr->strtab_size == 0) {
+    goto err0;
+  }
+
+  addrs = (uint64_t *)(hdr + 1);
+  name_offs = (uint32_t *)(addrs + hdr->nfuncs);
+  by_name = name_offs + hdr->nfuncs;
+  syms = (struct symsdb_cache_sym *)(by_name + hdr->nfuncs);
+  strtab = (const char *)(syms + hdr->nsyms);
+
+  /* All strings are terminated as long as the arena is */
+  if (strtab[hdr->strtab_size - 1] != '\0') {
+    goto err0;
+  }
+
+  for (uint32_t i = 0; i < hdr->nfuncs; i++) {
+    if (name_offs[i] >= hdr->strtab_size || by_name[i] >= hdr->nfuncs) {
+      goto err0;
+    }
+  }
+
+  for (uint32_t i = 0; i < hdr->nsyms; i++) {
+    if (syms[i].func >= hdr->nfuncs ||
+        syms[i].pos >= (uint32_t)sdb->opt->max_skb_pos ||
+        (i > 0 && syms[i].pos < syms[i - 1].pos)) {
+      goto err0;
+    }
+  }
+
+  recs = calloc(hdr->nsyms, sizeof(*recs));
+  if (hdr->nsyms != 0 && recs == NULL) {
+    ERROR("calloc failed\n");
+    munmap(image, size);
+    return -1;
+  }
+
+  /* Reopen the module BTFs before touching the database */
+  for (uint32_t i = 0; i < hdr->nsyms; i++) {
+    recs[i].func = syms[i].func;
+    recs[i].btf_id = syms[i].btf_id;
+    recs[i].btf_obj_id = syms[i].btf_obj_id;
+
+    if (syms[i].btf_obj_id == 0) {
+      recs[i].btf_fd = 0;
+    } else if (i > 0 && syms[i].btf_obj_id == syms[i - 1].btf_obj_id) {
+      recs[i].btf_fd = recs[i - 1].btf_fd;
+    } else {
+      recs[i].btf_fd = bpf_btf_get_fd_by_id(syms[i].btf_obj_id);
+      if (recs[i].btf_fd < 0) {
+        VERBOSE("Cannot open BTF %u\n", syms[i].btf_obj_id);
+        close_btf_fds(recs, i);
+        free(recs);
+        goto err0;
+      }
+    }
+  }
+
+  /*
+   * The tables are pointing to the mapped cache. It is mapped
+   * privately, so nobody can modify it under us.
+   */
+  sdb->strtab = strtab;
+  sdb->strtab_size = hdr->strtab_size;
+  sdb->nfuncs = hdr->nfuncs;
+  sdb->addrs = addrs;
+  sdb->name_offs = name_offs;
+  sdb->by_name = by_name;
+
+  start = 0;
+  for (int pos = 0; pos < sdb->opt->max_skb_pos; pos++) {
+    end = start;
+    while (end < hdr->nsyms && syms[end].pos == (uint32_t)pos) {
+      end++;
+    }
+
+    if (build_pos2syms(sdb, pos, recs + start, end - start) == -1) {
+      ERROR("build_pos2syms failed\n");
+      goto err1;
+    }
+
+    start = end;
   }
 
+  free(recs);
+
+  VERBOSE("Loaded symbol database from %s\n", path);
+
+  *hitp = true;
+
+  return 0;
+
+err1:
+  for (int pos = 0; pos < sdb->opt->max_skb_pos; pos++) {
+    free(sdb->pos2syms[pos]);
+    sdb->pos2syms[pos] = NULL;
+    sdb->pos2nsyms[pos] = 0;
+  }
+  sdb->strtab = NULL;
+  sdb->strtab_size = 0;
+  sdb->nfuncs = 0;
+  sdb->addrs = NULL;
+  sdb->name_offs = NULL;
+  sdb->by_name = NULL;
+  close_btf_fds(recs, hdr->nsyms);
+  free(recs);
+  munmap(image, size);
+  return -1;
+err0:
+  munmap(image, size);
   return 0;
 }
 
@@ -564,6 +1416,8 @@ int
 symsdb_create(struct ipft_symsdb **sdbp, struct ipft_symsdb_opt *opt)
 {
   int error;
+  uint64_t key;
+  bool hit = false, cacheable = false;
   struct ipft_symsdb *sdb;
 
   sdb = (struct ipft_symsdb *)calloc(1, sizeof(*sdb));
@@ -574,33 +1428,38 @@ symsdb_create(struct ipft_symsdb **sdbp, struct ipft_symsdb_opt *opt)
 
   sdb->opt = opt;
 
-  sdb->availfuncs = kh_init(availfuncs);
-  if (sdb->availfuncs == NULL) {
-    ERROR("kh_init failed\n");
+  sdb->pos2syms = calloc(opt->max_skb_pos, sizeof(*sdb->pos2syms));
+  if (sdb->pos2syms == NULL) {
+    ERROR("calloc failed\n");
     return -1;
   }
 
-  error = populate_availfuncs(sdb);
-  if (error == -1) {
-    ERROR("populate_availfuncs failed\n");
+  sdb->pos2nsyms = calloc(opt->max_skb_pos, sizeof(*sdb->pos2nsyms));
+  if (sdb->pos2nsyms == NULL) {
+    ERROR("calloc failed\n");
     return -1;
   }
 
-  sdb->addr2symname = kh_init(addr2symname);
-  if (sdb->addr2symname == NULL) {
-    ERROR("kh_init failed\n");
-    return -1;
+  if (opt->cache_name != NULL) {
+    cacheable = symsdb_cache_key(sdb, &key) == 0;
   }
 
-  sdb->symname2addr = kh_init(symname2addr);
-  if (sdb->symname2addr == NULL) {
-    ERROR("kh_init failed\n");
-    return -1;
+  if (cacheable) {
+    error = symsdb_cache_load(sdb, key, &hit);
+    if (error == -1) {
+      ERROR("symsdb_cache_load failed\n");
+      return -1;
+    }
+
+    if (hit) {
+      *sdbp = sdb;
+      return 0;
+    }
   }
 
-  error = populate_addr2symname_and_symname2addr(sdb);
-  if (error == -1) {
-    ERROR("populate_addr2symname failed\n");
+  sdb->availfuncs = kh_init(availfuncs);
+  if (sdb->availfuncs == NULL) {
+    ERROR("kh_init failed\n");
     return -1;
   }
 
@@ -610,22 +1469,89 @@ symsdb_create(struct ipft_symsdb **sdbp, struct ipft_symsdb_opt *opt)
     return -1;
   }
 
-  sdb->pos2syms = calloc(opt->max_skb_pos, sizeof(*sdb->pos2syms));
-  if (sdb->pos2syms == NULL) {
+  sdb->pos2recs = calloc(opt->max_skb_pos, sizeof(*sdb->pos2recs));
+  if (sdb->pos2recs == NULL) {
     ERROR("calloc failed\n");
     return -1;
   }
 
   for (int i = 0; i < opt->max_skb_pos; i++) {
-    kv_init(sdb->pos2syms[i]);
+    kv_init(sdb->pos2recs[i]);
+  }
+
+  kv_init(sdb->availaddrs);
+  kv_init(sdb->btfs);
+
+  error = populate_availfuncs(sdb);
+  if (error == -1) {
+    ERROR("populate_availfuncs failed\n");
+    return -1;
   }
 
+  /*
+   * Scan the BTFs first. Only the functions taking skb are indexed
+   * in the function table.
+   */
   error = populate_syms(sdb);
   if (error == -1) {
     ERROR("populate_pos2syms failed\n");
     return -1;
   }
 
+  error = populate_funcs(sdb);
+  if (error == -1) {
+    ERROR("populate_funcs failed\n");
+    return -1;
+  }
+
+  error = resolve_syms(sdb);
+  if (error == -1) {
+    ERROR("resolve_syms failed\n");
+    return -1;
+  }
+
+  for (int i = 0; i < opt->max_skb_pos; i++) {
+    error = build_pos2syms(sdb, i, sdb->pos2recs[i].a,
+                           kv_size(sdb->pos2recs[i]));
+    if (error == -1) {
+      ERROR("build_pos2syms failed\n");
+      return -1;
+    }
+  }
+
+  /* Failing to store the cache is not fatal */
+  if (cacheable && symsdb_cache_store(sdb, key) == -1) {
+    VERBOSE("Couldn't store symbol database cache\n");
+  }
+
+  /* Drop the tables only needed for building */
+  for (int i = 0; i < opt->max_skb_pos; i++) {
+    kv_destroy(sdb->pos2recs[i]);
+  }
+
+  kh_destroy(availfuncs, sdb->availfuncs);
+  kh_destroy(funcsseen, sdb->funcsseen);
+  free(sdb->pos2recs);
+  free(sdb->availbuf);
+  kv_destroy(sdb->availaddrs);
+
+  /*
+   * The parsed BTFs are large and nobody uses them later. Free the
+   * module BTFs before the vmlinux BTF which is their base, but keep
+   * their fds open for attaching the programs.
+   */
+  for (size_t i = kv_size(sdb->btfs); i > 0; i--) {
+    btf__set_fd(kv_A(sdb->btfs, i - 1), -1);
+    btf__free(kv_A(sdb->btfs, i - 1));
+  }
+
+  kv_destroy(sdb->btfs);
+
+  sdb->availbuf = NULL;
+  sdb->availfuncs = NULL;
+  sdb->funcsseen = NULL;
+  sdb->pos2recs = NULL;
+
   *sdbp = (struct ipft_symsdb *)sdb;
 
   return 0;
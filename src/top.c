@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+
+#include "ipft.h"
+
+/*
+ * Live view of the function hit counters maintained by the count tracer
+ */
+
+struct top_entry {
+  uint32_t id;
+  uint64_t total;
+  uint64_t rate;
+};
+
+struct ipft_top {
+  struct ipft_symsdb *sdb;
+  uint32_t nfuncs;
+  int ncpus;
+  /* mmaped func_hits map */
+  volatile uint64_t *hits;
+  size_t hits_size;
+  /* Sum of the hits of all CPUs at the last update */
+  uint64_t *last;
+  struct top_entry *entries;
+  struct timespec last_time;
+};
+
+int
+top_create(struct ipft_top **topp, struct ipft_symsdb *sdb, int map_fd,
+           uint32_t nfuncs, int ncpus)
+{
+  void *hits;
+  size_t page_size;
+  struct ipft_top *top;
+
+  top = calloc(1, sizeof(*top));
+  if (top == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  page_size = getpagesize();
+  top->hits_size = (nfuncs * ncpus * sizeof(uint64_t) + page_size - 1) /
+                   page_size * page_size;
+
+  hits = mmap(NULL, top->hits_size, PROT_READ, MAP_SHARED, map_fd, 0);
+  if (hits == MAP_FAILED) {
+    ERROR("mmap failed: %s\n", strerror(errno));
+    return -1;
+  }
+
+  top->last = calloc(nfuncs, sizeof(*top->last));
+  if (top->last == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  top->entries = calloc(nfuncs, sizeof(*top->entries));
+  if (top->entries == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  top->sdb = sdb;
+  top->nfuncs = nfuncs;
+  top->ncpus = ncpus;
+  top->hits = (volatile uint64_t *)hits;
+
+  clock_gettime(CLOCK_MONOTONIC, &top->last_time);
+
+  *topp = top;
+
+  return 0;
+}
+
+static int
+compare_entry(const void *_e1, const void *_e2)
+{
+  const struct top_entry *e1 = (const struct top_entry *)_e1;
+  const struct top_entry *e2 = (const struct top_entry *)_e2;
+
+  if (e1->rate != e2->rate) {
+    return e1->rate < e2->rate ? 1 : -1;
+  }
+
+  if (e1->total != e2->total) {
+    return e1->total < e2->total ? 1 : -1;
+  }
+
+  return 0;
+}
+
+/*
+ * Sum up the per-CPU counters and sort the functions hit so far.
+ * Returns the number of the functions hit.
+ */
+static uint32_t
+collect(struct ipft_top *top, double elapsed, uint64_t *total_ratep)
+{
+  uint64_t total;
+  uint32_t nhit = 0;
+  uint64_t total_rate = 0;
+
+  for (uint32_t i = 0; i < top->nfuncs; i++) {
+    total = 0;
+    for (int cpu = 0; cpu < top->ncpus; cpu++) {
+      total += top->hits[cpu * top->nfuncs + i];
+    }
+
+    if (total == 0) {
+      continue;
+    }
+
+    top->entries[nhit].id = i;
+    top->entries[nhit].total = total;
+    top->entries[nhit].rate =
+        elapsed > 0 ? (total - top->last[i]) / elapsed : 0;
+    total_rate += top->entries[nhit].rate;
+    top->last[i] = total;
+    nhit++;
+  }
+
+  qsort(top->entries, nhit, sizeof(*top->entries), compare_entry);
+
+  *total_ratep = total_rate;
+
+  return nhit;
+}
+
+static int
+get_rows(void)
+{
+  struct winsize ws;
+
+  if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == -1 || ws.ws_row == 0) {
+    return 24;
+  }
+
+  return ws.ws_row;
+}
+
+int
+top_update(struct ipft_top *top)
+{
+  int rows;
+  char *symname;
+  double elapsed;
+  uint32_t nhit;
+  uint64_t total_rate;
+  struct timespec now;
+  bool tty = isatty(STDOUT_FILENO);
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  elapsed = (now.tv_sec - top->last_time.tv_sec) +
+            (now.tv_nsec - top->last_time.tv_nsec) / 1e9;
+  top->last_time = now;
+
+  nhit = collect(top, elapsed, &total_rate);
+
+  if (tty) {
+    /* Move the cursor to home and clear the screen */
+    printf("\033[H\033[2J");
+    rows = get_rows() - 3;
+  } else {
+    printf("===\n");
+    rows = nhit;
+  }
+
+  printf("%u functions hit, %" PRIu64 " hits/s\n", nhit, total_rate);
+  printf("%-12s %-20s %s\n", "HITS/s", "TOTAL", "FUNCTION");
+
+  for (uint32_t i = 0; i < nhit && (int)i < rows; i++) {
+    /* When name resolution fails, (unknown) will be returned */
+    symsdb_get_symname_by_id(top->sdb, top->entries[i].id, &symname);
+    printf("%-12" PRIu64 " %-20" PRIu64 " %s\n", top->entries[i].rate,
+           top->entries[i].total, symname);
+  }
+
+  fflush(stdout);
+
+  return 0;
+}
@@ -1,13 +1,22 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <sched.h>
 #include <signal.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <time.h>
 #include <pthread.h>
 #include <arpa/inet.h>
 #include <sys/socket.h>
 #include <netinet/ip.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <linux/types.h>
 
 #include <gelf.h>
@@ -19,16 +28,34 @@
 #include "ipft_kprobe.bpf.o.h"
 #include "ipft_kprobe_multi.bpf.o.h"
 #include "ipft_ftrace.bpf.o.h"
-#include "null_module.bpf.o.h"
+#include "ipft_kprobe_null.bpf.o.h"
+#include "ipft_kprobe_multi_null.bpf.o.h"
+#include "ipft_ftrace_null.bpf.o.h"
 
 struct ipft_tracer {
   struct bpf_object *bpf;
+  /*
+   * fentry/fexit programs. Same as bpf with ftrace backend. With
+   * hybrid backend, it is a separate object sharing the maps with bpf.
+   */
+  struct bpf_object *ftrace_bpf;
   struct ipft_regex *re;
   struct ipft_symsdb *sdb;
+  struct ipft_exclude *ex;
   struct ipft_tracer_opt *opt;
   struct ipft_output *out;
   struct ipft_script *script;
   struct perf_buffer *pb;
+  struct ring_buffer *rb;
+  /* Number of lost events per CPU */
+  uint64_t *lost;
+  int ncpus;
+  /* Number of the function ids */
+  uint32_t nfuncs;
+  /* kprobe backend passes the function ids with the attach cookies */
+  bool kprobe_cookie;
+  /* Count tracer */
+  struct ipft_top *top;
 };
 
 enum ipft_tracers
@@ -42,6 +69,10 @@ get_tracer_id_by_name(const char *name)
     return IPFT_TRACER_FUNCTION_GRAPH;
   }
 
+  if (strcmp(name, "count") == 0) {
+    return IPFT_TRACER_COUNT;
+  }
+
   return IPFT_TRACER_UNSPEC;
 }
 
@@ -53,6 +84,8 @@ get_tracer_name_by_id(enum ipft_tracers id)
     return "function";
   case IPFT_TRACER_FUNCTION_GRAPH:
     return "function_graph";
+  case IPFT_TRACER_COUNT:
+    return "count";
   default:
     return NULL;
   }
@@ -73,6 +106,10 @@ get_backend_id_by_name(const char *name)
     return IPFT_BACKEND_KPROBE_MULTI;
   }
 
+  if (strcmp(name, "hybrid") == 0) {
+    return IPFT_BACKEND_HYBRID;
+  }
+
   return IPFT_BACKEND_UNSPEC;
 }
 
@@ -86,6 +123,8 @@ get_backend_name_by_id(enum ipft_backends id)
     return "ftrace";
   case IPFT_BACKEND_KPROBE_MULTI:
     return "kprobe-multi";
+  case IPFT_BACKEND_HYBRID:
+    return "hybrid";
   default:
     return NULL;
   }
@@ -96,7 +135,7 @@ select_backend_for_tracer(enum ipft_tracers tracer)
 {
   bool has_kprobe_multi = probe_kprobe_multi();
 
-  if (tracer == IPFT_TRACER_FUNCTION) {
+  if (tracer == IPFT_TRACER_FUNCTION || tracer == IPFT_TRACER_COUNT) {
     if (has_kprobe_multi) {
       return IPFT_BACKEND_KPROBE_MULTI;
     } else {
@@ -105,12 +144,53 @@ select_backend_for_tracer(enum ipft_tracers tracer)
   }
 
   if (tracer == IPFT_TRACER_FUNCTION_GRAPH) {
-    return IPFT_BACKEND_FTRACE;
+    if (has_kprobe_multi) {
+      return IPFT_BACKEND_KPROBE_MULTI;
+    } else {
+      return IPFT_BACKEND_FTRACE;
+    }
   }
 
   return IPFT_BACKEND_UNSPEC;
 }
 
+enum ipft_transports
+get_transport_id_by_name(const char *name)
+{
+  if (strcmp(name, "perf") == 0) {
+    return IPFT_TRANSPORT_PERF;
+  }
+
+  if (strcmp(name, "ringbuf") == 0) {
+    return IPFT_TRANSPORT_RINGBUF;
+  }
+
+  return IPFT_TRANSPORT_UNSPEC;
+}
+
+const char *
+get_transport_name_by_id(enum ipft_transports id)
+{
+  switch (id) {
+  case IPFT_TRANSPORT_PERF:
+    return "perf";
+  case IPFT_TRANSPORT_RINGBUF:
+    return "ringbuf";
+  default:
+    return NULL;
+  }
+}
+
+enum ipft_transports
+select_transport(void)
+{
+  if (probe_ringbuf()) {
+    return IPFT_TRANSPORT_RINGBUF;
+  }
+
+  return IPFT_TRANSPORT_PERF;
+}
+
 int
 get_max_args_for_backend(enum ipft_backends backend)
 {
@@ -119,6 +199,7 @@ get_max_args_for_backend(enum ipft_backends backend)
   case IPFT_BACKEND_KPROBE_MULTI:
     return KPROBE_MAX_ARGS;
   case IPFT_BACKEND_FTRACE:
+  case IPFT_BACKEND_HYBRID:
     return FTRACE_MAX_ARGS;
   default:
     // Shouldn't reach to here
@@ -134,6 +215,7 @@ get_max_skb_pos_for_backend(enum ipft_backends backend)
   case IPFT_BACKEND_KPROBE_MULTI:
     return KPROBE_MAX_SKB_POS;
   case IPFT_BACKEND_FTRACE:
+  case IPFT_BACKEND_HYBRID:
     return FTRACE_MAX_SKB_POS;
   default:
     // Shouldn't reach to here
@@ -146,7 +228,77 @@ static struct {
   size_t succeeded;
   size_t failed;
   size_t filtered;
-} attach_stat = {0};
+  /* Protects the counters from the concurrent attach workers */
+  pthread_mutex_t mutex;
+} attach_stat = {.mutex = PTHREAD_MUTEX_INITIALIZER};
+
+static void
+attach_stat_update(size_t succeeded, size_t failed, size_t filtered)
+{
+  pthread_mutex_lock(&attach_stat.mutex);
+
+  attach_stat.succeeded += succeeded;
+  attach_stat.failed += failed;
+  attach_stat.filtered += filtered;
+
+  INFO("\rAttaching program (total %zu, succeeded %zu, failed %zu, filtered: "
+       "%zu)",
+       attach_stat.total, attach_stat.succeeded, attach_stat.failed,
+       attach_stat.filtered);
+  fflush(stderr);
+
+  pthread_mutex_unlock(&attach_stat.mutex);
+}
+
+static double
+get_monotonic_sec(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Functions which end the life of the skb. The free programs in the
+ * BPF object detect the end on them, and the main programs show them
+ * in the trace.
+ */
+static const char *skb_free_funcs[] = {
+    "kfree_skb",   "kfree_skb_reason", "sk_skb_reason_drop",
+    "consume_skb", "napi_consume_skb", "__kfree_skb",
+};
+
+static bool
+is_skb_free_func(const char *symname)
+{
+  for (size_t i = 0; i < sizeof(skb_free_funcs) / sizeof(skb_free_funcs[0]);
+       i++) {
+    if (strcmp(symname, skb_free_funcs[i]) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * The consolidated trace and the tracked skb end at the free
+ * functions, so we always attach them regardless of the regex.
+ */
+static bool
+sym_is_target(struct ipft_tracer *t, struct ipft_sym *sym)
+{
+  /* Known to fail */
+  if (exclude_match(t->ex, sym)) {
+    return false;
+  }
+
+  if (regex_match(t->re, sym->symname)) {
+    return true;
+  }
+
+  return (t->opt->consolidate || t->opt->track_skb) &&
+         is_skb_free_func(sym->symname);
+}
 
 static int
 get_prog_by_pos(struct bpf_object *bpf, int pos,
@@ -190,66 +342,305 @@ get_prog_by_pos(struct bpf_object *bpf, int pos,
   return 0;
 }
 
-static int
-attach_kprobe(struct ipft_tracer *t)
+static bool
+is_lineage_prog(struct bpf_program *prog)
+{
+  return strncmp(bpf_program__name(prog), "ipft_lineage_",
+                 strlen("ipft_lineage_")) == 0;
+}
+
+static bool
+is_free_prog(struct bpf_program *prog)
 {
+  return strncmp(bpf_program__name(prog), "ipft_free_",
+                 strlen("ipft_free_")) == 0;
+}
+
+/*
+ * Worker pool to attach the programs to the symbols in parallel. Each
+ * attachment is independent, so the workers just take the next symbol
+ * from the shared list.
+ */
+struct attach_work {
+  struct ipft_sym *sym;
+  struct bpf_program *entry_prog;
+  struct bpf_program *exit_prog;
+};
+
+struct attach_pool {
+  struct ipft_tracer *t;
+  struct attach_work *works;
+  size_t nworks;
+  /* Index of the next work to take */
+  size_t next;
+  int (*attach_one)(struct ipft_tracer *, struct attach_work *);
   int error;
-  struct bpf_link *link;
-  struct bpf_program *prog;
-  struct ipft_sym *sym, **syms;
+};
+
+static void *
+attach_worker_main(void *arg)
+{
+  size_t i;
+  struct attach_pool *p = (struct attach_pool *)arg;
+
+  while ((i = __atomic_fetch_add(&p->next, 1, __ATOMIC_RELAXED)) <
+         p->nworks) {
+    if (p->attach_one(p->t, p->works + i) == -1) {
+      __atomic_store_n(&p->error, -1, __ATOMIC_RELAXED);
+      /* Let the other workers stop as well */
+      __atomic_store_n(&p->next, p->nworks, __ATOMIC_RELAXED);
+      break;
+    }
+  }
+
+  return NULL;
+}
+
+static long
+get_nr_online_cpus(void)
+{
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n < 1 ? 1 : n;
+}
+
+/*
+ * When the attachment is CPU bound (e.g. verification), having more
+ * threads than the CPUs doesn't help. It just multiplies the memory
+ * the kernel consumes at the same time.
+ */
+static int
+get_nr_attach_threads(struct ipft_tracer *t, size_t nworks, bool cpu_bound)
+{
+  long n = t->opt->nr_attach_threads;
+
+  if (n == 0) {
+    n = get_nr_online_cpus();
+  }
+
+  if (cpu_bound && n > get_nr_online_cpus()) {
+    n = get_nr_online_cpus();
+  }
 
-  for (int i = 0; i < KPROBE_MAX_SKB_POS; i++) {
+  if ((size_t)n > nworks) {
+    n = nworks;
+  }
+
+  return n;
+}
+
+/*
+ * Build the list of the target symbols and attach them with
+ * attach_one() using the worker threads
+ */
+static int
+attach_pool_run(struct ipft_tracer *t, struct bpf_object *bpf, int min_skb_pos,
+                int max_skb_pos, bool has_exit, bool cpu_bound,
+                int (*attach_one)(struct ipft_tracer *, struct attach_work *))
+{
+  int error, nthreads;
+  pthread_t *threads;
+  struct ipft_sym *syms;
+  size_t nfiltered = 0;
+  struct bpf_program *entry_prog, *exit_prog = NULL;
+  struct attach_pool pool = {.t = t, .attach_one = attach_one};
+
+  pool.works = calloc(symsdb_get_syms_total(t->sdb), sizeof(*pool.works));
+  if (pool.works == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  for (int i = min_skb_pos; i < max_skb_pos; i++) {
     syms = symsdb_get_syms_by_pos(t->sdb, i);
     if (syms == NULL) {
       continue;
     }
 
-    error = get_prog_by_pos(t->bpf, i, &prog, NULL);
+    error = get_prog_by_pos(bpf, i, &entry_prog, has_exit ? &exit_prog : NULL);
     if (error == -1) {
       ERROR("get_prog_by_pos failed\n");
-      return -1;
+      goto end;
     }
 
     for (int j = 0; j < symsdb_get_syms_total_by_pos(t->sdb, i); j++) {
-      sym = syms[j];
-
-      if (!regex_match(t->re, sym->symname)) {
-        attach_stat.filtered++;
-        goto out;
+      if (!sym_is_target(t, &syms[j])) {
+        nfiltered++;
+        continue;
       }
 
-      link = bpf_program__attach_kprobe(prog, false, sym->symname);
-      if (link == NULL) {
-        VERBOSE("Attach kprobe failed for %s\n", sym->symname);
-        attach_stat.failed++;
-        goto out;
-      }
+      pool.works[pool.nworks].sym = &syms[j];
+      pool.works[pool.nworks].entry_prog = entry_prog;
+      pool.works[pool.nworks].exit_prog = exit_prog;
+      pool.nworks++;
+    }
+  }
+
+  attach_stat_update(0, 0, nfiltered);
+
+  nthreads = get_nr_attach_threads(t, pool.nworks, cpu_bound);
 
-      attach_stat.succeeded++;
+  VERBOSE("Attaching %zu programs with %d threads\n", pool.nworks, nthreads);
+
+  /* No need to spawn the thread */
+  if (nthreads <= 1) {
+    attach_worker_main(&pool);
+    error = pool.error;
+    goto end;
+  }
+
+  threads = calloc(nthreads, sizeof(*threads));
+  if (threads == NULL) {
+    ERROR("calloc failed\n");
+    error = -1;
+    goto end;
+  }
 
-    out:
-      INFO("\rAttaching program (total %zu, succeeded %zu, failed %zu, "
-           "filtered: "
-           "%zu)",
-           attach_stat.total, attach_stat.succeeded, attach_stat.failed,
-           attach_stat.filtered);
-      fflush(stderr);
+  for (int i = 0; i < nthreads; i++) {
+    error = pthread_create(threads + i, NULL, attach_worker_main, &pool);
+    if (error != 0) {
+      ERROR("pthread_create failed: %s\n", strerror(error));
+      /* Workers already started finish the rest */
+      nthreads = i;
+      if (nthreads == 0) {
+        attach_worker_main(&pool);
+      }
+      break;
     }
   }
 
+  for (int i = 0; i < nthreads; i++) {
+    pthread_join(threads[i], NULL);
+  }
+
+  free(threads);
+
+  error = pool.error;
+
+end:
+  free(pool.works);
+  return error;
+}
+
+static int
+attach_kprobe_one(struct ipft_tracer *t, struct attach_work *w)
+{
+  int error;
+  struct bpf_link *link;
+
+  struct bpf_kprobe_opts opts = {
+      .sz = sizeof(opts),
+      .bpf_cookie = t->kprobe_cookie ? w->sym->id : 0,
+  };
+
+  link = bpf_program__attach_kprobe_opts(w->entry_prog, w->sym->symname,
+                                         &opts);
+  /* Take the error before the logging clobbers errno */
+  error = libbpf_get_error(link);
+  if (error != 0) {
+    VERBOSE("Attach kprobe failed for %s\n", w->sym->symname);
+    exclude_add_failed(t->ex, w->sym, error);
+    attach_stat_update(0, 1, 0);
+    return 0;
+  }
+
+  attach_stat_update(1, 0, 0);
+
   return 0;
 }
 
 static int
-attach_kprobe_multi(struct ipft_tracer *t)
+attach_kprobe(struct ipft_tracer *t)
+{
+  return attach_pool_run(t, t->bpf, 0, KPROBE_MAX_SKB_POS, false, false,
+                         attach_kprobe_one);
+}
+
+/*
+ * Attach to the batch of functions at once. When the kernel rejects
+ * the batch, it is bisected to find the functions which cannot be
+ * attached and the rest are attached in the largest possible subsets.
+ * This takes O(k log n) calls for k bad functions out of n. The exit
+ * program is optional and attached to the same batch as a retprobe.
+ * The cookies carry the function ids.
+ */
+static void
+attach_kprobe_multi_bisect(struct ipft_tracer *t,
+                           struct bpf_program *entry_prog,
+                           struct bpf_program *exit_prog,
+                           struct ipft_sym **targets, uint64_t *addrs,
+                           __u64 *cookies, size_t cnt)
 {
   int error;
+  size_t half;
+  struct bpf_link *link, *exit_link;
+
+  struct bpf_kprobe_multi_opts opts = {
+      .sz = sizeof(opts),
+      .addrs = addrs,
+      .cookies = cookies,
+      .cnt = cnt,
+  };
+
+  link = bpf_program__attach_kprobe_multi_opts(entry_prog, NULL, &opts);
+
+  error = libbpf_get_error(link);
+  if (error == 0 && exit_prog != NULL) {
+    opts.retprobe = true;
+    exit_link = bpf_program__attach_kprobe_multi_opts(exit_prog, NULL, &opts);
+    error = libbpf_get_error(exit_link);
+    if (error != 0) {
+      /* Don't leave the entries without the exits */
+      bpf_link__destroy(link);
+    }
+  }
+
+  if (error == 0) {
+    attach_stat_update(cnt, 0, 0);
+    return;
+  }
+
+  if (cnt == 1) {
+    VERBOSE("\nAttach to %s failed: %s\n", targets[0]->symname,
+            libbpf_error_string(error));
+    exclude_add_failed(t->ex, targets[0], error);
+    attach_stat_update(0, 1, 0);
+    return;
+  }
+
+  /* Not specific to the functions. Bisecting doesn't help. */
+  if (error == -EPERM || error == -EOPNOTSUPP || error == -ENOMEM) {
+    VERBOSE("\nbpf_program__attach_kprobe_multi_opts failed: %s\n",
+            libbpf_error_string(error));
+    attach_stat_update(0, cnt, 0);
+    return;
+  }
+
+  half = cnt / 2;
+  attach_kprobe_multi_bisect(t, entry_prog, exit_prog, targets, addrs,
+                             cookies, half);
+  attach_kprobe_multi_bisect(t, entry_prog, exit_prog, targets + half,
+                             addrs + half, cookies + half, cnt - half);
+}
+
+static int
+attach_kprobe_multi(struct ipft_tracer *t, int max_skb_pos)
+{
+  int error, nsyms;
+  __u64 *cookies;
   uint64_t *addrs;
-  struct bpf_link *link;
-  struct bpf_program *prog;
-  struct ipft_sym *sym, **syms;
+  struct ipft_sym *sym, *syms, **targets;
+  struct bpf_program *prog, *exit_prog = NULL;
+
+  /* A single exit program serves all skb positions */
+  if (t->opt->tracer == IPFT_TRACER_FUNCTION_GRAPH) {
+    exit_prog = bpf_object__find_program_by_name(t->bpf, "ipft_main_return");
+    if (exit_prog == NULL) {
+      ERROR("bpf_object__find_program_by_name failed\n");
+      return -1;
+    }
+  }
 
-  for (int i = 0; i < KPROBE_MAX_SKB_POS; i++) {
+  for (int i = 0; i < max_skb_pos; i++) {
     syms = symsdb_get_syms_by_pos(t->sdb, i);
     if (syms == NULL) {
       continue;
@@ -261,151 +652,212 @@ attach_kprobe_multi(struct ipft_tracer *t)
       return -1;
     }
 
-    addrs = calloc(symsdb_get_syms_total_by_pos(t->sdb, i), sizeof(*addrs));
-    if (addrs == NULL) {
+    nsyms = symsdb_get_syms_total_by_pos(t->sdb, i);
+
+    addrs = calloc(nsyms, sizeof(*addrs));
+    cookies = calloc(nsyms, sizeof(*cookies));
+    targets = calloc(nsyms, sizeof(*targets));
+    if (addrs == NULL || cookies == NULL || targets == NULL) {
       ERROR("calloc failed\n");
+      free(targets);
+      free(cookies);
+      free(addrs);
       return -1;
     }
 
-    size_t cur = 0;
+    size_t cur = 0, nfiltered = 0;
 
-    for (int j = 0; j < symsdb_get_syms_total_by_pos(t->sdb, i); j++) {
-      sym = syms[j];
+    for (int j = 0; j < nsyms; j++) {
+      sym = &syms[j];
 
-      if (!regex_match(t->re, sym->symname)) {
-        attach_stat.filtered++;
+      if (!sym_is_target(t, sym)) {
+        nfiltered++;
         continue;
       }
 
+      targets[cur] = sym;
+      cookies[cur] = sym->id;
       addrs[cur++] = sym->addr;
     }
 
-    struct bpf_kprobe_multi_opts opts = {
-        .sz = sizeof(opts),
-        .addrs = addrs,
-        .cnt = cur,
-    };
-
-    link = bpf_program__attach_kprobe_multi_opts(prog, NULL, &opts);
+    attach_stat_update(0, 0, nfiltered);
 
-    error = libbpf_get_error(link);
-    if (error != 0) {
-      VERBOSE("bpf_program__attach_kprobe_multi_opts failed: %s\n",
-              libbpf_error_string(error));
-      attach_stat.failed += opts.cnt;
-    } else {
-      attach_stat.succeeded += opts.cnt;
+    if (cur != 0) {
+      attach_kprobe_multi_bisect(t, prog, exit_prog, targets, addrs, cookies,
+                                 cur);
     }
 
-    INFO("\rAttaching program (total %zu, succeeded %zu, failed %zu, filtered: "
-         "%zu)",
-         attach_stat.total, attach_stat.succeeded, attach_stat.failed,
-         attach_stat.filtered);
-    fflush(stderr);
+    free(targets);
+    free(cookies);
+    free(addrs);
   }
 
   return 0;
 }
 
+/*
+ * Loads the fentry/fexit programs for the symbol and attaches them.
+ * Called from the multiple workers. Everything touched here is either
+ * local or read-only.
+ */
 static int
-attach_ftrace(struct ipft_tracer *t)
+attach_ftrace_one(struct ipft_tracer *t, struct attach_work *w)
 {
-  int error, btf_fd;
-  int entry_fd, exit_fd;
+  int btf_fd;
   char log_buf[4096] = {0};
-  int entry_tp_fd, exit_tp_fd;
-  struct ipft_sym *sym, **syms;
-  size_t entry_size, exit_size;
-  struct bpf_program *entry_prog, *exit_prog;
-  const struct bpf_insn *entry_insns, *exit_insns;
+  struct ipft_sym *sym = w->sym;
+  int error, entry_fd, exit_fd, entry_tp_fd, exit_tp_fd;
 
-  btf_fd = bpf_object__btf_fd(t->bpf);
+  btf_fd = bpf_object__btf_fd(t->ftrace_bpf);
   if (btf_fd < 0) {
     ERROR("bpf_object__btf_fd failed\n");
     return -1;
   }
 
-  for (int i = 0; i < FTRACE_MAX_SKB_POS; i++) {
-    syms = symsdb_get_syms_by_pos(t->sdb, i);
-    if (syms == NULL) {
-      continue;
-    }
+  struct bpf_prog_load_opts opts = {
+      .sz = sizeof(opts),
+      .prog_btf_fd = btf_fd,
+      .attach_btf_id = sym->btf_id,
+      .attach_btf_obj_fd = sym->btf_fd,
+      .log_level = 4,
+      .log_size = sizeof(log_buf),
+      .log_buf = log_buf,
+  };
 
-    error = get_prog_by_pos(t->bpf, i, &entry_prog, &exit_prog);
-    if (error == -1) {
-      ERROR("get_prog_by_pos failed\n");
-      return -1;
-    }
+  opts.expected_attach_type = BPF_TRACE_FENTRY;
+
+  entry_fd = bpf_prog_load(BPF_PROG_TYPE_TRACING, NULL, "GPL",
+                           bpf_program__insns(w->entry_prog),
+                           bpf_program__insn_cnt(w->entry_prog), &opts);
+  if (entry_fd < 0) {
+    /* Take the error before the logging clobbers errno */
+    error = -errno;
+    VERBOSE("bpf_prog_load for %s entry failed\n%s", sym->symname, log_buf);
+    exclude_add_failed(t->ex, sym, error);
+    attach_stat_update(0, 1, 0);
+    return 0;
+  }
 
-    entry_insns = bpf_program__insns(entry_prog);
-    exit_insns = bpf_program__insns(exit_prog);
-    entry_size = bpf_program__insn_cnt(entry_prog);
-    exit_size = bpf_program__insn_cnt(exit_prog);
+  opts.expected_attach_type = BPF_TRACE_FEXIT;
+
+  exit_fd = bpf_prog_load(BPF_PROG_TYPE_TRACING, NULL, "GPL",
+                          bpf_program__insns(w->exit_prog),
+                          bpf_program__insn_cnt(w->exit_prog), &opts);
+  if (exit_fd < 0) {
+    error = -errno;
+    VERBOSE("bpf_prog_load for %s exit failed\n%s", sym->symname, log_buf);
+    exclude_add_failed(t->ex, sym, error);
+    close(entry_fd);
+    attach_stat_update(0, 1, 0);
+    return 0;
+  }
 
-    for (int j = 0; j < symsdb_get_syms_total_by_pos(t->sdb, i); j++) {
-      sym = syms[j];
+  entry_tp_fd = bpf_raw_tracepoint_open(NULL, entry_fd);
+  if (entry_tp_fd < 0) {
+    VERBOSE("bpf_raw_tracepoint_open for %s entry failed: %s\n", sym->symname,
+            libbpf_error_string(entry_tp_fd));
+    exclude_add_failed(t->ex, sym, entry_tp_fd);
+    close(entry_fd);
+    close(exit_fd);
+    attach_stat_update(0, 1, 0);
+    return 0;
+  }
 
-      if (!regex_match(t->re, sym->symname)) {
-        attach_stat.filtered++;
-        goto out;
-      }
+  exit_tp_fd = bpf_raw_tracepoint_open(NULL, exit_fd);
+  if (exit_tp_fd < 0) {
+    VERBOSE("bpf_raw_tracepoint_open for %s exit failed: %s\n", sym->symname,
+            libbpf_error_string(exit_tp_fd));
+    exclude_add_failed(t->ex, sym, exit_tp_fd);
+    close(entry_tp_fd);
+    close(entry_fd);
+    close(exit_fd);
+    attach_stat_update(0, 1, 0);
+    return 0;
+  }
 
-      struct bpf_prog_load_opts opts = {
-          .sz = sizeof(opts),
-          .prog_btf_fd = btf_fd,
-          .attach_btf_id = sym->btf_id,
-          .attach_btf_obj_fd = sym->btf_fd,
-          .log_level = 4,
-          .log_size = sizeof(log_buf),
-          .log_buf = log_buf,
-      };
+  attach_stat_update(1, 0, 0);
 
-      opts.expected_attach_type = BPF_TRACE_FENTRY;
+  return 0;
+}
 
-      entry_fd = bpf_prog_load(BPF_PROG_TYPE_TRACING, NULL, "GPL", entry_insns,
-                               entry_size, &opts);
-      if (error == -1) {
-        VERBOSE("bpf_prog_load for %s entry failed\n%s", sym->symname, log_buf);
-        attach_stat.failed++;
-        goto out;
-      }
+static int
+attach_ftrace(struct ipft_tracer *t, int min_skb_pos)
+{
+  /* Verification dominates here */
+  return attach_pool_run(t, t->ftrace_bpf, min_skb_pos, FTRACE_MAX_SKB_POS,
+                         true, true, attach_ftrace_one);
+}
 
-      opts.expected_attach_type = BPF_TRACE_FEXIT;
+/*
+ * Hybrid backend attaches the functions taking skb within the first
+ * KPROBE_MAX_SKB_POS arguments with kprobe-multi (a link per position)
+ * and only the rest with fentry (two verified programs per function)
+ */
+static int
+attach_hybrid(struct ipft_tracer *t)
+{
+  int error;
 
-      exit_fd = bpf_prog_load(BPF_PROG_TYPE_TRACING, NULL, "GPL", exit_insns,
-                              exit_size, &opts);
-      if (error == -1) {
-        VERBOSE("bpf_prog_load for %s exit failed\n%s", sym->symname, log_buf);
-        attach_stat.failed++;
-        goto out;
-      }
+  error = attach_kprobe_multi(t, KPROBE_MAX_SKB_POS);
+  if (error == -1) {
+    return -1;
+  }
 
-      entry_tp_fd = bpf_raw_tracepoint_open(NULL, entry_fd);
-      if (entry_tp_fd < 0) {
-        VERBOSE("bpf_raw_tracepoint_open for %s entry failed: %s\n",
-                sym->symname, libbpf_error_string(entry_tp_fd));
-        attach_stat.failed++;
-        goto out;
-      }
+  return attach_ftrace(t, KPROBE_MAX_SKB_POS);
+}
 
-      exit_tp_fd = bpf_raw_tracepoint_open(NULL, exit_fd);
-      if (exit_tp_fd < 0) {
-        VERBOSE("bpf_raw_tracepoint_open for %s exit failed: %s\n",
-                sym->symname, libbpf_error_string(entry_tp_fd));
-        attach_stat.failed++;
-        goto out;
-      }
+/*
+ * The programs following the lineage are attached to a few fixed
+ * functions with kprobe on any backend. The functions missing in the
+ * kernel are skipped.
+ */
+static void
+attach_lineage(struct ipft_tracer *t)
+{
+  struct bpf_link *link;
+  struct bpf_program *prog;
+
+  bpf_object__for_each_program(prog, t->bpf) {
+    if (!is_lineage_prog(prog)) {
+      continue;
+    }
+
+    link = bpf_program__attach(prog);
+    if (libbpf_get_error(link) != 0) {
+      VERBOSE("Attach %s failed\n", bpf_program__section_name(prog));
+    }
+  }
+}
+
+/*
+ * The programs detecting the end of the packet are attached to the
+ * functions freeing the skb in the same way. Only some of them exist
+ * depending on the kernel version.
+ */
+static int
+attach_free(struct ipft_tracer *t)
+{
+  size_t nattached = 0;
+  struct bpf_link *link;
+  struct bpf_program *prog;
 
-      attach_stat.succeeded++;
+  bpf_object__for_each_program(prog, t->bpf) {
+    if (!is_free_prog(prog)) {
+      continue;
+    }
 
-    out:
-      INFO("\rAttaching program (total %zu, succeeded %zu, failed %zu, "
-           "filtered: "
-           "%zu)",
-           attach_stat.total, attach_stat.succeeded, attach_stat.failed,
-           attach_stat.filtered);
-      fflush(stderr);
+    link = bpf_program__attach(prog);
+    if (libbpf_get_error(link) != 0) {
+      VERBOSE("Attach %s failed\n", bpf_program__section_name(prog));
+      continue;
     }
+
+    nattached++;
+  }
+
+  if (nattached == 0) {
+    ERROR("Couldn't attach to any function to free skb\n");
+    return -1;
   }
 
   return 0;
@@ -415,9 +867,9 @@ static int
 attach_all(struct ipft_tracer *t)
 {
   int error;
-  clock_t start, end;
+  double start;
 
-  start = clock();
+  start = get_monotonic_sec();
 
   attach_stat.total = symsdb_get_syms_total(t->sdb);
 
@@ -432,13 +884,19 @@ attach_all(struct ipft_tracer *t)
     }
     break;
   case IPFT_BACKEND_FTRACE:
-    error = attach_ftrace(t);
+    error = attach_ftrace(t, 0);
     if (error == -1) {
       return -1;
     }
     break;
   case IPFT_BACKEND_KPROBE_MULTI:
-    error = attach_kprobe_multi(t);
+    error = attach_kprobe_multi(t, KPROBE_MAX_SKB_POS);
+    if (error == -1) {
+      return -1;
+    }
+    break;
+  case IPFT_BACKEND_HYBRID:
+    error = attach_hybrid(t);
     if (error == -1) {
       return -1;
     }
@@ -448,12 +906,22 @@ attach_all(struct ipft_tracer *t)
     return -1;
   }
 
-  INFO("\n");
+  if (t->opt->lineage) {
+    attach_lineage(t);
+  }
 
-  end = clock();
+  if ((t->opt->consolidate || t->opt->track_skb) && attach_free(t) == -1) {
+    return -1;
+  }
+
+  INFO("\n");
 
-  VERBOSE("Took %lf seconds to attach\n",
-          ((double)(end - start)) / CLOCKS_PER_SEC);
+  VERBOSE("Took %.3lf seconds to attach\n", get_monotonic_sec() - start);
+
+  /* Skip the functions failed this time on the next run */
+  if (error == 0 && exclude_store(t->ex) == -1) {
+    VERBOSE("Couldn't store attach failure cache\n");
+  }
 
   return error;
 }
@@ -464,22 +932,150 @@ struct perf_sample_data {
   uint8_t data[0];
 };
 
+/*
+ * Events are variable length. Make sure the module data claimed by
+ * the header is actually there.
+ */
+static bool
+event_is_valid(void *data, size_t size)
+{
+  struct ipft_event *e = (struct ipft_event *)data;
+
+  if (size < sizeof(*e)) {
+    return false;
+  }
+
+  return size >= sizeof(*e) + e->data_len;
+}
+
+struct perf_lost_data {
+  struct perf_event_header header;
+  uint64_t id;
+  uint64_t lost;
+};
+
+/*
+ * Expand the consolidated packet trace to the events
+ */
+static int
+handle_packet_trace(struct ipft_tracer *t, void *data, size_t size)
+{
+  int error;
+  struct ipft_event *events;
+  struct ipft_packet_trace_entry *ent;
+  struct ipft_packet_trace *rec = (struct ipft_packet_trace *)data;
+  size_t hdr_size = offsetof(struct ipft_packet_trace, entries);
+
+  if (size < hdr_size || rec->nentries > IPFT_PACKET_TRACE_MAX_ENTRIES ||
+      size < hdr_size + rec->nentries * sizeof(*ent)) {
+    ERROR("Truncated packet trace (size %zu)\n", size);
+    return -1;
+  }
+
+  events = calloc(rec->nentries, sizeof(*events));
+  if (events == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  for (uint16_t i = 0; i < rec->nentries; i++) {
+    ent = rec->entries + i;
+    events[i].packet_id = rec->packet_id;
+    events[i].tstamp = rec->tstamp + ent->tstamp_delta;
+    events[i].func_id = ent->func_id;
+    events[i].processor_id = ent->processor_id;
+    events[i].type = ent->is_return ? IPFT_EVENT_RETURN : IPFT_EVENT_ENTRY;
+  }
+
+  error = output_on_packet(t->out, events, rec->nentries, rec->ntruncated,
+                           rec->dropped);
+
+  free(events);
+
+  return error;
+}
+
+/*
+ * Functions creating a new skb indexed by enum ipft_lineage_funcs
+ */
+static const char *lineage_funcs[] = {
+    [IPFT_LINEAGE_SKB_CLONE] = "skb_clone",
+    [IPFT_LINEAGE_SKB_COPY] = "skb_copy",
+    [IPFT_LINEAGE_PSKB_COPY] = "__pskb_copy_fclone",
+    [IPFT_LINEAGE_SKB_COPY_EXPAND] = "skb_copy_expand",
+    [IPFT_LINEAGE_SKB_SEGMENT] = "skb_segment",
+};
+
+/*
+ * Resolve the function created the skb to the function id, so the
+ * outputs can treat it like the other events
+ */
+static int
+handle_lineage(struct ipft_tracer *t, struct ipft_event *e)
+{
+  struct ipft_event le;
+  struct ipft_lineage *l = (struct ipft_lineage *)e->data;
+
+  if (e->data_len < sizeof(*l)) {
+    ERROR("Truncated lineage event (size %u)\n", e->data_len);
+    return -1;
+  }
+
+  le = *e;
+  le.data_len = 0;
+
+  if (l->func >= IPFT_LINEAGE_MAX ||
+      symsdb_get_id_by_symname(t->sdb, lineage_funcs[l->func],
+                               &le.func_id) == -1) {
+    le.func_id = UINT32_MAX;
+  }
+
+  return output_on_lineage(t->out, &le, l->parent_id);
+}
+
+static int
+handle_event(struct ipft_tracer *t, void *data, size_t size)
+{
+  struct ipft_event *e = (struct ipft_event *)data;
+
+  if (t->opt->consolidate) {
+    return handle_packet_trace(t, data, size);
+  }
+
+  if (!event_is_valid(data, size)) {
+    ERROR("Truncated event (size %zu)\n", size);
+    return -1;
+  }
+
+  if (e->type == IPFT_EVENT_LINEAGE) {
+    return handle_lineage(t, e);
+  }
+
+  return output_on_trace(t->out, e);
+}
+
 static enum bpf_perf_event_ret
-trace_cb(void *ctx, __unused int cpu, struct perf_event_header *ehdr)
+trace_cb(void *ctx, int cpu, struct perf_event_header *ehdr)
 {
   int error;
   struct ipft_tracer *t = (struct ipft_tracer *)ctx;
   struct perf_sample_data *s = (struct perf_sample_data *)ehdr;
+  struct perf_lost_data *l = (struct perf_lost_data *)ehdr;
 
   switch (ehdr->type) {
   case PERF_RECORD_SAMPLE:
-    error = output_on_trace(t->out, (struct ipft_event *)s->data);
+    error = handle_event(t, s->data, s->size);
     if (error == -1) {
       return LIBBPF_PERF_EVENT_ERROR;
     }
     break;
   case PERF_RECORD_LOST:
-    error = 0;
+    /*
+     * Each ring is consumed by only one thread at a time,
+     * so we don't need to make this atomic.
+     */
+    t->lost[cpu] += l->lost;
+    VERBOSE("Lost %" PRIu64 " events on CPU %d\n", l->lost, cpu);
     break;
   default:
     ERROR("Unknown event type %d\n", ehdr->type);
@@ -509,253 +1105,1209 @@ perf_buffer_create(struct perf_buffer **pbp, struct ipft_tracer *t,
       .wakeup_events = perf_wakeup_events,
   };
 
-  pb = perf_buffer__new_raw(bpf_object__find_map_fd_by_name(t->bpf, "events"),
-                            perf_page_cnt, &pe_attr, trace_cb, t, &pb_opts);
-  if (pb == NULL) {
-    ERROR("perf_buffer__new_raw failed\n");
+  pb = perf_buffer__new_raw(bpf_object__find_map_fd_by_name(t->bpf, "events"),
+                            perf_page_cnt, &pe_attr, trace_cb, t, &pb_opts);
+  if (pb == NULL) {
+    ERROR("perf_buffer__new_raw failed\n");
+    return -1;
+  }
+
+  *pbp = pb;
+
+  return 0;
+}
+
+/*
+ * Multi-threaded perf buffer consumer. Each consumer thread owns a
+ * disjoint subset of the per-CPU rings and consumes them with its
+ * own epoll instance. libbpf keeps the decoding state per ring, so
+ * the consumers never share the state.
+ */
+struct perf_consumer {
+  pthread_t thread;
+  int epfd;
+  int error;
+  struct ipft_tracer *t;
+};
+
+/*
+ * Set by the signal handler and polled by the consumers. Only
+ * sig_atomic_t is safe to write from the handler.
+ */
+static volatile sig_atomic_t end = 0;
+
+static void *
+perf_consumer_main(void *arg)
+{
+  int error, nevents;
+  struct epoll_event events[64];
+  struct perf_consumer *c = (struct perf_consumer *)arg;
+
+  while (!end) {
+    nevents = epoll_wait(c->epfd, events, 64, 1000);
+    if (nevents < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ERROR("epoll_wait failed: %s\n", strerror(errno));
+      c->error = -1;
+      break;
+    }
+
+    for (int i = 0; i < nevents; i++) {
+      error = perf_buffer__consume_buffer(c->t->pb, events[i].data.u64);
+      if (error < 0) {
+        ERROR("perf_buffer__consume_buffer failed: %s\n",
+              libbpf_error_string(error));
+        c->error = -1;
+        return NULL;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+static int
+perf_consumer_start(struct perf_consumer *c, struct ipft_tracer *t, int id,
+                    int nconsumers)
+{
+  int error;
+  cpu_set_t cpus;
+
+  c->t = t;
+  c->error = 0;
+
+  c->epfd = epoll_create1(EPOLL_CLOEXEC);
+  if (c->epfd < 0) {
+    ERROR("epoll_create1 failed: %s\n", strerror(errno));
+    return -1;
+  }
+
+  for (size_t i = id; i < perf_buffer__buffer_cnt(t->pb); i += nconsumers) {
+    struct epoll_event ev = {
+        .events = EPOLLIN,
+        .data.u64 = i,
+    };
+
+    error = epoll_ctl(c->epfd, EPOLL_CTL_ADD, perf_buffer__buffer_fd(t->pb, i),
+                      &ev);
+    if (error == -1) {
+      ERROR("epoll_ctl failed: %s\n", strerror(errno));
+      return -1;
+    }
+  }
+
+  error = pthread_create(&c->thread, NULL, perf_consumer_main, c);
+  if (error != 0) {
+    ERROR("pthread_create failed: %s\n", strerror(error));
+    return -1;
+  }
+
+  CPU_ZERO(&cpus);
+  CPU_SET(id % libbpf_num_possible_cpus(), &cpus);
+
+  /* Pinning is best-effort. The CPU might be offline. */
+  error = pthread_setaffinity_np(c->thread, sizeof(cpus), &cpus);
+  if (error != 0) {
+    VERBOSE("Couldn't pin consumer %d: %s\n", id, strerror(error));
+  }
+
+  return 0;
+}
+
+static int
+perf_consumers_run(struct ipft_tracer *t)
+{
+  int error = 0, nconsumers;
+  struct perf_consumer *consumers;
+
+  nconsumers = t->opt->nr_consumers;
+  if ((size_t)nconsumers > perf_buffer__buffer_cnt(t->pb)) {
+    nconsumers = perf_buffer__buffer_cnt(t->pb);
+  }
+
+  consumers = calloc(nconsumers, sizeof(*consumers));
+  if (consumers == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  VERBOSE("Consuming %zu perf buffers with %d threads\n",
+          perf_buffer__buffer_cnt(t->pb), nconsumers);
+
+  for (int i = 0; i < nconsumers; i++) {
+    error = perf_consumer_start(consumers + i, t, i, nconsumers);
+    if (error == -1) {
+      ERROR("perf_consumer_start failed\n");
+      end = 1;
+      nconsumers = i;
+      break;
+    }
+  }
+
+  for (int i = 0; i < nconsumers; i++) {
+    pthread_join(consumers[i].thread, NULL);
+    close(consumers[i].epfd);
+    if (consumers[i].error == -1) {
+      error = -1;
+    }
+  }
+
+  free(consumers);
+
+  return error;
+}
+
+/*
+ * The kernel reports the loss of the ring buffer only to the BPF
+ * program. Collect what the BPF programs counted.
+ */
+static int
+collect_ringbuf_lost(struct ipft_tracer *t)
+{
+  int error;
+  struct ipft_cpu_stat *stats;
+
+  stats = calloc(t->ncpus, sizeof(*stats));
+  if (stats == NULL) {
+    ERROR("calloc failed\n");
+    return -1;
+  }
+
+  error = bpf_map_lookup_elem(
+      bpf_object__find_map_fd_by_name(t->bpf, "cpu_stats"), &(int){0}, stats);
+  if (error == -1) {
+    ERROR("Cannot lookup cpu_stats map\n");
+    free(stats);
+    return -1;
+  }
+
+  for (int i = 0; i < t->ncpus; i++) {
+    t->lost[i] = stats[i].lost;
+  }
+
+  free(stats);
+
+  return 0;
+}
+
+static void
+print_lost_summary(struct ipft_tracer *t)
+{
+  uint64_t total = 0;
+
+  for (int i = 0; i < t->ncpus; i++) {
+    total += t->lost[i];
+  }
+
+  if (total == 0) {
+    VERBOSE("No events were lost\n");
+    return;
+  }
+
+  INFO("Lost %" PRIu64 " events. The trace is incomplete. Consider growing "
+       "the buffer (--perf-page-count or --ringbuf-page-count) or narrowing "
+       "the target functions (--regex).\n",
+       total);
+
+  for (int i = 0; i < t->ncpus; i++) {
+    if (t->lost[i] != 0) {
+      VERBOSE("CPU %03d lost %" PRIu64 " events\n", i, t->lost[i]);
+    }
+  }
+}
+
+static int
+ringbuf_trace_cb(void *ctx, void *data, size_t size)
+{
+  struct ipft_tracer *t = (struct ipft_tracer *)ctx;
+  return handle_event(t, data, size);
+}
+
+static int
+ring_buffer_create(struct ring_buffer **rbp, struct ipft_tracer *t)
+{
+  struct ring_buffer *rb;
+
+  struct ring_buffer_opts rb_opts = {
+      .sz = sizeof(rb_opts),
+  };
+
+  rb = ring_buffer__new(
+      bpf_object__find_map_fd_by_name(t->bpf, "events_ringbuf"),
+      ringbuf_trace_cb, t, &rb_opts);
+  if (rb == NULL) {
+    ERROR("ring_buffer__new failed\n");
+    return -1;
+  }
+
+  *rbp = rb;
+
+  return 0;
+}
+
+static int
+event_buffer_poll(struct ipft_tracer *t, int timeout_ms)
+{
+  if (t->rb != NULL) {
+    return ring_buffer__poll(t->rb, timeout_ms);
+  }
+
+  return perf_buffer__poll(t->pb, timeout_ms);
+}
+
+/*
+ * Linking is done on the memfds, so it never touches the disk. The
+ * linker only takes the file paths, thus the memfds are passed with
+ * their /proc/self/fd paths.
+ */
+static int
+create_memfd_from_image(int *fdp, const char *name, uint8_t *image,
+                        size_t image_size)
+{
+  int fd;
+  ssize_t n;
+
+  fd = memfd_create(name, MFD_CLOEXEC);
+  if (fd == -1) {
+    ERROR("memfd_create failed: %s\n", strerror(errno));
+    return -1;
+  }
+
+  while (image_size > 0) {
+    n = write(fd, image, image_size);
+    if (n == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ERROR("Failed to write image to memfd\n");
+      close(fd);
+      return -1;
+    }
+    image += n;
+    image_size -= n;
+  }
+
+  *fdp = fd;
+
+  return 0;
+}
+
+static int
+read_image(int fd, uint8_t **imagep, size_t *image_sizep)
+{
+  ssize_t n;
+  struct stat st;
+  uint8_t *image;
+  size_t off = 0;
+
+  if (fstat(fd, &st) == -1) {
+    ERROR("fstat failed: %s\n", strerror(errno));
+    return -1;
+  }
+
+  image = malloc(st.st_size);
+  if (image == NULL) {
+    ERROR("malloc failed\n");
+    return -1;
+  }
+
+  while (off < (size_t)st.st_size) {
+    n = pread(fd, image + off, st.st_size - off, off);
+    if (n == -1 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      ERROR("Failed to read linked image\n");
+      free(image);
+      return -1;
+    }
+    off += n;
+  }
+
+  *imagep = image;
+  *image_sizep = st.st_size;
+
+  return 0;
+}
+
+static int
+do_link(uint8_t **imagep, size_t *image_sizep, uint8_t *target_image,
+        size_t target_image_size, uint8_t *module_image,
+        size_t module_image_size)
+{
+  struct bpf_linker *linker;
+  char target_path[32], module_path[32], out_path[32];
+  int error = -1, target_fd, module_fd, out_fd;
+
+  error = create_memfd_from_image(&target_fd, "ipft_target", target_image,
+                                  target_image_size);
+  if (error == -1) {
+    ERROR("create_memfd_from_image for target image failed\n");
+    return -1;
+  }
+
+  error = create_memfd_from_image(&module_fd, "ipft_module", module_image,
+                                  module_image_size);
+  if (error == -1) {
+    ERROR("create_memfd_from_image for module image failed\n");
+    goto err0;
+  }
+
+  out_fd = memfd_create("ipft_linked", MFD_CLOEXEC);
+  if (out_fd == -1) {
+    ERROR("memfd_create failed: %s\n", strerror(errno));
+    error = -1;
+    goto err1;
+  }
+
+  snprintf(target_path, sizeof(target_path), "/proc/self/fd/%d", target_fd);
+  snprintf(module_path, sizeof(module_path), "/proc/self/fd/%d", module_fd);
+  snprintf(out_path, sizeof(out_path), "/proc/self/fd/%d", out_fd);
+
+  struct bpf_linker_opts lopts = {.sz = sizeof(lopts)};
+
+  error = -1;
+
+  linker = bpf_linker__new(out_path, &lopts);
+  if (linker == NULL) {
+    ERROR("bpf_linker__create failed\n");
+    goto err2;
+  }
+
+  struct bpf_linker_file_opts fopts = {.sz = sizeof(fopts)};
+
+  if (bpf_linker__add_file(linker, target_path, &fopts) != 0) {
+    ERROR("bpf_linker__add_file failed\n");
+    goto err3;
+  }
+
+  if (bpf_linker__add_file(linker, module_path, &fopts) != 0) {
+    ERROR("bpf_linker__add_file failed\n");
+    goto err3;
+  }
+
+  if (bpf_linker__finalize(linker) != 0) {
+    ERROR("bpf_linker__finalize failed\n");
+    goto err3;
+  }
+
+  error = read_image(out_fd, imagep, image_sizep);
+  if (error == -1) {
+    ERROR("read_image failed\n");
+  }
+
+err3:
+  bpf_linker__free(linker);
+err2:
+  close(out_fd);
+err1:
+  close(module_fd);
+err0:
+  close(target_fd);
+  return error;
+}
+
+/*
+ * Cache of the objects linked with the script module. The same script
+ * is used over and over, so each pair of the images is linked only
+ * once. The object is content-addressed with the SHA-256 of everything
+ * it depends on, thus the stale entries are just never looked up and
+ * no other input can be crafted to hit the entry.
+ */
+static void
+linked_cache_key(uint8_t *key, uint8_t *target_image,
+                 size_t target_image_size, uint8_t *module_image,
+                 size_t module_image_size)
+{
+  struct sha256_ctx c;
+  const char *version = libbpf_version_string();
+
+  sha256_init(&c);
+  sha256_update(&c, version, strlen(version) + 1);
+  sha256_update(&c, &target_image_size, sizeof(target_image_size));
+  sha256_update(&c, target_image, target_image_size);
+  sha256_update(&c, &module_image_size, sizeof(module_image_size));
+  sha256_update(&c, module_image, module_image_size);
+  sha256_final(&c, key);
+}
+
+static void
+linked_cache_path(uint8_t *key, char *path, size_t len)
+{
+  char hex[SHA256_DIGEST_SIZE * 2 + 1];
+
+  for (int i = 0; i < SHA256_DIGEST_SIZE; i++) {
+    sprintf(hex + i * 2, "%02x", key[i]);
+  }
+
+  snprintf(path, len, "%s/linked-%s.o", IPFT_CACHE_DIR, hex);
+}
+
+/*
+ * Returns -1 when the object is not cached
+ */
+static int
+linked_cache_load(uint8_t *key, uint8_t **imagep, size_t *image_sizep)
+{
+  int fd, error;
+  char path[PATH_MAX];
+
+  linked_cache_path(key, path, sizeof(path));
+
+  fd = cache_open(path);
+  if (fd == -1) {
+    return -1;
+  }
+
+  error = read_image(fd, imagep, image_sizep);
+  close(fd);
+  if (error == -1) {
+    return -1;
+  }
+
+  /* Truncated file is the only thing we could see here */
+  if (*image_sizep < SELFMAG || memcmp(*imagep, ELFMAG, SELFMAG) != 0) {
+    free(*imagep);
+    return -1;
+  }
+
+  VERBOSE("Loaded linked object from %s\n", path);
+
+  return 0;
+}
+
+static int
+linked_cache_store(uint8_t *key, uint8_t *image, size_t image_size)
+{
+  int fd;
+  char path[PATH_MAX], tmp[PATH_MAX];
+
+  if (cache_dir_create() == -1) {
+    return -1;
+  }
+
+  linked_cache_path(key, path, sizeof(path));
+  snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+
+  fd = mkstemp(tmp);
+  if (fd == -1) {
+    VERBOSE("Cannot create %s: %s\n", tmp, strerror(errno));
+    return -1;
+  }
+
+  if (write_all(fd, image, image_size) == -1) {
+    VERBOSE("Cannot write %s: %s\n", tmp, strerror(errno));
+    close(fd);
+    unlink(tmp);
+    return -1;
+  }
+
+  close(fd);
+
+  /* Readers never see the partially written object */
+  if (rename(tmp, path) == -1) {
+    VERBOSE("Cannot rename %s: %s\n", tmp, strerror(errno));
+    unlink(tmp);
+    return -1;
+  }
+
+  return 0;
+}
+
+static int
+link_cached(uint8_t **imagep, size_t *image_sizep, uint8_t *target_image,
+            size_t target_image_size, uint8_t *module_image,
+            size_t module_image_size)
+{
+  int error;
+  uint8_t key[SHA256_DIGEST_SIZE];
+
+  linked_cache_key(key, target_image, target_image_size, module_image,
+                   module_image_size);
+
+  if (linked_cache_load(key, imagep, image_sizep) == 0) {
+    return 0;
+  }
+
+  error = do_link(imagep, image_sizep, target_image, target_image_size,
+                  module_image, module_image_size);
+  if (error == -1) {
+    ERROR("do_link failed\n");
+    return -1;
+  }
+
+  /* Failing to store the cache is not fatal */
+  if (linked_cache_store(key, *imagep, *image_sizep) == -1) {
+    VERBOSE("Couldn't store linked object cache\n");
+  }
+
+  return 0;
+}
+
+/*
+ * The target images are also built with the null module. They are
+ * used as is when the script is not given.
+ */
+static int
+get_target_image(enum ipft_backends backend, bool prelinked, uint8_t **imagep,
+                 size_t *image_sizep)
+{
+  switch (backend) {
+  case IPFT_BACKEND_KPROBE:
+    *imagep = prelinked ? ipft_kprobe_null_bpf_o : ipft_kprobe_bpf_o;
+    *image_sizep =
+        prelinked ? ipft_kprobe_null_bpf_o_len : ipft_kprobe_bpf_o_len;
+    break;
+  case IPFT_BACKEND_FTRACE:
+    *imagep = prelinked ? ipft_ftrace_null_bpf_o : ipft_ftrace_bpf_o;
+    *image_sizep =
+        prelinked ? ipft_ftrace_null_bpf_o_len : ipft_ftrace_bpf_o_len;
+    break;
+  case IPFT_BACKEND_KPROBE_MULTI:
+    *imagep =
+        prelinked ? ipft_kprobe_multi_null_bpf_o : ipft_kprobe_multi_bpf_o;
+    *image_sizep = prelinked ? ipft_kprobe_multi_null_bpf_o_len
+                             : ipft_kprobe_multi_bpf_o_len;
+    break;
+  default:
+    ERROR("Unsupported backend ID %d\n", backend);
+    return -1;
+  }
+  return 0;
+}
+
+/*
+ * The programs for the positions below min_skb_pos are not attached,
+ * so they are not loaded at all
+ */
+static int
+ftrace_set_init_target(struct bpf_object *bpf, struct ipft_tracer *t,
+                       int min_skb_pos)
+{
+  int error;
+
+  for (int i = 0; i < FTRACE_MAX_SKB_POS; i++) {
+    int nsyms;
+    struct ipft_sym *sym, *syms;
+    struct bpf_program *entry_prog, *exit_prog;
+
+    error = get_prog_by_pos(bpf, i, &entry_prog, &exit_prog);
+    if (error == -1) {
+      ERROR("get_prog_by_pos failed\n");
+      return -1;
+    }
+
+    nsyms = symsdb_get_syms_total_by_pos(t->sdb, i);
+    if (nsyms == 0 || i < min_skb_pos) {
+      bpf_program__set_autoload(entry_prog, false);
+      bpf_program__set_autoload(exit_prog, false);
+      continue;
+    }
+
+    /*
+     * Prefer the vmlinux function. When the target is in the module,
+     * libbpf loads and parses all module BTFs again to find it, while
+     * the vmlinux BTF is parsed anyway for CO-RE.
+     */
+    syms = symsdb_get_syms_by_pos(t->sdb, i);
+    sym = &syms[0];
+    for (int j = 0; j < nsyms; j++) {
+      if (syms[j].btf_fd == 0) {
+        sym = &syms[j];
+        break;
+      }
+    }
+
+    error = bpf_program__set_attach_target(entry_prog, 0, sym->symname);
+    if (error == -1) {
+      ERROR("bpf_program__set_attach_target failed\n");
+      return -1;
+    }
+
+    error = bpf_program__set_attach_target(exit_prog, 0, sym->symname);
+    if (error == -1) {
+      ERROR("bpf_program__set_attach_target failed\n");
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * Computed in 64 bits, since the page count is given by the user.
+ * opt_validate makes sure it fits to the max_entries.
+ */
+static uint64_t
+ringbuf_byte_size(struct ipft_tracer_opt *opt)
+{
+  if (opt->ringbuf_page_cnt > UINT32_MAX) {
+    return UINT64_MAX;
+  }
+
+  return (uint64_t)opt->ringbuf_page_cnt * getpagesize();
+}
+
+static int
+ringbuf_set_size(struct bpf_object *bpf, struct ipft_tracer_opt *opt)
+{
+  int error;
+  struct bpf_map *map;
+
+  map = bpf_object__find_map_by_name(bpf, "events_ringbuf");
+  if (map == NULL) {
+    ERROR("bpf_object__find_map_by_name failed\n");
+    return -1;
+  }
+
+  /* The count tracer sends no event */
+  if (opt->transport == IPFT_TRANSPORT_RINGBUF &&
+      opt->tracer != IPFT_TRACER_COUNT) {
+    error = bpf_map__set_max_entries(map, ringbuf_byte_size(opt));
+    if (error != 0) {
+      ERROR("bpf_map__set_max_entries failed\n");
+      return -1;
+    }
+    return 0;
+  }
+
+  if (probe_ringbuf()) {
+    /* Unused, but still has to be created. Make it as small as possible. */
+    error = bpf_map__set_max_entries(map, getpagesize());
+    if (error != 0) {
+      ERROR("bpf_map__set_max_entries failed\n");
+      return -1;
+    }
+    return 0;
+  }
+
+  /*
+   * The kernel cannot create ring buffer map. Replace it with the
+   * smallest array map. BPF programs never touch it, because the code
+   * path using ring buffer is eliminated when the kernel lacks it.
+   */
+  if (bpf_map__set_type(map, BPF_MAP_TYPE_ARRAY) != 0 ||
+      bpf_map__set_key_size(map, sizeof(uint32_t)) != 0 ||
+      bpf_map__set_value_size(map, sizeof(uint32_t)) != 0 ||
+      bpf_map__set_max_entries(map, 1) != 0) {
+    ERROR("Failed to replace ring buffer map with array\n");
+    return -1;
+  }
+
+  return 0;
+}
+
+/*
+ * Shrink the map not used with the given options
+ */
+static int
+map_set_unused(struct bpf_object *bpf, const char *name)
+{
+  struct bpf_map *map;
+
+  map = bpf_object__find_map_by_name(bpf, name);
+  if (map == NULL) {
+    ERROR("bpf_object__find_map_by_name failed\n");
+    return -1;
+  }
+
+  /* The map is unused. Don't waste the memory. */
+  if (bpf_map__set_max_entries(map, 1) != 0) {
+    ERROR("bpf_map__set_max_entries failed\n");
+    return -1;
+  }
+
+  return 0;
+}
+
+static int
+tracked_skbs_set_size(struct bpf_object *bpf, struct ipft_tracer_opt *opt)
+{
+  /* Default size defined in the BPF program is used */
+  if (opt->track_skb) {
+    return 0;
+  }
+
+  return map_set_unused(bpf, "tracked_skbs");
+}
+
+/*
+ * The lineage programs are only loaded to the object attaching them
+ */
+static int
+lineage_setup(struct bpf_object *bpf, bool enable)
+{
+  struct bpf_program *prog;
+
+  bpf_object__for_each_program(prog, bpf) {
+    if (is_lineage_prog(prog)) {
+      bpf_program__set_autoload(prog, enable);
+    }
+  }
+
+  if (enable) {
+    return 0;
+  }
+
+  return map_set_unused(bpf, "lineage_stash");
+}
+
+/*
+ * Same as the lineage, the free programs are only loaded to the object
+ * attaching them
+ */
+static int
+free_setup(struct bpf_object *bpf, bool enable)
+{
+  struct bpf_program *prog;
+
+  bpf_object__for_each_program(prog, bpf) {
+    if (is_free_prog(prog)) {
+      bpf_program__set_autoload(prog, enable);
+    }
+  }
+
+  if (enable) {
+    return 0;
+  }
+
+  return map_set_unused(bpf, "skb_free_stacks");
+}
+
+/*
+ * The return program and the skb stash of kprobe-multi are only used
+ * by the function_graph tracer
+ */
+static int
+kprobe_multi_setup_return(struct bpf_object *bpf, struct ipft_tracer_opt *opt)
+{
+  struct bpf_program *prog;
+
+  if (opt->tracer == IPFT_TRACER_FUNCTION_GRAPH) {
+    return 0;
+  }
+
+  prog = bpf_object__find_program_by_name(bpf, "ipft_main_return");
+  if (prog == NULL) {
+    ERROR("bpf_object__find_program_by_name failed\n");
+    return -1;
+  }
+
+  bpf_program__set_autoload(prog, false);
+
+  return map_set_unused(bpf, "skb_stash");
+}
+
+/*
+ * The function address to id map is the fallback of the attach
+ * cookie. kprobe-multi always has the cookie.
+ */
+static bool
+needs_func_ids(struct ipft_tracer *t)
+{
+  switch (t->opt->backend) {
+  case IPFT_BACKEND_KPROBE:
+    return !t->kprobe_cookie;
+  case IPFT_BACKEND_KPROBE_MULTI:
+    return false;
+  default:
+    return true;
+  }
+}
+
+static int
+func_ids_set_size(struct bpf_object *bpf, struct ipft_tracer *t)
+{
+  struct bpf_map *map;
+
+  /* Default size defined in the BPF program is used */
+  if (!needs_func_ids(t)) {
+    return 0;
+  }
+
+  map = bpf_object__find_map_by_name(bpf, "func_ids");
+  if (map == NULL) {
+    ERROR("bpf_object__find_map_by_name failed\n");
+    return -1;
+  }
+
+  if (bpf_map__set_max_entries(map, t->nfuncs) != 0) {
+    ERROR("bpf_map__set_max_entries failed\n");
+    return -1;
+  }
+
+  return 0;
+}
+
+/*
+ * Size the counter map for all function ids
+ */
+static int
+func_hits_set_size(struct bpf_object *bpf, struct ipft_tracer *t)
+{
+  int error;
+  struct bpf_map *hits;
+
+  hits = bpf_object__find_map_by_name(bpf, "func_hits");
+  if (hits == NULL) {
+    ERROR("bpf_object__find_map_by_name failed\n");
+    return -1;
+  }
+
+  /* Default size defined in the BPF program is used */
+  if (t->opt->tracer != IPFT_TRACER_COUNT) {
+    return 0;
+  }
+
+  if (t->nfuncs == 0) {
+    ERROR("No function to count\n");
+    return -1;
+  }
+
+  error = bpf_map__set_max_entries(hits, t->nfuncs * t->ncpus);
+  if (error != 0) {
+    ERROR("bpf_map__set_max_entries failed\n");
+    return -1;
+  }
+
+  /*
+   * Only set here since the kernel older than v5.5 cannot create
+   * mmapable array even if we don't use it.
+   */
+  error = bpf_map__set_map_flags(hits, BPF_F_MMAPABLE);
+  if (error != 0) {
+    ERROR("bpf_map__set_map_flags failed\n");
+    return -1;
+  }
+
+  return 0;
+}
+
+static int
+populate_func_ids(struct bpf_object *bpf, struct ipft_tracer *t)
+{
+  int error, fd;
+  struct ipft_sym *syms;
+
+  fd = bpf_object__find_map_fd_by_name(bpf, "func_ids");
+  if (fd < 0) {
+    ERROR("bpf_object__find_map_fd_by_name failed\n");
+    return -1;
+  }
+
+  for (int i = 0; i < get_max_skb_pos_for_backend(t->opt->backend); i++) {
+    syms = symsdb_get_syms_by_pos(t->sdb, i);
+    if (syms == NULL) {
+      continue;
+    }
+
+    for (int j = 0; j < symsdb_get_syms_total_by_pos(t->sdb, i); j++) {
+      error = bpf_map_update_elem(fd, &syms[j].addr, &syms[j].id, 0);
+      if (error == -1) {
+        ERROR("Cannot update func_ids map\n");
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+static int
+packet_traces_set_size(struct bpf_object *bpf, struct ipft_tracer_opt *opt)
+{
+  /* Default size defined in the BPF program is used */
+  if (opt->consolidate) {
+    return 0;
+  }
+
+  return map_set_unused(bpf, "packet_traces");
+}
+
+/*
+ * Fill the read-only configuration of the BPF programs. Must be done
+ * before loading, so that the verifier can see the values.
+ */
+static int
+config_set(struct bpf_object *bpf, struct ipft_tracer *t)
+{
+  struct bpf_map *map;
+  struct ipft_trace_config conf = {0};
+
+  conf.mark = t->opt->mark;
+  conf.mask = t->opt->mask;
+  conf.transport = t->opt->transport;
+  conf.data_len = t->script != NULL ? IPFT_MODULE_DATA_SIZE : 0;
+  conf.nfuncs = t->nfuncs;
+  conf.filter = t->opt->filter;
+
+  if (t->opt->consolidate) {
+    conf.flags |= IPFT_TRACE_F_CONSOLIDATE;
+  }
+
+  if (t->opt->only_dropped) {
+    conf.flags |= IPFT_TRACE_F_ONLY_DROPPED;
+  }
+
+  if (t->opt->track_skb) {
+    conf.flags |= IPFT_TRACE_F_TRACK_SKB;
+  }
+
+  /* fentry ignores it. fexit can read the arguments. */
+  if (t->opt->tracer == IPFT_TRACER_FUNCTION_GRAPH) {
+    conf.flags |= IPFT_TRACE_F_STASH_SKB;
+  }
+
+  if (t->opt->tracer == IPFT_TRACER_COUNT) {
+    conf.flags |= IPFT_TRACE_F_COUNT;
+  }
+
+  map = bpf_object__find_map_by_name(bpf, ".rodata.config");
+  if (map == NULL) {
+    ERROR("bpf_object__find_map_by_name failed\n");
+    return -1;
+  }
+
+  if (bpf_map__set_initial_value(map, &conf, sizeof(conf)) != 0) {
+    ERROR("bpf_map__set_initial_value failed\n");
+    return -1;
+  }
+
+  return 0;
+}
+
+/*
+ * Open the BPF object of the backend linked with the script module.
+ * The linked image must be kept until the object is loaded.
+ */
+static int
+bpf_open(struct bpf_object **bpfp, uint8_t **linkedp,
+         enum ipft_backends backend, struct ipft_tracer *t)
+{
+  int error;
+  struct bpf_object *bpf;
+  uint8_t *image, *linked = NULL;
+  uint8_t *target_image, *module_image;
+  size_t image_size, target_image_size, module_image_size;
+
+  error = get_target_image(backend, t->script == NULL, &target_image,
+                           &target_image_size);
+  if (error != 0) {
+    ERROR("get_target_image failed\n");
+    return -1;
+  }
+
+  if (t->script != NULL) {
+    error = script_get_program(t->script, &module_image, &module_image_size);
+    if (error != 0) {
+      ERROR("script_get_program failed\n");
+      return -1;
+    }
+
+    if (t->opt->link_cache) {
+      error = link_cached(&linked, &image_size, target_image,
+                          target_image_size, module_image, module_image_size);
+    } else {
+      error = do_link(&linked, &image_size, target_image, target_image_size,
+                      module_image, module_image_size);
+    }
+    if (error == -1) {
+      ERROR("Failed to link the script module\n");
+      return -1;
+    }
+
+    image = linked;
+  } else {
+    /* Already linked with the null module. No need to link. */
+    image = target_image;
+    image_size = target_image_size;
+  }
+
+  struct bpf_object_open_opts opts = {
+      .sz = sizeof(opts),
+      .object_name = "ipft",
+  };
+
+  /* libbpf refers to the image until the object is loaded */
+  bpf = bpf_object__open_mem(image, image_size, &opts);
+  if (libbpf_get_error(bpf) != 0) {
+    ERROR("bpf_object__open_mem failed\n");
     return -1;
   }
 
-  *pbp = pb;
+  *bpfp = bpf;
+  *linkedp = linked;
 
   return 0;
 }
 
 /*
- * We need to carefully make sure tmpfiles we make in below functions
- * are unlinked. Otherwise, we'll leak the tmpfiles in user's /tmp.
+ * Load the fentry/fexit programs of the hybrid backend as a separate
+ * object. It reuses all maps of the kprobe-multi object, so the events,
+ * statistics are shared. The configuration is set to both.
  */
-
 static int
-create_tmpfile_from_image(int *fdp, char **namep, uint8_t *image,
-                          size_t image_size)
+hybrid_ftrace_create(struct bpf_object **bpfp, struct bpf_object *kprobe_bpf,
+                     struct ipft_tracer *t)
 {
-  int fd;
-  char *name;
+  int error, fd;
+  uint8_t *linked;
+  struct bpf_map *map;
+  struct bpf_object *bpf;
 
-  name = strdup("/tmp/ipft_XXXXXX");
-  if (name == NULL) {
-    ERROR("Failed to allocate memory for tmpfile name\n");
+  error = bpf_open(&bpf, &linked, IPFT_BACKEND_FTRACE, t);
+  if (error == -1) {
+    ERROR("bpf_open failed\n");
     return -1;
   }
 
-  fd = mkstemp(name);
-  if (fd == -1) {
-    ERROR("Failed to create tmpfile\n");
+  error = ftrace_set_init_target(bpf, t, KPROBE_MAX_SKB_POS);
+  if (error == -1) {
+    ERROR("ftrace_set_init_target failed\n");
     return -1;
   }
 
-  if (write(fd, image, image_size) == -1) {
-    ERROR("Failed to write image to tmpfile\n");
-    goto err0;
-  }
-
-  *fdp = fd;
-  *namep = name;
-
-  return 0;
-
-err0:
-  close(fd);
-  unlink(name);
-  return -1;
-}
-
-static int
-do_link(char **namep, uint8_t *target_image, size_t target_image_size,
-        uint8_t *module_image, size_t module_image_size)
-{
-  char *name;
-  struct bpf_linker *linker;
-  char *target_name, *module_name;
-  int error = -1, target_fd, module_fd;
-
-  error = create_tmpfile_from_image(&target_fd, &target_name, target_image,
-                                    target_image_size);
+  /* Attached from the kprobe-multi object */
+  error = lineage_setup(bpf, false);
   if (error == -1) {
-    ERROR("create_tmpfile_from_image for target image failed\n");
+    ERROR("lineage_setup failed\n");
     return -1;
   }
 
-  error = create_tmpfile_from_image(&module_fd, &module_name, module_image,
-                                    module_image_size);
+  error = free_setup(bpf, false);
   if (error == -1) {
-    ERROR("create_tmpfile_from_image for module image failed\n");
-    goto err0;
+    ERROR("free_setup failed\n");
+    return -1;
   }
 
-  struct bpf_linker_opts lopts = {.sz = sizeof(lopts)};
-
-  name = tmpnam(NULL);
-
-  linker = bpf_linker__new(name, &lopts);
-  if (linker == NULL) {
-    ERROR("bpf_linker__create failed\n");
-    goto err1;
-  }
+  bpf_object__for_each_map(map, bpf) {
+    /* .rodata, .bss and so on belong to each object */
+    if (bpf_map__is_internal(map)) {
+      continue;
+    }
 
-  struct bpf_linker_file_opts fopts = {.sz = sizeof(fopts)};
+    fd = bpf_object__find_map_fd_by_name(kprobe_bpf, bpf_map__name(map));
+    if (fd < 0) {
+      ERROR("Cannot find map %s to share\n", bpf_map__name(map));
+      return -1;
+    }
 
-  error = bpf_linker__add_file(linker, target_name, &fopts);
-  if (error == -1) {
-    ERROR("bpf_linker__add_file failed\n");
-    goto err2;
+    error = bpf_map__reuse_fd(map, fd);
+    if (error != 0) {
+      ERROR("bpf_map__reuse_fd failed\n");
+      return -1;
+    }
   }
 
-  error = bpf_linker__add_file(linker, module_name, &fopts);
+  error = config_set(bpf, t);
   if (error == -1) {
-    ERROR("bpf_linker__add_file failed\n");
-    goto err2;
+    ERROR("config_set failed\n");
+    return -1;
   }
 
-  error = bpf_linker__finalize(linker);
+  error = bpf_object__load(bpf);
   if (error == -1) {
-    ERROR("bpf_linker__finalize failed\n");
-    goto err2;
+    ERROR("bpf_object__load failed\n");
+    return -1;
   }
 
-  error = 0;
-  *namep = name;
-
-err2:
-  bpf_linker__free(linker);
-err1:
-  close(module_fd);
-  unlink(module_name);
-err0:
-  close(target_fd);
-  unlink(target_name);
-  return error;
-}
+  free(linked);
 
-static int
-get_target_image(enum ipft_backends backend, uint8_t **imagep,
-                 size_t *image_sizep)
-{
-  switch (backend) {
-  case IPFT_BACKEND_KPROBE:
-    *imagep = ipft_kprobe_bpf_o;
-    *image_sizep = ipft_kprobe_bpf_o_len;
-    break;
-  case IPFT_BACKEND_FTRACE:
-    *imagep = ipft_ftrace_bpf_o;
-    *image_sizep = ipft_ftrace_bpf_o_len;
-    break;
-  case IPFT_BACKEND_KPROBE_MULTI:
-    *imagep = ipft_kprobe_multi_bpf_o;
-    *image_sizep = ipft_kprobe_multi_bpf_o_len;
-    break;
-  default:
-    ERROR("Unsupported backend ID %d\n", backend);
-    return -1;
-  }
-  return 0;
-}
+  *bpfp = bpf;
 
-static int
-get_default_module_image(uint8_t **imagep, size_t *image_sizep)
-{
-  *imagep = null_module_bpf_o;
-  *image_sizep = null_module_bpf_o_len;
   return 0;
 }
 
 static int
-ftrace_set_init_target(struct bpf_object *bpf, struct ipft_tracer *t)
+bpf_create(struct bpf_object **bpfp, enum ipft_backends backend,
+           struct ipft_tracer *t)
 {
   int error;
+  uint8_t *linked;
+  struct bpf_object *bpf;
 
-  for (int i = 0; i < FTRACE_MAX_SKB_POS; i++) {
-    struct ipft_sym *sym;
-    struct bpf_program *entry_prog, *exit_prog;
+  /* kprobe-multi object owns the maps with hybrid backend */
+  error = bpf_open(&bpf, &linked,
+                   backend == IPFT_BACKEND_HYBRID ? IPFT_BACKEND_KPROBE_MULTI
+                                                  : backend,
+                   t);
+  if (error == -1) {
+    ERROR("bpf_open failed\n");
+    return -1;
+  }
 
-    error = get_prog_by_pos(bpf, i, &entry_prog, &exit_prog);
+  if (backend == IPFT_BACKEND_FTRACE) {
+    error = ftrace_set_init_target(bpf, t, 0);
     if (error == -1) {
-      ERROR("get_prog_by_pos failed\n");
+      ERROR("ftrace_set_init_target failed\n");
       return -1;
     }
-
-    if (symsdb_get_syms_total_by_pos(t->sdb, i) != 0) {
-      sym = symsdb_get_syms_by_pos(t->sdb, i)[0];
-    } else {
-      bpf_program__set_autoload(entry_prog, false);
-      bpf_program__set_autoload(exit_prog, false);
-      continue;
-    }
-
-    error = bpf_program__set_attach_target(entry_prog, 0, sym->symname);
+  } else if (backend == IPFT_BACKEND_KPROBE_MULTI ||
+             backend == IPFT_BACKEND_HYBRID) {
+    error = kprobe_multi_setup_return(bpf, t->opt);
     if (error == -1) {
-      ERROR("bpf_program__set_attach_target failed\n");
+      ERROR("kprobe_multi_setup_return failed\n");
       return -1;
     }
+  }
 
-    error = bpf_program__set_attach_target(exit_prog, 0, sym->symname);
+  error = ringbuf_set_size(bpf, t->opt);
+  if (error == -1) {
+    ERROR("ringbuf_set_size failed\n");
+    return -1;
+  }
+
+  /* Same for the perf buffer. Its size is the number of CPUs. */
+  if (t->opt->tracer == IPFT_TRACER_COUNT) {
+    error = map_set_unused(bpf, "events");
     if (error == -1) {
-      ERROR("bpf_program__set_attach_target failed\n");
+      ERROR("map_set_unused failed\n");
       return -1;
     }
   }
 
-  return 0;
-}
-
-static int
-bpf_create(struct bpf_object **bpfp, uint32_t mark, uint32_t mask,
-           enum ipft_backends backend, struct ipft_tracer *t)
-{
-  int error;
-  char *name;
-  struct bpf_object *bpf;
-  struct ipft_trace_config conf;
-  uint8_t *target_image, *module_image;
-  size_t target_image_size, module_image_size;
-
-  error = get_target_image(backend, &target_image, &target_image_size);
-  if (error != 0) {
-    ERROR("get_target_image failed\n");
+  error = packet_traces_set_size(bpf, t->opt);
+  if (error == -1) {
+    ERROR("packet_traces_set_size failed\n");
     return -1;
   }
 
-  if (t->script != NULL) {
-    error = script_get_program(t->script, &module_image, &module_image_size);
-    if (error != 0) {
-      ERROR("script_get_program failed\n");
-      return -1;
-    }
-  } else {
-    error = get_default_module_image(&module_image, &module_image_size);
-    if (error != 0) {
-      ERROR("get_default_module failed\n");
-      return -1;
-    }
+  error = tracked_skbs_set_size(bpf, t->opt);
+  if (error == -1) {
+    ERROR("tracked_skbs_set_size failed\n");
+    return -1;
   }
 
-  error = do_link(&name, target_image, target_image_size, module_image,
-                  module_image_size);
+  error = lineage_setup(bpf, t->opt->lineage);
   if (error == -1) {
-    ERROR("do_link failed\n");
+    ERROR("lineage_setup failed\n");
     return -1;
   }
 
-  struct bpf_object_open_opts opts = {
-      .sz = sizeof(opts),
-      .object_name = "ipft",
-  };
+  error = free_setup(bpf, t->opt->consolidate || t->opt->track_skb);
+  if (error == -1) {
+    ERROR("free_setup failed\n");
+    return -1;
+  }
 
-  bpf = bpf_object__open(name);
-  if (bpf == NULL) {
-    ERROR("bpf_object__open failed\n");
+  error = func_ids_set_size(bpf, t);
+  if (error == -1) {
+    ERROR("func_ids_set_size failed\n");
     return -1;
   }
 
-  unlink(name);
+  error = func_hits_set_size(bpf, t);
+  if (error == -1) {
+    ERROR("func_hits_set_size failed\n");
+    return -1;
+  }
 
-  if (backend == IPFT_BACKEND_FTRACE) {
-    error = ftrace_set_init_target(bpf, t);
-    if (error == -1) {
-      ERROR("ftrace_setup_prep failed\n");
-      return -1;
-    }
+  error = config_set(bpf, t);
+  if (error == -1) {
+    ERROR("config_set failed\n");
+    return -1;
   }
 
   error = bpf_object__load(bpf);
@@ -764,14 +2316,24 @@ bpf_create(struct bpf_object **bpfp, uint32_t mark, uint32_t mask,
     return -1;
   }
 
-  conf.mark = mark;
-  conf.mask = mask;
+  free(linked);
 
-  error = bpf_map_update_elem(bpf_object__find_map_fd_by_name(bpf, "config"),
-                              &(int){0}, &conf, 0);
-  if (error == -1) {
-    ERROR("Cannot update config map\n");
-    return -1;
+  if (needs_func_ids(t)) {
+    error = populate_func_ids(bpf, t);
+    if (error == -1) {
+      ERROR("populate_func_ids failed\n");
+      return -1;
+    }
+  }
+
+  if (backend == IPFT_BACKEND_HYBRID) {
+    error = hybrid_ftrace_create(&t->ftrace_bpf, bpf, t);
+    if (error == -1) {
+      ERROR("hybrid_ftrace_create failed\n");
+      return -1;
+    }
+  } else if (backend == IPFT_BACKEND_FTRACE) {
+    t->ftrace_bpf = bpf;
   }
 
   *bpfp = bpf;
@@ -779,12 +2341,10 @@ bpf_create(struct bpf_object **bpfp, uint32_t mark, uint32_t mask,
   return 0;
 }
 
-static bool end = false;
-
 static void
 handle_signal(__unused int signum)
 {
-  end = true;
+  end = 1;
   signal(SIGINT, SIG_DFL);
   signal(SIGTERM, SIG_DFL);
 }
@@ -843,6 +2403,27 @@ handle_tcp_probe(void *arg)
   return arg;
 }
 
+/*
+ * Count tracer doesn't send any event. Just read the counters.
+ */
+static int
+count_run(struct ipft_tracer *t)
+{
+  int error;
+
+  while (!end) {
+    sleep(1);
+
+    error = top_update(t->top);
+    if (error == -1) {
+      ERROR("top_update failed\n");
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
 int
 tracer_run(struct ipft_tracer *t)
 {
@@ -874,12 +2455,32 @@ tracer_run(struct ipft_tracer *t)
     }
   }
 
-  while (!end) {
-    if ((error = perf_buffer__poll(t->pb, 1000)) < 0) {
-      /* perf_buffer__poll cancelled with signal */
-      if (end) {
-        break;
+  if (t->top != NULL) {
+    return count_run(t);
+  }
+
+  if (t->pb != NULL && t->opt->nr_consumers > 1) {
+    error = perf_consumers_run(t);
+    if (error == -1) {
+      ERROR("perf_consumers_run failed\n");
+      return -1;
+    }
+  } else {
+    while (!end) {
+      if ((error = event_buffer_poll(t, 1000)) < 0) {
+        /* poll cancelled with signal */
+        if (end) {
+          break;
+        }
+        return -1;
       }
+    }
+  }
+
+  if (t->rb != NULL) {
+    error = collect_ringbuf_lost(t);
+    if (error == -1) {
+      ERROR("collect_ringbuf_lost failed\n");
       return -1;
     }
   }
@@ -890,6 +2491,8 @@ tracer_run(struct ipft_tracer *t)
     return -1;
   }
 
+  print_lost_summary(t);
+
   if (t->script != NULL) {
     script_exec_fini(t->script);
   }
@@ -900,13 +2503,20 @@ tracer_run(struct ipft_tracer *t)
 static bool
 opt_validate(struct ipft_tracer_opt *opt)
 {
+  uint64_t size;
+
   if (opt->backend == IPFT_BACKEND_UNSPEC) {
     ERROR("Backend unspecified\n");
     return false;
   }
 
-  if (opt->mark == 0 || opt->mask == 0) {
-    ERROR("mark/mask can't be zero\n");
+  /*
+   * Without the mark, the packets should be selected by the filters
+   * (the mask defaults to 0 then). Otherwise, all packets without mark
+   * are traced. Mask 0 explicitly ignores the mark.
+   */
+  if (opt->mark == 0 && opt->mask != 0 && !filter_is_set(&opt->filter)) {
+    ERROR("Either mark, mask 0 or filter is required\n");
     return false;
   }
 
@@ -920,6 +2530,57 @@ opt_validate(struct ipft_tracer_opt *opt)
     return false;
   }
 
+  if (opt->transport == IPFT_TRANSPORT_UNSPEC) {
+    ERROR("Transport unspecified\n");
+    return false;
+  }
+
+  if (opt->nr_consumers < 1) {
+    ERROR("consumer_threads should be at least 1\n");
+    return false;
+  }
+
+  if (opt->nr_attach_threads < 0) {
+    ERROR("attach_threads should be 0 (auto) or more\n");
+    return false;
+  }
+
+  if (opt->nr_consumers > 1 && opt->transport != IPFT_TRANSPORT_PERF) {
+    ERROR("Multiple consumer threads are only supported with perf "
+          "transport\n");
+    return false;
+  }
+
+  if (opt->consolidate && opt->script != NULL) {
+    ERROR("Consolidation doesn't support script\n");
+    return false;
+  }
+
+  if (opt->tracer == IPFT_TRACER_COUNT &&
+      (opt->script != NULL || opt->consolidate)) {
+    ERROR("Count tracer doesn't support script and consolidation\n");
+    return false;
+  }
+
+  if (opt->lineage &&
+      (opt->consolidate || opt->tracer == IPFT_TRACER_COUNT)) {
+    ERROR("Lineage is not supported with consolidation and count tracer\n");
+    return false;
+  }
+
+  if (opt->only_dropped && !opt->consolidate) {
+    ERROR("only_dropped requires consolidation\n");
+    return false;
+  }
+
+  /* The kernel checks the size in bytes, not in pages */
+  size = ringbuf_byte_size(opt);
+  if (size == 0 || size > UINT32_MAX || (size & (size - 1)) != 0) {
+    ERROR("ringbuf_page_count should be a power of 2 and the size should "
+          "fit in 32 bits\n");
+    return false;
+  }
+
   return true;
 }
 
@@ -927,6 +2588,7 @@ int
 tracer_create(struct ipft_tracer **tp, struct ipft_tracer_opt *opt)
 {
   int error;
+  double start;
   struct ipft_tracer *t;
 
   if (!opt_validate(opt)) {
@@ -942,45 +2604,108 @@ tracer_create(struct ipft_tracer **tp, struct ipft_tracer_opt *opt)
 
   t->opt = opt;
 
+  t->ncpus = libbpf_num_possible_cpus();
+  if (t->ncpus < 0) {
+    ERROR("libbpf_num_possible_cpus failed\n");
+    return -1;
+  }
+
+  t->lost = calloc(t->ncpus, sizeof(*t->lost));
+  if (t->lost == NULL) {
+    ERROR("Failed to allocate memory\n");
+    return -1;
+  }
+
   struct ipft_symsdb_opt sdb_opt = {
       .max_args = get_max_args_for_backend(opt->backend),
       .max_skb_pos = get_max_skb_pos_for_backend(opt->backend),
+      .cache_name =
+          opt->symsdb_cache ? get_backend_name_by_id(opt->backend) : NULL,
   };
 
+  start = get_monotonic_sec();
+
   error = symsdb_create(&t->sdb, &sdb_opt);
   if (error != 0) {
     ERROR("symsdb_create failed\n");
     return -1;
   }
 
+  VERBOSE("Took %.3lf seconds to build symbol database\n",
+          get_monotonic_sec() - start);
+
+  t->nfuncs = symsdb_get_funcs_total(t->sdb);
+  t->kprobe_cookie =
+      opt->backend == IPFT_BACKEND_KPROBE && probe_kprobe_cookie();
+
   error = script_create(&t->script, opt->script);
   if (error == -1) {
     ERROR("script_create failed\n");
     return -1;
   }
 
-  error = bpf_create(&t->bpf, opt->mark, opt->mask, opt->backend, t);
+  start = get_monotonic_sec();
+
+  error = bpf_create(&t->bpf, opt->backend, t);
   if (error == -1) {
     ERROR("bpf_create failed\n");
     return -1;
   }
 
+  VERBOSE("Took %.3lf seconds to load BPF programs\n",
+          get_monotonic_sec() - start);
+
   error = regex_create(&t->re, opt->regex);
   if (error != 0) {
     ERROR("regex_create failed\n");
     return -1;
   }
 
+  error = exclude_create(&t->ex, opt->backend, opt->failure_cache);
+  if (error == -1) {
+    ERROR("exclude_create failed\n");
+    return -1;
+  }
+
+  if (opt->tracer == IPFT_TRACER_COUNT) {
+    error = top_create(&t->top, t->sdb,
+                       bpf_object__find_map_fd_by_name(t->bpf, "func_hits"),
+                       t->nfuncs, t->ncpus);
+    if (error == -1) {
+      ERROR("top_create failed\n");
+      return -1;
+    }
+
+    *tp = t;
+
+    return 0;
+  }
+
   error = output_create(&t->out, opt->output, t->sdb, t->script, opt->tracer);
   if (error != 0) {
     ERROR("output_create failed\n");
     return -1;
   }
 
-  error = perf_buffer_create(&t->pb, t, opt->perf_page_cnt,
-                             opt->perf_sample_period, opt->perf_wakeup_events);
-  if (error == -1) {
-    ERROR("perf_buffer_create failed\n");
+  switch (opt->transport) {
+  case IPFT_TRANSPORT_PERF:
+    error = perf_buffer_create(&t->pb, t, opt->perf_page_cnt,
+                               opt->perf_sample_period,
+                               opt->perf_wakeup_events);
+    if (error == -1) {
+      ERROR("perf_buffer_create failed\n");
+      return -1;
+    }
+    break;
+  case IPFT_TRANSPORT_RINGBUF:
+    error = ring_buffer_create(&t->rb, t);
+    if (error == -1) {
+      ERROR("ring_buffer_create failed\n");
+      return -1;
+    }
+    break;
+  default:
+    ERROR("Unknown transport ID %d\n", opt->transport);
     return -1;
   }
 
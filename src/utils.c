@@ -4,6 +4,10 @@
 #include <stdbool.h>
 #include <string.h>
 #include <assert.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <linux/filter.h>
 
 #include <bpf/bpf.h>
@@ -18,7 +22,7 @@ list_functions(struct ipft_tracer_opt *opt)
   int error;
   struct ipft_regex *re;
   struct ipft_symsdb *sdb;
-  struct ipft_sym *sym, **syms;
+  struct ipft_sym *sym, *syms;
 
   error = regex_create(&re, opt->regex);
   if (error == -1) {
@@ -29,6 +33,8 @@ list_functions(struct ipft_tracer_opt *opt)
   struct ipft_symsdb_opt sdb_opt = {
       .max_args = get_max_args_for_backend(opt->backend),
       .max_skb_pos = get_max_skb_pos_for_backend(opt->backend),
+      .cache_name =
+          opt->symsdb_cache ? get_backend_name_by_id(opt->backend) : NULL,
   };
 
   error = symsdb_create(&sdb, &sdb_opt);
@@ -45,7 +51,7 @@ list_functions(struct ipft_tracer_opt *opt)
       continue;
     }
     for (int j = 0; j < symsdb_get_syms_total_by_pos(sdb, i); j++) {
-      sym = syms[j];
+      sym = &syms[j];
       if (regex_match(re, sym->symname)) {
         printf("%64.64s\t0x%016lx\t%d\n", sym->symname, sym->addr, i);
       }
@@ -99,6 +105,32 @@ probe_kprobe_multi(void)
   return 1;
 }
 
+int
+probe_ringbuf(void)
+{
+  int fd;
+
+  fd = bpf_map_create(BPF_MAP_TYPE_RINGBUF, NULL, 0, 0, getpagesize(), NULL);
+  if (fd < 0) {
+    return 0;
+  }
+
+  close(fd);
+
+  return 1;
+}
+
+/*
+ * The kernel which allows kprobe programs to call bpf_get_attach_cookie
+ * (v5.15 or above) can attach kprobe with the cookie
+ */
+int
+probe_kprobe_cookie(void)
+{
+  return libbpf_probe_bpf_helper(BPF_PROG_TYPE_KPROBE,
+                                 BPF_FUNC_get_attach_cookie, NULL) == 1;
+}
+
 char *
 libbpf_error_string(int error)
 {
@@ -107,3 +139,216 @@ libbpf_error_string(int error)
   libbpf_strerror(error, buf, sizeof(buf));
   return buf;
 }
+
+/*
+ * FNV-1a. Start from HASH_INIT.
+ */
+void
+hash_update(uint64_t *h, const void *buf, size_t len)
+{
+  const uint8_t *p = buf;
+
+  for (size_t i = 0; i < len; i++) {
+    *h ^= p[i];
+    *h *= 0x100000001b3ULL;
+  }
+}
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void
+sha256_block(struct sha256_ctx *c, const uint8_t *p)
+{
+  uint32_t w[64], s[8], t1, t2;
+
+  for (int i = 0; i < 16; i++) {
+    w[i] = (uint32_t)p[i * 4] << 24 | (uint32_t)p[i * 4 + 1] << 16 |
+           (uint32_t)p[i * 4 + 2] << 8 | p[i * 4 + 3];
+  }
+
+  for (int i = 16; i < 64; i++) {
+    w[i] = w[i - 16] + w[i - 7] +
+           (ROTR32(w[i - 15], 7) ^ ROTR32(w[i - 15], 18) ^ (w[i - 15] >> 3)) +
+           (ROTR32(w[i - 2], 17) ^ ROTR32(w[i - 2], 19) ^ (w[i - 2] >> 10));
+  }
+
+  memcpy(s, c->h, sizeof(s));
+
+  for (int i = 0; i < 64; i++) {
+    t1 = s[7] + (ROTR32(s[4], 6) ^ ROTR32(s[4], 11) ^ ROTR32(s[4], 25)) +
+         ((s[4] & s[5]) ^ (~s[4] & s[6])) + sha256_k[i] + w[i];
+    t2 = (ROTR32(s[0], 2) ^ ROTR32(s[0], 13) ^ ROTR32(s[0], 22)) +
+         ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+    memmove(s + 1, s, sizeof(s[0]) * 7);
+    s[4] += t1;
+    s[0] = t1 + t2;
+  }
+
+  for (int i = 0; i < 8; i++) {
+    c->h[i] += s[i];
+  }
+}
+
+/*
+ * SHA-256 for the cache keys which must not collide even when someone
+ * crafts the input
+ */
+void
+sha256_init(struct sha256_ctx *c)
+{
+  static const uint32_t h[8] = {
+      0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+  };
+
+  memcpy(c->h, h, sizeof(h));
+  c->len = 0;
+}
+
+void
+sha256_update(struct sha256_ctx *c, const void *buf, size_t len)
+{
+  size_t n, used;
+  const uint8_t *p = buf;
+
+  while (len > 0) {
+    used = c->len % sizeof(c->buf);
+    n = sizeof(c->buf) - used < len ? sizeof(c->buf) - used : len;
+    memcpy(c->buf + used, p, n);
+    c->len += n;
+    p += n;
+    len -= n;
+    if (used + n == sizeof(c->buf)) {
+      sha256_block(c, c->buf);
+    }
+  }
+}
+
+void
+sha256_final(struct sha256_ctx *c, uint8_t *digest)
+{
+  uint8_t pad[72] = {0x80};
+  uint64_t bits = c->len * 8;
+  size_t used = c->len % sizeof(c->buf);
+  size_t padlen = (used < 56 ? 56 : 120) - used;
+
+  for (int i = 0; i < 8; i++) {
+    pad[padlen + i] = bits >> (56 - i * 8);
+  }
+
+  sha256_update(c, pad, padlen + 8);
+
+  for (int i = 0; i < 8; i++) {
+    digest[i * 4] = c->h[i] >> 24;
+    digest[i * 4 + 1] = c->h[i] >> 16;
+    digest[i * 4 + 2] = c->h[i] >> 8;
+    digest[i * 4 + 3] = c->h[i];
+  }
+}
+
+/*
+ * The caches are used without any validation of their contents, so
+ * only the ones nobody but root can write to are trusted
+ */
+static bool
+cache_is_trusted(struct stat *st)
+{
+  return st->st_uid == 0 && (st->st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+static int
+cache_dir_check(void)
+{
+  struct stat st;
+
+  if (lstat(IPFT_CACHE_DIR, &st) == -1) {
+    return -1;
+  }
+
+  if (!S_ISDIR(st.st_mode) || !cache_is_trusted(&st)) {
+    VERBOSE("Ignoring %s not owned by root or writable by others\n",
+            IPFT_CACHE_DIR);
+    return -1;
+  }
+
+  return 0;
+}
+
+/*
+ * Returns -1 when the cache directory is unusable
+ */
+int
+cache_dir_create(void)
+{
+  if (mkdir(IPFT_CACHE_DIR, 0700) == -1 && errno != EEXIST) {
+    VERBOSE("Cannot create %s: %s\n", IPFT_CACHE_DIR, strerror(errno));
+    return -1;
+  }
+
+  return cache_dir_check();
+}
+
+/*
+ * Open the cache file for read. Returns -1 when it doesn't exist or
+ * cannot be trusted.
+ */
+int
+cache_open(const char *path)
+{
+  int fd;
+  struct stat st;
+
+  if (cache_dir_check() == -1) {
+    return -1;
+  }
+
+  /* The file itself is checked, not the one the symlink points to */
+  fd = open(path, O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+  if (fd == -1) {
+    return -1;
+  }
+
+  if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) ||
+      !cache_is_trusted(&st)) {
+    VERBOSE("Ignoring %s not owned by root or writable by others\n", path);
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+int
+write_all(int fd, const void *buf, size_t len)
+{
+  ssize_t n;
+  const uint8_t *p = buf;
+
+  while (len > 0) {
+    n = write(fd, p, len);
+    if (n == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    p += n;
+    len -= n;
+  }
+
+  return 0;
+}
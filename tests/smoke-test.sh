@@ -1,8 +1,9 @@
 #!/bin/sh
 
-for tracer in "$@"; do
+# Run ipft with the options while making some traffic
+run_ipft() {
   # Launch function tracer
-  ipft -v -m 1 -t $tracer -o json --enable-probe-server > /tmp/trace.txt &
+  ipft -v "$@" --enable-probe-server > /tmp/trace.txt &
 
   # Wait for tracer to be ready
   until nc -z 127.0.0.1 13720; do sleep 2s; done
@@ -13,9 +14,74 @@ for tracer in "$@"; do
   # Stop tracer
   pkill -e -TERM ipft
 
-  # Check if the trace is valid json
-  cat /tmp/trace.txt | jq -r
-
   # Wait for ipft to finish
   wait
+}
+
+# Whether the running kernel is the given version or above
+kernel_at_least() {
+  [ "$(printf '%s\n' "$1" "$(uname -r)" | sort -V | head -n 1)" = "$1" ]
+}
+
+# Check if the trace is valid json
+check_json() {
+  jq -r . /tmp/trace.txt || exit 1
+}
+
+# Each packet is reported once, and the ping is not dropped
+check_consolidated() {
+  check_json
+  jq -e -s 'length > 0 and all(.dropped == false) and
+            (group_by(.packet_id) | all(length == 1))' /tmp/trace.txt ||
+    exit 1
+}
+
+for tracer in "$@"; do
+  run_ipft -m 1 -t $tracer -o json
+  check_json
+
+  run_ipft -m 1 -t $tracer -o json --transport ringbuf
+  check_json
+  test -s /tmp/trace.txt || exit 1
+
+  run_ipft -m 1 -t $tracer -o json --transport perf --consumer-threads 2
+  check_json
+  test -s /tmp/trace.txt || exit 1
+
+  run_ipft -m 1 -t $tracer -o json --consolidate
+  check_consolidated
+
+  run_ipft -m 1 -t $tracer -o json --consolidate --only-dropped
+  check_json
+  test ! -s /tmp/trace.txt || exit 1
+
+  run_ipft -m 1 -t $tracer -o json --track-skb
+  check_json
+  test -s /tmp/trace.txt || exit 1
+
+  run_ipft -m 1 -t $tracer -o json --track-skb --consolidate
+  check_consolidated
+
+  run_ipft -m 1 -t $tracer -o json --lineage
+  check_json
+  test -s /tmp/trace.txt || exit 1
+
+  # kprobe-multi used by the hybrid backend requires v5.18 or above
+  if kernel_at_least 5.18; then
+    run_ipft -m 1 -t $tracer -b hybrid -o json
+    check_json
+    test -s /tmp/trace.txt || exit 1
+  fi
+
+  # The final table is printed on exit. Some functions should be hit.
+  if [ $tracer = function ]; then
+    run_ipft -m 1 -t count
+    awk '$2 ~ /^[1-9]/ { hit = 1 } END { exit !hit }' /tmp/trace.txt ||
+      exit 1
+  fi
+
+  # The filters alone select the ping regardless of its mark
+  run_ipft -t $tracer -o json --daddr 127.0.0.1 --l4-protocol icmp
+  check_json
+  test -s /tmp/trace.txt || exit 1
 done